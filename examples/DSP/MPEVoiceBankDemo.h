@@ -0,0 +1,383 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE examples.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   To use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES,
+   WHETHER EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR
+   PURPOSE, ARE DISCLAIMED.
+
+  ==============================================================================
+*/
+
+/*******************************************************************************
+ The block below describes the properties of this PIP. A PIP is a short snippet
+ of code that can be read by the Projucer and used to generate a JUCE project.
+
+ BEGIN_JUCE_PIP_METADATA
+
+ name:             MPEVoiceBankDemo
+ version:          1.0.0
+ vendor:           JUCE
+ website:          http://juce.com
+ description:      Renders MPE voices together using SIMD registers.
+
+ dependencies:     juce_audio_basics, juce_audio_devices, juce_audio_formats,
+                   juce_audio_processors, juce_audio_utils, juce_core,
+                   juce_data_structures, juce_dsp, juce_events, juce_graphics,
+                   juce_gui_basics, juce_gui_extra
+ exporters:        xcode_mac, vs2022, linux_make
+
+ moduleFlags:      JUCE_STRICT_REFCOUNTEDPOINTER=1
+
+ type:             Component
+ mainClass:        MPEVoiceBankDemo
+
+ useLocalCopy:     1
+
+ END_JUCE_PIP_METADATA
+
+*******************************************************************************/
+
+#pragma once
+
+#include "../Assets/DemoUtilities.h"
+
+using namespace dsp;
+
+//==============================================================================
+/*  A cheap approximation of sin (pi * x) for x in [-1, 1), which only needs
+    operations that are available on SIMDRegister as well as on plain floats.
+*/
+template <typename Type>
+static Type fastSine (Type x, Type absX) noexcept
+{
+    return x * 4.0f - x * absX * 4.0f;
+}
+
+template <typename Type>
+static Type refineSine (Type p, Type absP) noexcept
+{
+    return p + (p * absP - p) * 0.225f;
+}
+
+//==============================================================================
+/*  A simple decaying sine voice. On its own, it renders itself one sample at a
+    time, but if it's given a voice bank, all of the voices that share the bank
+    are rendered together, several at a time.
+*/
+class SineVoice final : public MPESynthesiserVoice
+{
+public:
+    explicit SineVoice (MPESynthesiserVoiceBank* bankToUse)  : bank (bankToUse) {}
+
+    void noteStarted() override
+    {
+        phase = 0.0f;
+        level = 0.02f * currentlyPlayingNote.noteOnVelocity.asUnsignedFloat();
+        decay = 1.0f;
+        notePitchbendChanged();
+    }
+
+    void noteStopped (bool allowTailOff) override
+    {
+        if (allowTailOff)
+            decay = 0.9995f;
+        else
+            clearCurrentNote();
+    }
+
+    void notePitchbendChanged() override
+    {
+        increment = (float) (2.0 * currentlyPlayingNote.getFrequencyInHertz() / getSampleRate());
+    }
+
+    void notePressureChanged() override  {}
+    void noteTimbreChanged() override    {}
+    void noteKeyStateChanged() override  {}
+
+    void renderNextBlock (AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override
+    {
+        for (int i = startSample; i < startSample + numSamples; ++i)
+        {
+            auto p = fastSine (phase, std::abs (phase));
+            auto sample = refineSine (p, std::abs (p)) * level;
+
+            for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
+                outputBuffer.addSample (channel, i, sample);
+
+            phase += increment;
+
+            if (phase >= 1.0f)
+                phase -= 2.0f;
+
+            level *= decay;
+        }
+
+        finishIfSilent();
+    }
+
+    using MPESynthesiserVoice::renderNextBlock;
+
+    MPESynthesiserVoiceBank* getVoiceBank() const override  { return bank; }
+
+    void finishIfSilent() noexcept
+    {
+        if (decay < 1.0f && level < 1.0e-4f)
+            clearCurrentNote();
+    }
+
+    float phase = 0.0f, increment = 0.0f, level = 0.0f, decay = 1.0f;
+
+private:
+    MPESynthesiserVoiceBank* bank = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SineVoice)
+};
+
+//==============================================================================
+/*  Renders SineVoices in groups of SIMDRegister<float>::size(), with one voice
+    in each SIMD lane. The state of each group is gathered into a structure of
+    arrays at the start of every block, and written back to the voices at the end.
+*/
+class SineVoiceBank final : public MPESynthesiserVoiceBank
+{
+public:
+    using Register = SIMDRegister<float>;
+    static constexpr auto numLanes = Register::size();
+
+    void renderVoices (AudioBuffer<float>& outputBuffer, int startSample, int numSamples,
+                       Span<MPESynthesiserVoice* const> voices) override
+    {
+        for (size_t first = 0; first < voices.size(); first += numLanes)
+        {
+            const auto numVoicesInGroup = jmin (numLanes, voices.size() - first);
+
+            // Unused lanes render silence
+            alignas (Register) float phases[numLanes] {}, increments[numLanes] {}, levels[numLanes] {}, decays[numLanes] {};
+
+            for (size_t lane = 0; lane < numVoicesInGroup; ++lane)
+            {
+                auto& voice = getSineVoice (voices, first + lane);
+                phases[lane]     = voice.phase;
+                increments[lane] = voice.increment;
+                levels[lane]     = voice.level;
+                decays[lane]     = voice.decay;
+            }
+
+            auto phase     = Register::fromRawArray (phases);
+            auto increment = Register::fromRawArray (increments);
+            auto level     = Register::fromRawArray (levels);
+            auto decay     = Register::fromRawArray (decays);
+
+            const auto one = Register::expand (1.0f);
+            const auto two = Register::expand (2.0f);
+
+            for (int i = startSample; i < startSample + numSamples; ++i)
+            {
+                auto p = fastSine (phase, Register::abs (phase));
+                auto sample = (refineSine (p, Register::abs (p)) * level).sum();
+
+                for (int channel = 0; channel < outputBuffer.getNumChannels(); ++channel)
+                    outputBuffer.addSample (channel, i, sample);
+
+                phase += increment;
+                phase -= two & Register::greaterThanOrEqual (phase, one);
+                level *= decay;
+            }
+
+            phase.copyToRawArray (phases);
+            level.copyToRawArray (levels);
+
+            for (size_t lane = 0; lane < numVoicesInGroup; ++lane)
+            {
+                auto& voice = getSineVoice (voices, first + lane);
+                voice.phase = phases[lane];
+                voice.level = levels[lane];
+                voice.finishIfSilent();
+            }
+        }
+    }
+
+    using MPESynthesiserVoiceBank::renderVoices;
+
+private:
+    static SineVoice& getSineVoice (Span<MPESynthesiserVoice* const> voices, size_t index)
+    {
+        return *static_cast<SineVoice*> (voices[index]);
+    }
+};
+
+//==============================================================================
+class MPEVoiceBankDemo final : public Component,
+                               private AudioIODeviceCallback,
+                               private Timer
+{
+public:
+    MPEVoiceBankDemo()
+    {
+        for (auto* synth : { &bankedSynth, &plainSynth })
+        {
+            synth->enableLegacyMode (2, Range<int> (1, 17));
+
+            for (int i = 0; i < maxNumNotes; ++i)
+                synth->addVoice (new SineVoice (synth == &bankedSynth ? &voiceBank : nullptr));
+        }
+
+        addAndMakeVisible (numNotesLabel);
+        numNotesLabel.attachToComponent (&numNotesSlider, true);
+
+        addAndMakeVisible (numNotesSlider);
+        numNotesSlider.setRange (0.0, (double) maxNumNotes, 1.0);
+        numNotesSlider.setValue (64.0, dontSendNotification);
+        numNotesSlider.onValueChange = [this] { requestedNumNotes = (int) numNotesSlider.getValue(); };
+        requestedNumNotes = (int) numNotesSlider.getValue();
+
+        addAndMakeVisible (useVoiceBankButton);
+        useVoiceBankButton.setToggleState (true, dontSendNotification);
+        useVoiceBankButton.onClick = [this] { shouldUseVoiceBank = useVoiceBankButton.getToggleState(); };
+
+        addAndMakeVisible (timingLabel);
+
+       #ifndef JUCE_DEMO_RUNNER
+        audioDeviceManager.initialise (0, 2, nullptr, true, {}, nullptr);
+       #endif
+
+        audioDeviceManager.addAudioCallback (this);
+
+        startTimerHz (4);
+
+        setOpaque (true);
+        setSize (640, 200);
+    }
+
+    ~MPEVoiceBankDemo() override
+    {
+        audioDeviceManager.removeAudioCallback (this);
+    }
+
+    //==============================================================================
+    void paint (Graphics& g) override
+    {
+        g.fillAll (getUIColourIfAvailable (LookAndFeel_V4::ColourScheme::UIColour::windowBackground));
+    }
+
+    void resized() override
+    {
+        auto bounds = getLocalBounds().reduced (16);
+
+        numNotesSlider    .setBounds (bounds.removeFromTop (24).withTrimmedLeft (120));
+        bounds.removeFromTop (8);
+        useVoiceBankButton.setBounds (bounds.removeFromTop (24));
+        bounds.removeFromTop (8);
+        timingLabel       .setBounds (bounds.removeFromTop (48));
+    }
+
+private:
+    //==============================================================================
+    void audioDeviceAboutToStart (AudioIODevice* device) override
+    {
+        for (auto* synth : { &bankedSynth, &plainSynth })
+            synth->setCurrentPlaybackSampleRate (device->getCurrentSampleRate());
+
+        numNotesPlaying = 0;
+    }
+
+    void audioDeviceStopped() override {}
+
+    void audioDeviceIOCallbackWithContext (const float* const*, int,
+                                           float* const* outputChannelData, int numOutputChannels,
+                                           int numSamples, const AudioIODeviceCallbackContext&) override
+    {
+        AudioBuffer<float> buffer (outputChannelData, numOutputChannels, numSamples);
+        buffer.clear();
+
+        midi.clear();
+
+        if (const auto useVoiceBank = shouldUseVoiceBank.load(); useVoiceBank != usingVoiceBank)
+        {
+            getSynth().turnOffAllVoices (false);
+            usingVoiceBank = useVoiceBank;
+            numNotesPlaying = 0;
+        }
+
+        for (const auto target = requestedNumNotes.load(); numNotesPlaying != target;)
+        {
+            if (numNotesPlaying < target)
+                midi.addEvent (MidiMessage::noteOn (getChannel (numNotesPlaying), getNoteNumber (numNotesPlaying), 0.8f), 0);
+            else
+                midi.addEvent (MidiMessage::noteOff (getChannel (numNotesPlaying - 1), getNoteNumber (numNotesPlaying - 1)), 0);
+
+            numNotesPlaying += numNotesPlaying < target ? 1 : -1;
+        }
+
+        const auto startTicks = Time::getHighResolutionTicks();
+        getSynth().renderNextBlock (buffer, midi, 0, numSamples);
+        const auto elapsedTicks = Time::getHighResolutionTicks() - startTicks;
+
+        totalRenderTicks += elapsedTicks;
+        totalSamplesRendered += numSamples;
+    }
+
+    MPESynthesiser& getSynth() noexcept     { return usingVoiceBank ? bankedSynth : plainSynth; }
+
+    // Spreads the notes over all 16 channels, so that each one can be modulated separately
+    static int getChannel (int index) noexcept      { return 1 + index % 16; }
+    static int getNoteNumber (int index) noexcept   { return 36 + (index % 16) * 3 + index / 16; }
+
+    //==============================================================================
+    void timerCallback() override
+    {
+        const auto ticks   = totalRenderTicks.exchange (0);
+        const auto samples = totalSamplesRendered.exchange (0);
+
+        auto* device = audioDeviceManager.getCurrentAudioDevice();
+
+        if (samples == 0 || device == nullptr)
+            return;
+
+        const auto renderSeconds = Time::highResolutionTicksToSeconds (ticks);
+        const auto audioSeconds  = (double) samples / device->getCurrentSampleRate();
+
+        timingLabel.setText ("Rendering " + String ((int) numNotesSlider.getValue()) + " voices "
+                               + (useVoiceBankButton.getToggleState() ? "in a voice bank, " : "one at a time, ")
+                               + String (SineVoiceBank::numLanes) + " lanes per SIMD register\n"
+                               + "Render time: " + String (100.0 * renderSeconds / audioSeconds, 2) + "% of real time",
+                             dontSendNotification);
+    }
+
+    //==============================================================================
+    // if this PIP is running inside the demo runner, we'll use the shared device manager instead
+   #ifndef JUCE_DEMO_RUNNER
+    AudioDeviceManager audioDeviceManager;
+   #else
+    AudioDeviceManager& audioDeviceManager { getSharedAudioDeviceManager (0, 2) };
+   #endif
+
+    static constexpr int maxNumNotes = 256;
+
+    SineVoiceBank voiceBank;
+    MPESynthesiser bankedSynth, plainSynth;
+    MidiBuffer midi;
+
+    std::atomic<int> requestedNumNotes { 0 };
+    std::atomic<bool> shouldUseVoiceBank { true };
+    bool usingVoiceBank = true;
+    int numNotesPlaying = 0;
+
+    std::atomic<int64> totalRenderTicks { 0 }, totalSamplesRendered { 0 };
+
+    Label numNotesLabel { {}, "Number of notes:" };
+    Slider numNotesSlider { Slider::LinearHorizontal, Slider::TextBoxRight };
+    ToggleButton useVoiceBankButton { "Render the voices together in a SIMD voice bank" };
+    Label timingLabel;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MPEVoiceBankDemo)
+};
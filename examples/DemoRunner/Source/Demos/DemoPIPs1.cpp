@@ -47,6 +47,9 @@
 #include "../../../DSP/FIRFilterDemo.h"
 #include "../../../DSP/GainDemo.h"
 #include "../../../DSP/IIRFilterDemo.h"
+#if JUCE_USE_SIMD
+ #include "../../../DSP/MPEVoiceBankDemo.h"
+#endif
 #include "../../../DSP/OscillatorDemo.h"
 #include "../../../DSP/OverdriveDemo.h"
 #if JUCE_USE_SIMD
@@ -86,6 +89,9 @@ void registerDemos_One() noexcept
     REGISTER_DEMO (FIRFilterDemo,           DSP,       false)
     REGISTER_DEMO (GainDemo,                DSP,       false)
     REGISTER_DEMO (IIRFilterDemo,           DSP,       false)
+   #if JUCE_USE_SIMD
+    REGISTER_DEMO (MPEVoiceBankDemo,        DSP,       false)
+   #endif
     REGISTER_DEMO (OscillatorDemo,          DSP,       false)
     REGISTER_DEMO (OverdriveDemo,           DSP,       false)
    #if JUCE_USE_SIMD
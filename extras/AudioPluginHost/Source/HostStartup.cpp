@@ -31,102 +31,6 @@
  #error "If you're building the audio plugin host, you probably want to enable VST and/or AU support"
 #endif
 
-class PluginScannerSubprocess final : private ChildProcessWorker,
-                                      private AsyncUpdater
-{
-public:
-    PluginScannerSubprocess()
-    {
-        formatManager.addDefaultFormats();
-    }
-
-    using ChildProcessWorker::initialiseFromCommandLine;
-
-private:
-    void handleMessageFromCoordinator (const MemoryBlock& mb) override
-    {
-        if (mb.isEmpty())
-            return;
-
-        const std::lock_guard<std::mutex> lock (mutex);
-
-        if (const auto results = doScan (mb); ! results.isEmpty())
-        {
-            sendResults (results);
-        }
-        else
-        {
-            pendingBlocks.emplace (mb);
-            triggerAsyncUpdate();
-        }
-    }
-
-    void handleConnectionLost() override
-    {
-        JUCEApplicationBase::quit();
-    }
-
-    void handleAsyncUpdate() override
-    {
-        for (;;)
-        {
-            const std::lock_guard<std::mutex> lock (mutex);
-
-            if (pendingBlocks.empty())
-                return;
-
-            sendResults (doScan (pendingBlocks.front()));
-            pendingBlocks.pop();
-        }
-    }
-
-    OwnedArray<PluginDescription> doScan (const MemoryBlock& block)
-    {
-        MemoryInputStream stream { block, false };
-        const auto formatName = stream.readString();
-        const auto identifier = stream.readString();
-
-        PluginDescription pd;
-        pd.fileOrIdentifier = identifier;
-        pd.uniqueId = pd.deprecatedUid = 0;
-
-        const auto matchingFormat = [&]() -> AudioPluginFormat*
-        {
-            for (auto* format : formatManager.getFormats())
-                if (format->getName() == formatName)
-                    return format;
-
-            return nullptr;
-        }();
-
-        OwnedArray<PluginDescription> results;
-
-        if (matchingFormat != nullptr
-            && (MessageManager::getInstance()->isThisTheMessageThread()
-                || matchingFormat->requiresUnblockedMessageThreadDuringCreation (pd)))
-        {
-            matchingFormat->findAllTypesForFile (results, identifier);
-        }
-
-        return results;
-    }
-
-    void sendResults (const OwnedArray<PluginDescription>& results)
-    {
-        XmlElement xml ("LIST");
-
-        for (const auto& desc : results)
-            xml.addChildElement (desc->createXml().release());
-
-        const auto str = xml.toString();
-        sendMessageToCoordinator ({ str.toRawUTF8(), str.getNumBytesAsUTF8() });
-    }
-
-    std::mutex mutex;
-    std::queue<MemoryBlock> pendingBlocks;
-    AudioPluginFormatManager formatManager;
-};
-
 //==============================================================================
 class PluginHostApp final : public JUCEApplication,
                             private AsyncUpdater
@@ -136,7 +40,7 @@ public:
 
     void initialise (const String& commandLine) override
     {
-        auto scannerSubprocess = std::make_unique<PluginScannerSubprocess>();
+        auto scannerSubprocess = std::make_unique<PluginScannerWorkerProcess>();
 
         if (scannerSubprocess->initialiseFromCommandLine (commandLine, processUID))
         {
@@ -244,7 +148,7 @@ public:
 
 private:
     std::unique_ptr<MainHostWindow> mainWindow;
-    std::unique_ptr<PluginScannerSubprocess> storedScannerSubprocess;
+    std::unique_ptr<PluginScannerWorkerProcess> storedScannerSubprocess;
 };
 
 static PluginHostApp& getApp()                    { return *dynamic_cast<PluginHostApp*> (JUCEApplication::getInstance()); }
@@ -288,14 +288,33 @@ struct GraphEditorPanel::PluginComponent final : public Component,
         if (isBypassed)
             boxColour = boxColour.brighter();
 
+        if (timings.has_value())
+            boxColour = boxColour.interpolatedWith (Colours::red, (float) jlimit (0.0, 1.0, load) * 0.8f);
+
         g.setColour (boxColour);
         g.fillRect (boxArea.toFloat());
 
         g.setColour (findColour (TextEditor::textColourId));
+
+        if (timings.has_value())
+        {
+            g.setFont (font.withHeight (10.0f));
+            g.drawFittedText (String (timings->meanSeconds * 1000.0, 2) + " / "
+                                + String (timings->p99Seconds * 1000.0, 2) + " ms",
+                              boxArea.removeFromBottom (12), Justification::centred, 1);
+        }
+
         g.setFont (font);
         g.drawFittedText (getName(), boxArea, Justification::centred, 2);
     }
 
+    void setTimings (std::optional<AudioProcessorGraph::NodeTimings> newTimings, double blockSeconds)
+    {
+        timings = newTimings;
+        load = (timings.has_value() && blockSeconds > 0.0) ? timings->p99Seconds / blockSeconds : 0.0;
+        repaint();
+    }
+
     void resized() override
     {
         if (auto f = graph.graph.getNodeForId (pluginID))
@@ -546,6 +565,8 @@ struct GraphEditorPanel::PluginComponent final : public Component,
     Point<int> originalPos;
     Font font { 13.0f, Font::bold };
     int numIns = 0, numOuts = 0;
+    std::optional<AudioProcessorGraph::NodeTimings> timings;
+    double load = 0.0;
     DropShadowEffect shadow;
     std::unique_ptr<PopupMenu> menu;
     std::unique_ptr<FileChooser> fileChooser;
@@ -1000,6 +1021,40 @@ void GraphEditorPanel::timerCallback()
     showPopupMenu (originalTouchPos);
 }
 
+void GraphEditorPanel::setShowNodeTimings (bool shouldShow)
+{
+    graph.graph.setNodeProfilingEnabled (shouldShow);
+    graph.graph.resetNodeTimings();
+
+    if (shouldShow)
+    {
+        nodeTimingsUpdater.startTimer (500);
+        return;
+    }
+
+    nodeTimingsUpdater.stopTimer();
+
+    for (auto* node : nodes)
+        node->setTimings (std::nullopt, 0.0);
+}
+
+void GraphEditorPanel::updateNodeTimings()
+{
+    const auto timings = graph.graph.getNodeTimings();
+    const auto sampleRate = graph.graph.getSampleRate();
+    const auto blockSeconds = sampleRate > 0.0 ? graph.graph.getBlockSize() / sampleRate : 0.0;
+
+    for (auto* node : nodes)
+    {
+        const auto iter = std::find_if (timings.begin(), timings.end(), [&] (const auto& t) { return t.nodeID == node->pluginID; });
+
+        if (iter != timings.end())
+            node->setTimings (*iter, blockSeconds);
+        else
+            node->setTimings (std::nullopt, blockSeconds);
+    }
+}
+
 //==============================================================================
 struct GraphDocumentComponent::TooltipBar final : public Component,
                                                   private Timer
@@ -1375,6 +1430,11 @@ void GraphDocumentComponent::setDoublePrecision (bool doublePrecision)
     graphPlayer.setDoublePrecisionProcessing (doublePrecision);
 }
 
+void GraphDocumentComponent::setShowNodeTimings (bool shouldShow)
+{
+    graphPanel->setShowNodeTimings (shouldShow);
+}
+
 bool GraphDocumentComponent::closeAnyOpenPluginWindows()
 {
     return graphPanel->graph.closeAnyOpenPluginWindows();
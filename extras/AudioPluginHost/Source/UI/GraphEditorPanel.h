@@ -56,6 +56,9 @@ public:
     //==============================================================================
     void updateComponents();
 
+    /** Turns per-node profiling on or off, and shows each node's processing load. */
+    void setShowNodeTimings (bool shouldShow);
+
     //==============================================================================
     void showPopupMenu (Point<int> position);
 
@@ -88,6 +91,11 @@ private:
 
     void timerCallback() override;
 
+    //==============================================================================
+    TimedCallback nodeTimingsUpdater { [this] { updateNodeTimings(); } };
+
+    void updateNodeTimings();
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GraphEditorPanel)
 };
 
@@ -113,6 +121,7 @@ public:
     //==============================================================================
     void createNewPlugin (const PluginDescriptionAndPreference&, Point<int> position);
     void setDoublePrecision (bool doublePrecision);
+    void setShowNodeTimings (bool shouldShow);
     bool closeAnyOpenPluginWindows();
 
     //==============================================================================
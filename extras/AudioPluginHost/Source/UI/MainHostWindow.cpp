@@ -29,70 +29,6 @@
 
 constexpr const char* scanModeKey = "pluginScanMode";
 
-//==============================================================================
-class Superprocess final : private ChildProcessCoordinator
-{
-public:
-    Superprocess()
-    {
-        launchWorkerProcess (File::getSpecialLocation (File::currentExecutableFile), processUID, 0, 0);
-    }
-
-    enum class State
-    {
-        timeout,
-        gotResult,
-        connectionLost,
-    };
-
-    struct Response
-    {
-        State state;
-        std::unique_ptr<XmlElement> xml;
-    };
-
-    Response getResponse()
-    {
-        std::unique_lock<std::mutex> lock { mutex };
-
-        if (! condvar.wait_for (lock, std::chrono::milliseconds { 50 }, [&] { return gotResult || connectionLost; }))
-            return { State::timeout, nullptr };
-
-        const auto state = connectionLost ? State::connectionLost : State::gotResult;
-        connectionLost = false;
-        gotResult = false;
-
-        return { state, std::move (pluginDescription) };
-    }
-
-    using ChildProcessCoordinator::sendMessageToWorker;
-
-private:
-    void handleMessageFromWorker (const MemoryBlock& mb) override
-    {
-        const std::lock_guard<std::mutex> lock { mutex };
-        pluginDescription = parseXML (mb.toString());
-        gotResult = true;
-        condvar.notify_one();
-    }
-
-    void handleConnectionLost() override
-    {
-        const std::lock_guard<std::mutex> lock { mutex };
-        connectionLost = true;
-        condvar.notify_one();
-    }
-
-    std::mutex mutex;
-    std::condition_variable condvar;
-
-    std::unique_ptr<XmlElement> pluginDescription;
-    bool connectionLost = false;
-    bool gotResult = false;
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Superprocess)
-};
-
 //==============================================================================
 class CustomPluginScanner final : public KnownPluginList::CustomScanner,
                                   private ChangeListener
@@ -118,71 +54,19 @@ public:
     {
         if (scanInProcess)
         {
-            superprocess = nullptr;
             format.findAllTypesForFile (result, fileOrIdentifier);
             return true;
         }
 
-        if (addPluginDescriptions (format.getName(), fileOrIdentifier, result))
-            return true;
-
-        superprocess = nullptr;
-        return false;
+        return outOfProcessScanner.findPluginTypesFor (format, result, fileOrIdentifier);
     }
 
     void scanFinished() override
     {
-        superprocess = nullptr;
+        outOfProcessScanner.scanFinished();
     }
 
 private:
-    /*  Scans for a plugin with format 'formatName' and ID 'fileOrIdentifier' using a subprocess,
-        and adds discovered plugin descriptions to 'result'.
-
-        Returns true on success.
-
-        Failure indicates that the subprocess is unrecoverable and should be terminated.
-    */
-    bool addPluginDescriptions (const String& formatName,
-                                const String& fileOrIdentifier,
-                                OwnedArray<PluginDescription>& result)
-    {
-        if (superprocess == nullptr)
-            superprocess = std::make_unique<Superprocess>();
-
-        MemoryBlock block;
-        MemoryOutputStream stream { block, true };
-        stream.writeString (formatName);
-        stream.writeString (fileOrIdentifier);
-
-        if (! superprocess->sendMessageToWorker (block))
-            return false;
-
-        for (;;)
-        {
-            if (shouldExit())
-                return true;
-
-            const auto response = superprocess->getResponse();
-
-            if (response.state == Superprocess::State::timeout)
-                continue;
-
-            if (response.xml != nullptr)
-            {
-                for (const auto* item : response.xml->getChildIterator())
-                {
-                    auto desc = std::make_unique<PluginDescription>();
-
-                    if (desc->loadFromXml (*item))
-                        result.add (std::move (desc));
-                }
-            }
-
-            return (response.state == Superprocess::State::gotResult);
-        }
-    }
-
     void handleChange()
     {
         if (auto* file = getAppProperties().getUserSettings())
@@ -194,7 +78,7 @@ private:
         handleChange();
     }
 
-    std::unique_ptr<Superprocess> superprocess;
+    OutOfProcessPluginScanner outOfProcessScanner { File::getSpecialLocation (File::currentExecutableFile), processUID };
 
     std::atomic<bool> scanInProcess { true };
 
@@ -210,7 +94,8 @@ public:
                                const File& pedal,
                                PropertiesFile* props,
                                bool async)
-        : PluginListComponent (manager, listToRepresent, pedal, props, async)
+        : PluginListComponent (manager, listToRepresent, pedal, props, async),
+          allowAsync (async)
     {
         addAndMakeVisible (validationModeLabel);
         addAndMakeVisible (validationModeBox);
@@ -229,8 +114,10 @@ public:
         validationModeBox.onChange = [this]
         {
             getAppProperties().getUserSettings()->setValue (scanModeKey, validationModeBox.getSelectedItemIndex());
+            updateNumberOfScanningThreads();
         };
 
+        updateNumberOfScanningThreads();
         handleResize();
     }
 
@@ -248,9 +135,16 @@ private:
         validationModeBox.setBounds (buttonBounds.withWidth (130).withRightX (getWidth() - buttonBounds.getX()));
     }
 
+    void updateNumberOfScanningThreads()
+    {
+        // Out-of-process scans can safely run in parallel, one thread per worker process
+        const auto outOfProcess = validationModeBox.getSelectedItemIndex() == 1;
+        setNumberOfThreadsForScanning (outOfProcess ? SystemStats::getNumCpus() : (allowAsync ? 1 : 0));
+    }
 
     Label validationModeLabel { {}, "Scan mode" };
     ComboBox validationModeBox;
+    const bool allowAsync;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CustomPluginListComponent)
 };
@@ -328,6 +222,8 @@ MainHostWindow::MainHostWindow()
 
     graphHolder.reset (new GraphDocumentComponent (formatManager, deviceManager, knownPluginList));
 
+    graphHolder->setShowNodeTimings (isNodeTimingsOverlayEnabled());
+
     setContentNonOwned (graphHolder.get(), false);
 
     setUsingNativeTitleBar (true);
@@ -552,6 +448,7 @@ PopupMenu MainHostWindow::getMenuForIndex (int topLevelMenuIndex, const String&
         menu.addSeparator();
         menu.addCommandItem (&getCommandManager(), CommandIDs::showAudioSettings);
         menu.addCommandItem (&getCommandManager(), CommandIDs::toggleDoublePrecision);
+        menu.addCommandItem (&getCommandManager(), CommandIDs::showNodeTimings);
 
         if (autoScaleOptionAvailable)
             menu.addCommandItem (&getCommandManager(), CommandIDs::autoScalePluginWindows);
@@ -744,7 +641,8 @@ void MainHostWindow::getAllCommands (Array<CommandID>& commands)
                               CommandIDs::toggleDoublePrecision,
                               CommandIDs::aboutBox,
                               CommandIDs::allWindowsForward,
-                              CommandIDs::autoScalePluginWindows
+                              CommandIDs::autoScalePluginWindows,
+                              CommandIDs::showNodeTimings
                             };
 
     commands.addArray (ids, numElementsInArray (ids));
@@ -807,6 +705,10 @@ void MainHostWindow::getCommandInfo (const CommandID commandID, ApplicationComma
         updateAutoScaleMenuItem (result);
         break;
 
+    case CommandIDs::showNodeTimings:
+        updateNodeTimingsMenuItem (result);
+        break;
+
     default:
         break;
     }
@@ -896,6 +798,21 @@ bool MainHostWindow::perform (const InvocationInfo& info)
         }
         break;
 
+    case CommandIDs::showNodeTimings:
+        if (auto* props = getAppProperties().getUserSettings())
+        {
+            auto newShowTimings = ! isNodeTimingsOverlayEnabled();
+            props->setValue ("showNodeTimings", var (newShowTimings));
+
+            ApplicationCommandInfo cmdInfo (info.commandID);
+            updateNodeTimingsMenuItem (cmdInfo);
+            menuItemsChanged();
+
+            if (graphHolder != nullptr)
+                graphHolder->setShowNodeTimings (newShowTimings);
+        }
+        break;
+
     case CommandIDs::aboutBox:
         // TODO
         break;
@@ -1024,6 +941,14 @@ bool MainHostWindow::isAutoScalePluginWindowsEnabled()
     return false;
 }
 
+bool MainHostWindow::isNodeTimingsOverlayEnabled()
+{
+    if (auto* props = getAppProperties().getUserSettings())
+        return props->getBoolValue ("showNodeTimings", false);
+
+    return false;
+}
+
 void MainHostWindow::updatePrecisionMenuItem (ApplicationCommandInfo& info)
 {
     info.setInfo ("Double Floating-Point Precision Rendering", {}, "General", 0);
@@ -1035,3 +960,9 @@ void MainHostWindow::updateAutoScaleMenuItem (ApplicationCommandInfo& info)
     info.setInfo ("Auto-Scale Plug-in Windows", {}, "General", 0);
     info.setTicked (isAutoScalePluginWindowsEnabled());
 }
+
+void MainHostWindow::updateNodeTimingsMenuItem (ApplicationCommandInfo& info)
+{
+    info.setInfo ("Show Plug-in Processing Load", "Profiles each node in the graph and shades it by its CPU load", "General", 0);
+    info.setTicked (isNodeTimingsOverlayEnabled());
+}
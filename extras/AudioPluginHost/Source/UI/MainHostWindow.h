@@ -44,6 +44,7 @@ namespace CommandIDs
     static const int allWindowsForward      = 0x30400;
     static const int toggleDoublePrecision  = 0x30500;
     static const int autoScalePluginWindows = 0x30600;
+    static const int showNodeTimings        = 0x30700;
 }
 
 //==============================================================================
@@ -118,9 +119,11 @@ private:
     //==============================================================================
     static bool isDoublePrecisionProcessingEnabled();
     static bool isAutoScalePluginWindowsEnabled();
+    static bool isNodeTimingsOverlayEnabled();
 
     static void updatePrecisionMenuItem (ApplicationCommandInfo& info);
     static void updateAutoScaleMenuItem (ApplicationCommandInfo& info);
+    static void updateNodeTimingsMenuItem (ApplicationCommandInfo& info);
 
     void showAudioSettings();
 
@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+
+//==============================================================================
+class AudioDataBenchmark final : public Benchmark
+{
+public:
+    AudioDataBenchmark() : Benchmark ("AudioData", "Audio") {}
+
+    void run() override
+    {
+        measureConversions<AudioData::Int16>   ("Int16");
+        measureConversions<AudioData::Int24>   ("Int24");
+        measureConversions<AudioData::Int32>   ("Int32");
+        measureConversions<AudioData::Float32> ("Float32");
+
+        for (const auto numChannels : { 2, 4, 8 })
+        {
+            measureInterleaving<AudioData::Int16>   ("Int16",   numChannels);
+            measureInterleaving<AudioData::Int24>   ("Int24",   numChannels);
+            measureInterleaving<AudioData::Float32> ("Float32", numChannels);
+        }
+    }
+
+private:
+    static constexpr int numSamples = 4096;
+
+    template <typename SampleFormat>
+    using NativeFormat = AudioData::Format<SampleFormat, AudioData::LittleEndian>;
+
+    void logThroughput (const String& description, double nanoseconds, int numValues) const
+    {
+        logResult (description, numValues * 1.0e3 / nanoseconds, "Msamples/s");
+    }
+
+    template <typename SampleFormat>
+    void measureConversions (const String& formatName)
+    {
+        using FloatSource  = AudioData::Pointer<AudioData::Float32, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::Const>;
+        using FloatDest    = AudioData::Pointer<AudioData::Float32, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::NonConst>;
+        using PackedSource = AudioData::Pointer<SampleFormat, AudioData::LittleEndian, AudioData::NonInterleaved, AudioData::Const>;
+        using PackedDest   = AudioData::Pointer<SampleFormat, AudioData::LittleEndian, AudioData::NonInterleaved, AudioData::NonConst>;
+
+        const auto noise = makeNoise (1, numSamples);
+        HeapBlock<char> packed ((size_t) (numSamples * SampleFormat::bytesPerSample));
+        HeapBlock<float> floats (numSamples);
+
+        AudioData::ConverterInstance<FloatSource, PackedDest> toPacked;
+        AudioData::ConverterInstance<PackedSource, FloatDest> toFloat;
+
+        logThroughput ("float to " + formatName,
+                       measureNanosecondsPerCall ([&] { toPacked.convertSamples (packed, noise.getReadPointer (0), numSamples); }),
+                       numSamples);
+
+        logThroughput (formatName + " to float",
+                       measureNanosecondsPerCall ([&] { toFloat.convertSamples (floats, packed, numSamples); }),
+                       numSamples);
+    }
+
+    template <typename SampleFormat>
+    void measureInterleaving (const String& formatName, int numChannels)
+    {
+        const auto noise = makeNoise (numChannels, numSamples);
+        AudioBuffer<float> deinterleaved (numChannels, numSamples);
+        using ElementType = std::remove_pointer_t<decltype (SampleFormat::data)>;
+        HeapBlock<ElementType> interleaved ((size_t) (numChannels * numSamples * SampleFormat::bytesPerSample) / sizeof (ElementType));
+
+        using FloatFormat = AudioData::Format<AudioData::Float32, AudioData::NativeEndian>;
+
+        const auto suffix = " (" + String (numChannels) + " channels)";
+
+        logThroughput ("interleave float to " + formatName + suffix,
+                       measureNanosecondsPerCall ([&]
+                       {
+                           AudioData::interleaveSamples (AudioData::NonInterleavedSource<FloatFormat> { noise.getArrayOfReadPointers(), numChannels },
+                                                         AudioData::InterleavedDest<NativeFormat<SampleFormat>> { interleaved.get(), numChannels },
+                                                         numSamples);
+                       }),
+                       numChannels * numSamples);
+
+        logThroughput ("deinterleave " + formatName + " to float" + suffix,
+                       measureNanosecondsPerCall ([&]
+                       {
+                           AudioData::deinterleaveSamples (AudioData::InterleavedSource<NativeFormat<SampleFormat>> { interleaved.get(), numChannels },
+                                                           AudioData::NonInterleavedDest<FloatFormat> { deinterleaved.getArrayOfWritePointers(), numChannels },
+                                                           numSamples);
+                       }),
+                       numChannels * numSamples);
+    }
+};
+
+static AudioDataBenchmark audioDataBenchmark;
@@ -0,0 +1,215 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+
+//==============================================================================
+class AudioProcessorGraphBenchmark final : public Benchmark
+{
+public:
+    AudioProcessorGraphBenchmark() : Benchmark ("AudioProcessorGraph", "Audio") {}
+
+    void run() override
+    {
+        for (const auto numNodes : { 10, 100, 1000 })
+            measureRebuilds (numNodes);
+
+        for (const auto numTracks : { 8, 64, 256 })
+            measureMixing (numTracks);
+    }
+
+private:
+    using Graph = AudioProcessorGraph;
+    using NodeID = Graph::NodeID;
+
+    static constexpr int chainLength = 10;
+    static constexpr int numChannels = 2;
+
+    class PassThroughProcessor final : public AudioProcessor
+    {
+    public:
+        PassThroughProcessor()
+            : AudioProcessor (BusesProperties().withInput  ("in",  AudioChannelSet::stereo())
+                                               .withOutput ("out", AudioChannelSet::stereo())) {}
+
+        const String getName() const override                         { return "Pass Through"; }
+        double getTailLengthSeconds() const override                  { return {}; }
+        bool acceptsMidi() const override                             { return false; }
+        bool producesMidi() const override                            { return false; }
+        AudioProcessorEditor* createEditor() override                 { return {}; }
+        bool hasEditor() const override                               { return {}; }
+        int getNumPrograms() override                                 { return 1; }
+        int getCurrentProgram() override                              { return {}; }
+        void setCurrentProgram (int) override                         {}
+        const String getProgramName (int) override                    { return {}; }
+        void changeProgramName (int, const String&) override          {}
+        void getStateInformation (juce::MemoryBlock&) override        {}
+        void setStateInformation (const void*, int) override          {}
+        void prepareToPlay (double, int) override                     {}
+        void releaseResources() override                              {}
+        void processBlock (AudioBuffer<float>&, MidiBuffer&) override {}
+
+        using AudioProcessor::processBlock;
+    };
+
+    /*  Connects every output channel of the source to the matching input of the destination. */
+    static void connect (Graph& graph, NodeID source, NodeID destination)
+    {
+        for (auto channel = 0; channel < numChannels; ++channel)
+            graph.addConnection ({ { source, channel }, { destination, channel } });
+    }
+
+    static void disconnect (Graph& graph, NodeID source, NodeID destination)
+    {
+        for (auto channel = 0; channel < numChannels; ++channel)
+            graph.removeConnection ({ { source, channel }, { destination, channel } });
+    }
+
+    /*  Builds a session-like graph, where several chains of processors are mixed to the output. */
+    void measureRebuilds (int numNodes)
+    {
+        using IOProcessor = Graph::AudioGraphIOProcessor;
+
+        Graph graph;
+        graph.setPlayConfigDetails (numChannels, numChannels, 44100.0, 512);
+
+        const auto input  = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioInputNode),  {}, Graph::UpdateKind::none)->nodeID;
+        const auto output = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioOutputNode), {}, Graph::UpdateKind::none)->nodeID;
+
+        std::vector<std::vector<NodeID>> chains;
+
+        for (auto i = 0; i < numNodes; ++i)
+        {
+            if (i % chainLength == 0)
+                chains.emplace_back();
+
+            chains.back().push_back (graph.addNode (std::make_unique<PassThroughProcessor>(), {}, Graph::UpdateKind::none)->nodeID);
+        }
+
+        const auto getLinks = [&] (const std::vector<NodeID>& chain)
+        {
+            std::vector<std::pair<NodeID, NodeID>> links { { input, chain.front() }, { chain.back(), output } };
+
+            for (size_t i = 1; i < chain.size(); ++i)
+                links.emplace_back (chain[i - 1], chain[i]);
+
+            return links;
+        };
+
+        for (const auto& chain : chains)
+            for (const auto& [source, destination] : getLinks (chain))
+                connect (graph, source, destination);
+
+        graph.prepareToPlay (44100.0, 512);
+
+        const auto suffix = " (" + String (numNodes) + " nodes)";
+        const auto& chain = chains[chains.size() / 2];
+        const auto links = getLinks (chain);
+        const auto [middleSource, middleDestination] = links.back();
+
+        // Breaking and remaking a single link rebuilds the render sequence twice
+        logResult ("single edit" + suffix,
+                   measureNanosecondsPerCall ([&]
+                   {
+                       disconnect (graph, middleSource, middleDestination);
+                       connect (graph, middleSource, middleDestination);
+                   }) * 0.5e-6,
+                   "ms");
+
+        // Each call alternately disconnects and reconnects a whole chain
+        auto isConnected = true;
+
+        const auto toggleChain = [&]
+        {
+            for (const auto& [source, destination] : links)
+            {
+                if (isConnected)
+                    disconnect (graph, source, destination);
+                else
+                    connect (graph, source, destination);
+            }
+
+            isConnected = ! isConnected;
+        };
+
+        logResult ("rewire chain, unbatched" + suffix,
+                   measureNanosecondsPerCall ([&] { toggleChain(); }) * 1.0e-6,
+                   "ms");
+
+        logResult ("rewire chain, batched" + suffix,
+                   measureNanosecondsPerCall ([&]
+                   {
+                       const Graph::ScopedBatchedUpdate batch (graph);
+                       toggleChain();
+                   }) * 1.0e-6,
+                   "ms");
+
+        graph.releaseResources();
+    }
+
+    /*  Builds a mixer-like graph, where many tracks with different latencies are summed to
+        the output, and measures the time taken to render a block.
+    */
+    void measureMixing (int numTracks)
+    {
+        using IOProcessor = Graph::AudioGraphIOProcessor;
+
+        constexpr auto blockSize = 512;
+
+        Graph graph;
+        graph.setPlayConfigDetails (numChannels, numChannels, 44100.0, blockSize);
+
+        const auto input  = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioInputNode),  {}, Graph::UpdateKind::none)->nodeID;
+        const auto output = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioOutputNode), {}, Graph::UpdateKind::none)->nodeID;
+
+        for (auto i = 0; i < numTracks; ++i)
+        {
+            auto processor = std::make_unique<PassThroughProcessor>();
+            processor->setLatencySamples ((i * 97) % 1024);
+
+            const auto track = graph.addNode (std::move (processor), {}, Graph::UpdateKind::none)->nodeID;
+            connect (graph, input, track);
+            connect (graph, track, output);
+        }
+
+        graph.prepareToPlay (44100.0, blockSize);
+
+        AudioBuffer<float> buffer (numChannels, blockSize);
+        MidiBuffer midi;
+        Random random;
+
+        for (auto channel = 0; channel < numChannels; ++channel)
+            for (auto i = 0; i < blockSize; ++i)
+                buffer.setSample (channel, i, random.nextFloat() * 2.0f - 1.0f);
+
+        logResult ("render block, mixed latencies (" + String (numTracks) + " tracks)",
+                   measureNanosecondsPerCall ([&] { graph.processBlock (buffer, midi); }) * 1.0e-3,
+                   "us");
+
+        graph.releaseResources();
+    }
+};
+
+static AudioProcessorGraphBenchmark audioProcessorGraphBenchmark;
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Base class for a group of related performance measurements.
+
+    To register a benchmark, create a static instance of a subclass, in the
+    same way as a UnitTest.
+*/
+class Benchmark
+{
+public:
+    Benchmark (const String& nameIn, const String& categoryIn)
+        : name (nameIn), category (categoryIn)
+    {
+        getAllBenchmarks().add (this);
+    }
+
+    virtual ~Benchmark()
+    {
+        getAllBenchmarks().removeFirstMatchingValue (this);
+    }
+
+    /** Runs all the measurements in this benchmark, reporting each result with logResult(). */
+    virtual void run() = 0;
+
+    const String& getName() const noexcept       { return name; }
+    const String& getCategory() const noexcept   { return category; }
+
+    static Array<Benchmark*>& getAllBenchmarks()
+    {
+        static Array<Benchmark*> benchmarks;
+        return benchmarks;
+    }
+
+protected:
+    /** Repeatedly calls the function for at least the given duration, and returns the
+        mean time taken by each call in nanoseconds.
+
+        The function is called a few times before timing starts, to warm up caches and
+        any background threads.
+    */
+    template <typename Fn>
+    static double measureNanosecondsPerCall (Fn&& fn, double minimumSeconds = 0.25)
+    {
+        for (auto i = 0; i < 8; ++i)
+            fn();
+
+        int64 numCalls = 0;
+        const auto start = Time::getHighResolutionTicks();
+        const auto minimumTicks = Time::secondsToHighResolutionTicks (minimumSeconds);
+
+        for (auto now = start; now - start < minimumTicks; now = Time::getHighResolutionTicks())
+        {
+            for (auto i = 0; i < 16; ++i)
+                fn();
+
+            numCalls += 16;
+        }
+
+        const auto elapsed = Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - start);
+        return elapsed * 1.0e9 / (double) numCalls;
+    }
+
+    /** Writes a single result line to the log. */
+    void logResult (const String& description, double value, const String& units) const
+    {
+        Logger::writeToLog (name.paddedRight (' ', 24) + " "
+                            + description.paddedRight (' ', 48) + " "
+                            + String (value, 2).paddedLeft (' ', 12) + " " + units);
+    }
+
+    /** Returns a buffer filled with uniformly distributed noise in the range -1 to 1. */
+    static AudioBuffer<float> makeNoise (int numChannels, int numSamples, int64 seed = 0x1234)
+    {
+        Random random (seed);
+        AudioBuffer<float> result (numChannels, numSamples);
+
+        for (auto channel = 0; channel < numChannels; ++channel)
+            for (auto sample = 0; sample < numSamples; ++sample)
+                result.setSample (channel, sample, random.nextFloat() * 2.0f - 1.0f);
+
+        return result;
+    }
+
+private:
+    const String name, category;
+
+    JUCE_DECLARE_NON_COPYABLE (Benchmark)
+};
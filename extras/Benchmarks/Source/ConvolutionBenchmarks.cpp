@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+
+//==============================================================================
+class ConvolutionBenchmark final : public Benchmark
+{
+public:
+    ConvolutionBenchmark() : Benchmark ("Convolution", "DSP") {}
+
+    void run() override
+    {
+        constexpr auto sampleRate = 48000.0;
+        constexpr auto blockSize = 64;
+
+        const dsp::ProcessSpec spec { sampleRate, (uint32) blockSize, 2 };
+
+        const auto input = makeNoise (2, blockSize);
+        AudioBuffer<float> output (2, blockSize);
+
+        for (const auto irSeconds : { 0.5, 2.0, 8.0 })
+        {
+            const auto ir = makeNoise (2, roundToInt (irSeconds * sampleRate));
+
+            const auto measure = [&] (const String& description, auto config)
+            {
+                dsp::Convolution convolution (config);
+
+                auto copy = ir;
+                convolution.loadImpulseResponse (std::move (copy),
+                                                 sampleRate,
+                                                 dsp::Convolution::Stereo::yes,
+                                                 dsp::Convolution::Trim::no,
+                                                 dsp::Convolution::Normalise::yes);
+                convolution.prepare (spec);
+
+                const dsp::AudioBlock<const float> inputBlock (input);
+                dsp::AudioBlock<float> outputBlock (output);
+                const dsp::ProcessContextNonReplacing<float> context (inputBlock, outputBlock);
+
+                const auto nanoseconds = measureNanosecondsPerCall ([&] { convolution.process (context); }, 1.0);
+
+                logResult (String (irSeconds, 1) + " s IR, " + description,
+                           nanoseconds * 1.0e-3,
+                           "us per block");
+            };
+
+            measure ("uniform",                      dsp::Convolution::Latency { 0 });
+            measure ("two-stage, head 1024",         dsp::Convolution::NonUniform { 1024 });
+            measure ("multi-stage, 256 to 8192",     dsp::Convolution::NonUniform { 256, 8192 });
+            measure ("multi-stage, 256 to 8192, bg", dsp::Convolution::NonUniform { 256, 8192, true });
+            measure ("multi-stage, 1024 to 16384",   dsp::Convolution::NonUniform { 1024, 16384 });
+        }
+    }
+};
+
+static ConvolutionBenchmark convolutionBenchmark;
@@ -0,0 +1,147 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+
+//==============================================================================
+class FFTBenchmark final : public Benchmark
+{
+public:
+    FFTBenchmark() : Benchmark ("FFT", "DSP") {}
+
+    void run() override
+    {
+        for (auto order = 6; order <= 16; ++order)
+        {
+            const dsp::FFT fft (order);
+            const auto size = fft.getSize();
+
+            const auto input = makeNoise (1, size * 2);
+            AudioBuffer<float> buffer (1, size * 2);
+
+            const auto realForward = measureNanosecondsPerCall ([&]
+            {
+                buffer.copyFrom (0, 0, input, 0, 0, size);
+                fft.performRealOnlyForwardTransform (buffer.getWritePointer (0), true);
+            });
+
+            const auto realInverse = measureNanosecondsPerCall ([&]
+            {
+                buffer.copyFrom (0, 0, input, 0, 0, size + 2);
+                fft.performRealOnlyInverseTransform (buffer.getWritePointer (0));
+            });
+
+            std::vector<dsp::Complex<float>> complexInput ((size_t) size), complexOutput ((size_t) size);
+
+            for (auto i = 0; i < size; ++i)
+                complexInput[(size_t) i] = { input.getSample (0, 2 * i), input.getSample (0, 2 * i + 1) };
+
+            const auto complexForward = measureNanosecondsPerCall ([&]
+            {
+                fft.perform (complexInput.data(), complexOutput.data(), false);
+            });
+
+            const auto prefix = "order " + String (order).paddedLeft (' ', 2) + ", ";
+
+            logResult (prefix + "real forward",    realForward,    "ns per transform");
+            logResult (prefix + "real inverse",    realInverse,    "ns per transform");
+            logResult (prefix + "complex forward", complexForward, "ns per transform");
+        }
+
+        runMultichannel();
+        runDoublePrecision();
+    }
+
+private:
+    template <typename FloatType>
+    double measureRealForward (const dsp::FFT& fft)
+    {
+        const auto size = (size_t) fft.getSize();
+        const auto noise = makeNoise (1, (int) size);
+
+        std::vector<FloatType> input (size * 2), buffer (size * 2);
+        std::copy (noise.getReadPointer (0), noise.getReadPointer (0) + size, input.begin());
+
+        return measureNanosecondsPerCall ([&]
+        {
+            std::copy (input.begin(), input.begin() + (ptrdiff_t) size, buffer.begin());
+            fft.performRealOnlyForwardTransform (buffer.data(), true);
+        });
+    }
+
+    void runDoublePrecision()
+    {
+        for (auto order : { 10, 16, 20 })
+        {
+            const dsp::FFT fft (order);
+
+            const auto prefix = "order " + String (order).paddedLeft (' ', 2) + ", real forward, ";
+
+            logResult (prefix + "float",  measureRealForward<float>  (fft), "ns per transform");
+            logResult (prefix + "double", measureRealForward<double> (fft), "ns per transform");
+        }
+    }
+
+    void runMultichannel()
+    {
+        constexpr auto numChannels = 16;
+
+        for (auto order : { 8, 10, 12 })
+        {
+            const dsp::FFT fft (order);
+            const auto size = fft.getSize();
+
+            const auto input = makeNoise (numChannels, size * 2);
+            AudioBuffer<float> buffer (numChannels, size * 2);
+
+            const auto copyInput = [&]
+            {
+                for (auto ch = 0; ch < numChannels; ++ch)
+                    buffer.copyFrom (ch, 0, input, ch, 0, size);
+            };
+
+            const auto oneAtATime = measureNanosecondsPerCall ([&]
+            {
+                copyInput();
+
+                for (auto ch = 0; ch < numChannels; ++ch)
+                    fft.performRealOnlyForwardTransform (buffer.getWritePointer (ch), true);
+            });
+
+            const auto batched = measureNanosecondsPerCall ([&]
+            {
+                copyInput();
+                fft.performRealOnlyForwardTransform (buffer.getArrayOfWritePointers(), numChannels, true);
+            });
+
+            const auto prefix = "order " + String (order).paddedLeft (' ', 2) + ", " + String (numChannels) + " channels, ";
+
+            logResult (prefix + "one at a time", oneAtATime, "ns per block");
+            logResult (prefix + "batched",       batched,    "ns per block");
+        }
+    }
+};
+
+static FFTBenchmark fftBenchmark;
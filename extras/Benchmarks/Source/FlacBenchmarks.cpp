@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#include "Benchmark.h"
+
+//==============================================================================
+class FlacBenchmark final : public Benchmark
+{
+public:
+    FlacBenchmark() : Benchmark ("Flac", "Audio") {}
+
+    void run() override
+    {
+        const auto source = makeNoise (2, numSeconds * sampleRate);
+
+        ThreadPool pool { ThreadPoolOptions{}.withNumberOfThreads (jmax (1, SystemStats::getNumCpus() - 1)) };
+
+        FlacAudioFormat sequentialFormat, parallelFormat;
+        parallelFormat.setThreadPool (&pool);
+
+        const auto suffix = " (" + String (numSeconds) + "s stereo, " + String (pool.getNumThreads()) + " pool threads)";
+
+        MemoryBlock encoded;
+
+        logResult ("encode, sequential" + suffix, measureNanosecondsPerCall ([&] { encoded = encode (sequentialFormat, source); }) * 1.0e-6, "ms");
+        logResult ("encode, parallel" + suffix,   measureNanosecondsPerCall ([&] { encoded = encode (parallelFormat, source); }) * 1.0e-6, "ms");
+
+        AudioBuffer<float> decoded (source.getNumChannels(), source.getNumSamples());
+
+        logResult ("decode, sequential" + suffix, measureNanosecondsPerCall ([&] { decode (sequentialFormat, encoded, decoded); }) * 1.0e-6, "ms");
+        logResult ("decode, parallel" + suffix,   measureNanosecondsPerCall ([&] { decode (parallelFormat, encoded, decoded); }) * 1.0e-6, "ms");
+    }
+
+private:
+    static constexpr int numSeconds = 30;
+    static constexpr int sampleRate = 44100;
+
+    static MemoryBlock encode (FlacAudioFormat& format, const AudioBuffer<float>& source)
+    {
+        MemoryBlock block;
+
+        {
+            std::unique_ptr<AudioFormatWriter> writer (format.createWriterFor (new MemoryOutputStream (block, false),
+                                                                               sampleRate, (unsigned int) source.getNumChannels(),
+                                                                               24, {}, 0));
+            writer->writeFromAudioSampleBuffer (source, 0, source.getNumSamples());
+        }
+
+        return block;
+    }
+
+    static void decode (FlacAudioFormat& format, const MemoryBlock& encoded, AudioBuffer<float>& dest)
+    {
+        std::unique_ptr<AudioFormatReader> reader (format.createReaderFor (new MemoryInputStream (encoded, false), true));
+        reader->read (&dest, 0, dest.getNumSamples(), 0, true, true);
+    }
+};
+
+static FlacBenchmark flacBenchmark;
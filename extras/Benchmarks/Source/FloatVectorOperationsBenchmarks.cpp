@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+
+//==============================================================================
+class FloatVectorOperationsBenchmark final : public Benchmark
+{
+public:
+    FloatVectorOperationsBenchmark() : Benchmark ("FloatVectorOperations", "Audio") {}
+
+    void run() override
+    {
+        using InstructionSet = FloatVectorOperations::InstructionSet;
+
+        // Repeatedly scaling the same buffer would otherwise end up measuring denormals
+        const ScopedNoDenormals noDenormals;
+
+        const auto original = FloatVectorOperations::getInstructionSet();
+
+        for (const auto set : { InstructionSet::baseline, InstructionSet::avx2, InstructionSet::avx512 })
+        {
+            if (FloatVectorOperations::setMaximumInstructionSet (set) != set)
+                continue;
+
+            const String setName = set == InstructionSet::avx512 ? "avx512"
+                                 : set == InstructionSet::avx2   ? "avx2"
+                                                                 : "baseline";
+
+            runOps<float>  (setName + ", float");
+            runOps<double> (setName + ", double");
+        }
+
+        FloatVectorOperations::setMaximumInstructionSet (original);
+    }
+
+private:
+    static constexpr int numSamples = 4096;
+
+    template <typename Type>
+    void runOps (const String& suffix)
+    {
+        const auto noise = makeNoise (2, numSamples);
+
+        HeapBlock<Type> src1 (numSamples), src2 (numSamples), dest (numSamples, true);
+        HeapBlock<int> ints (numSamples);
+
+        for (auto i = 0; i < numSamples; ++i)
+        {
+            src1[i] = (Type) noise.getSample (0, i);
+            src2[i] = (Type) noise.getSample (1, i);
+            ints[i] = roundToInt (noise.getSample (0, i) * 32767.0f);
+        }
+
+        const auto measure = [&] (const String& opName, auto&& fn)
+        {
+            const auto nanoseconds = measureNanosecondsPerCall (fn);
+            logResult (opName + " (" + suffix + ")", numSamples * 1.0e3 / nanoseconds, "Msamples/s");
+        };
+
+        Range<Type> range;
+
+        measure ("add",                    [&] { FloatVectorOperations::add (dest.get(), src1.get(), numSamples); });
+        measure ("add (two sources)",      [&] { FloatVectorOperations::add (dest.get(), src1.get(), src2.get(), numSamples); });
+        measure ("multiply",               [&] { FloatVectorOperations::multiply (dest.get(), src1.get(), src2.get(), numSamples); });
+        measure ("multiply (scalar)",      [&] { FloatVectorOperations::multiply (dest.get(), (Type) 0.999, numSamples); });
+        measure ("addWithMultiply",        [&] { FloatVectorOperations::addWithMultiply (dest.get(), src1.get(), (Type) 0.5, numSamples); });
+        measure ("clip",                   [&] { FloatVectorOperations::clip (dest.get(), src1.get(), (Type) -0.5, (Type) 0.5, numSamples); });
+        measure ("findMinAndMax",          [&] { range = FloatVectorOperations::findMinAndMax (src1.get(), numSamples); });
+
+        if constexpr (std::is_same_v<Type, float>)
+            measure ("convertFixedToFloat", [&] { FloatVectorOperations::convertFixedToFloat (dest.get(), ints.get(), 1.0f / 32768.0f, numSamples); });
+
+        ignoreUnused (range);
+    }
+};
+
+static FloatVectorOperationsBenchmark floatVectorOperationsBenchmark;
@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+#include "Benchmark.h"
+
+//==============================================================================
+class KnownPluginListBenchmark final : public Benchmark
+{
+public:
+    KnownPluginListBenchmark() : Benchmark ("KnownPluginList", "Audio") {}
+
+    void run() override
+    {
+        const TemporaryFile pluginFolder, xmlFile, cacheFile;
+        pluginFolder.getFile().createDirectory();
+
+        KnownPluginList list;
+
+        for (auto i = 0; i < numPlugins; ++i)
+        {
+            const auto file = pluginFolder.getFile().getChildFile ("Plugin " + String (i) + ".vst3");
+            file.replaceWithText (String (i));
+            list.addType (makeDescription (file, i));
+        }
+
+        list.createXml()->writeTo (xmlFile.getFile());
+        KnownPluginListCache::writeToFile (list, cacheFile.getFile());
+
+        const auto suffix = " (" + String (numPlugins) + " types)";
+
+        // Without a cache, startup parses the saved XML, then checks the
+        // modification time of every plugin before deciding what to rescan
+        logResult ("cold start, from XML" + suffix,
+                   measureNanosecondsPerCall ([&]
+                   {
+                       KnownPluginList restored;
+                       restored.recreateFromXml (*parseXML (xmlFile.getFile()));
+
+                       for (const auto& desc : restored.getTypes())
+                           needsRescanning += (File (desc.fileOrIdentifier).getLastModificationTime() != desc.lastFileModTime) ? 1 : 0;
+                   }, 1.0) * 1.0e-6,
+                   "ms");
+
+        Array<int> threadCounts { 1 };
+        threadCounts.addIfNotAlreadyThere (SystemStats::getNumCpus());
+
+        for (const auto numThreads : threadCounts)
+        {
+            logResult ("warm start, from cache, " + String (numThreads) + " thread(s)" + suffix,
+                       measureNanosecondsPerCall ([&]
+                       {
+                           KnownPluginList restored;
+                           KnownPluginListCache cache (cacheFile.getFile());
+                           needsRescanning += cache.restoreInto (restored, numThreads).size();
+                       }, 1.0) * 1.0e-6,
+                       "ms");
+        }
+
+        logResult ("write cache" + suffix,
+                   measureNanosecondsPerCall ([&] { KnownPluginListCache::writeToFile (list, cacheFile.getFile()); }) * 1.0e-6,
+                   "ms");
+
+        logResult ("write XML" + suffix,
+                   measureNanosecondsPerCall ([&] { list.createXml()->writeTo (xmlFile.getFile()); }) * 1.0e-6,
+                   "ms");
+
+        logResult ("cache file size" + suffix, (double) cacheFile.getFile().getSize() / 1024.0, "KB");
+        logResult ("XML file size" + suffix,   (double) xmlFile.getFile().getSize() / 1024.0, "KB");
+    }
+
+private:
+    static constexpr int numPlugins = 5000;
+
+    static PluginDescription makeDescription (const File& file, int index)
+    {
+        PluginDescription desc;
+        desc.name = "Plugin " + String (index);
+        desc.descriptiveName = "A plugin used for benchmarking";
+        desc.pluginFormatName = "VST3";
+        desc.category = index % 3 == 0 ? "Instrument" : "Fx";
+        desc.manufacturerName = "Manufacturer " + String (index % 50);
+        desc.version = "1.0." + String (index);
+        desc.fileOrIdentifier = file.getFullPathName();
+        desc.lastFileModTime = file.getLastModificationTime();
+        desc.lastInfoUpdateTime = Time::getCurrentTime();
+        desc.uniqueId = desc.deprecatedUid = index;
+        desc.isInstrument = index % 3 == 0;
+        desc.numInputChannels = desc.isInstrument ? 0 : 2;
+        desc.numOutputChannels = 2;
+        return desc;
+    }
+
+    // Stops the compiler from optimising away work whose result is never used
+    int needsRescanning = 0;
+};
+
+static KnownPluginListBenchmark knownPluginListBenchmark;
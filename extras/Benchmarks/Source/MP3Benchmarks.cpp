@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#include "Benchmark.h"
+
+#if JUCE_USE_MP3AUDIOFORMAT
+
+//==============================================================================
+class MP3Benchmark final : public Benchmark
+{
+public:
+    MP3Benchmark() : Benchmark ("MP3", "Audio") {}
+
+    void run() override
+    {
+        const TemporaryFile temp (".mp3");
+        const auto file = temp.getFile();
+        writeSilentStream (file);
+
+        const auto suffix = " (" + String (numHours) + " hour file)";
+        Random random (0x1234);
+
+        {
+            MP3AudioFormat format;
+            format.setFrameIndexOptions (false);
+
+            logResult ("open + first seek, unshared" + suffix,
+                       measureMilliseconds ([&] { seekInNewReader (format, file, random); }),
+                       "ms");
+        }
+
+        {
+            MP3AudioFormat format;
+            seekInNewReader (format, file, random);
+
+            logResult ("open + first seek, shared index" + suffix,
+                       measureMilliseconds ([&] { seekInNewReader (format, file, random); }),
+                       "ms");
+
+            std::unique_ptr<AudioFormatReader> reader (format.createReaderFor (file.createInputStream().release(), true));
+            AudioBuffer<float> buffer (2, blockSize);
+
+            logResult ("random seek in an open reader" + suffix,
+                       measureNanosecondsPerCall ([&] { readRandomBlock (*reader, buffer, random); }) * 1.0e-3,
+                       "us");
+        }
+
+        {
+            MP3AudioFormat format;
+            format.setFrameIndexOptions (true, true);
+            seekInNewReader (format, file, random);
+
+            logResult ("open + first seek, persisted index" + suffix,
+                       measureMilliseconds ([&]
+                       {
+                           MP3AudioFormat newFormat;
+                           newFormat.setFrameIndexOptions (true, true);
+                           seekInNewReader (newFormat, file, random);
+                       }),
+                       "ms");
+
+            MP3AudioFormat::getFrameIndexFile (file).deleteFile();
+        }
+    }
+
+private:
+    static constexpr int numHours = 2;
+    static constexpr int blockSize = 1152;
+
+    /*  Writes stereo MPEG-1 layer III frames at 44.1kHz and 128kb/s, with the same padding
+        pattern that an encoder would use. The frames are silent, so the decoding work is
+        small compared to the work of finding the right frame.
+    */
+    static void writeSilentStream (const File& file)
+    {
+        FileOutputStream out (file);
+        out.truncate();
+
+        const auto numFrames = (int64) numHours * 3600 * 44100 / 1152;
+        int64 paddingAccumulator = 0;
+
+        for (int64 i = 0; i < numFrames; ++i)
+        {
+            // 417.96 bytes per frame on average
+            paddingAccumulator += 96;
+            const auto padded = paddingAccumulator >= 100;
+
+            if (padded)
+                paddingAccumulator -= 100;
+
+            out.writeIntBigEndian ((int) (0xfffb9000u | (padded ? 0x200u : 0u)));
+            out.writeRepeatedByte (0, padded ? 414 : 413);
+        }
+    }
+
+    static void readRandomBlock (AudioFormatReader& reader, AudioBuffer<float>& buffer, Random& random)
+    {
+        const auto start = (int64) (random.nextDouble() * (double) (reader.lengthInSamples - blockSize));
+        reader.read (&buffer, 0, blockSize, start, true, true);
+    }
+
+    static void seekInNewReader (MP3AudioFormat& format, const File& file, Random& random)
+    {
+        std::unique_ptr<AudioFormatReader> reader (format.createReaderFor (file.createInputStream().release(), true));
+        AudioBuffer<float> buffer (2, blockSize);
+        readRandomBlock (*reader, buffer, random);
+    }
+
+    /*  Returns the mean time for a few calls, for operations that are too slow to measure
+        with measureNanosecondsPerCall().
+    */
+    template <typename Fn>
+    static double measureMilliseconds (Fn&& fn, int numCalls = 8)
+    {
+        const auto start = Time::getHighResolutionTicks();
+
+        for (auto i = 0; i < numCalls; ++i)
+            fn();
+
+        return Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - start) * 1.0e3 / numCalls;
+    }
+};
+
+static MP3Benchmark mp3Benchmark;
+
+#endif
@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+#include "Benchmark.h"
+
+//==============================================================================
+class ConsoleLogger final : public Logger
+{
+    void logMessage (const String& message) override
+    {
+        std::cout << message << std::endl;
+
+       #if JUCE_WINDOWS
+        Logger::outputDebugString (message);
+       #endif
+    }
+};
+
+//==============================================================================
+int main (int argc, char **argv)
+{
+    ArgumentList args (argc, argv);
+
+    if (args.containsOption ("--help|-h"))
+    {
+        std::cout << argv[0] << " [--help|-h] [--list] [--category=category] [--benchmark=name]" << std::endl;
+        return 0;
+    }
+
+    auto& allBenchmarks = Benchmark::getAllBenchmarks();
+
+    if (args.containsOption ("--list"))
+    {
+        for (auto* benchmark : allBenchmarks)
+            std::cout << benchmark->getCategory() << " / " << benchmark->getName() << std::endl;
+
+        return 0;
+    }
+
+    ConsoleLogger logger;
+    Logger::setCurrentLogger (&logger);
+
+    const auto category = args.getValueForOption ("--category");
+    const auto name = args.getValueForOption ("--benchmark");
+
+    for (auto* benchmark : allBenchmarks)
+    {
+        if (category.isNotEmpty() && benchmark->getCategory() != category)
+            continue;
+
+        if (name.isNotEmpty() && benchmark->getName() != name)
+            continue;
+
+        logger.writeToLog (newLine + "-----------------------------------------------------------------");
+        logger.writeToLog ("Running benchmark: " + benchmark->getCategory() + " / " + benchmark->getName());
+
+        benchmark->run();
+    }
+
+    Logger::setCurrentLogger (nullptr);
+    return 0;
+}
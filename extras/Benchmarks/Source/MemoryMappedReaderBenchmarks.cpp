@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#include "Benchmark.h"
+
+//==============================================================================
+class MemoryMappedReaderBenchmark final : public Benchmark
+{
+public:
+    MemoryMappedReaderBenchmark() : Benchmark ("MemoryMappedReader", "Audio") {}
+
+    void run() override
+    {
+        for (const auto numChannels : { 2, 8 })
+        {
+            for (const auto& [bitsPerSample, isFloat] : { std::pair { 16, false }, { 24, false }, { 32, true } })
+            {
+                const TemporaryFile temp (".wav");
+                writeNoise (temp.getFile(), numChannels, bitsPerSample);
+
+                WavAudioFormat format;
+                std::unique_ptr<MemoryMappedAudioFormatReader> reader (format.createMemoryMappedReader (temp.getFile()));
+                reader->mapEntireFile();
+
+                const auto suffix = " (" + String (numChannels) + "ch "
+                                  + (isFloat ? String ("float") : String (bitsPerSample) + "-bit") + ")";
+
+                AudioBuffer<float> buffer (numChannels, blockSize);
+                Random random (0x1234);
+
+                logResult ("read " + String (blockSize) + " samples" + suffix,
+                           measureNanosecondsPerCall ([&]
+                           {
+                               const auto start = random.nextInt ((int) reader->lengthInSamples - blockSize);
+                               reader->read (&buffer, 0, blockSize, start, true, true);
+                           }) * 1.0e-3,
+                           "us");
+
+                std::vector<Range<float>> levels ((size_t) numChannels);
+
+                logResult ("readMaxLevels, whole file" + suffix,
+                           measureNanosecondsPerCall ([&]
+                           {
+                               reader->readMaxLevels (0, reader->lengthInSamples, levels.data(), numChannels);
+                           }) * 1.0e-6,
+                           "ms");
+            }
+        }
+    }
+
+private:
+    static constexpr int blockSize = 4096;
+    static constexpr int numSeconds = 10;
+    static constexpr double sampleRate = 48000.0;
+
+    static void writeNoise (const File& file, int numChannels, int bitsPerSample)
+    {
+        const auto noise = makeNoise (numChannels, (int) sampleRate * numSeconds);
+
+        std::unique_ptr<AudioFormatWriter> writer (WavAudioFormat().createWriterFor (new FileOutputStream (file),
+                                                                                      sampleRate, (unsigned int) numChannels,
+                                                                                      bitsPerSample, {}, 0));
+        writer->writeFromAudioSampleBuffer (noise, 0, noise.getNumSamples());
+    }
+};
+
+static MemoryMappedReaderBenchmark memoryMappedReaderBenchmark;
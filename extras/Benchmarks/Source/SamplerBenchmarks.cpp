@@ -0,0 +1,174 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#include "Benchmark.h"
+
+//==============================================================================
+class SamplerBenchmark final : public Benchmark
+{
+public:
+    SamplerBenchmark() : Benchmark ("Sampler", "Audio") {}
+
+    void run() override
+    {
+        const TemporaryFile folder;
+        folder.getFile().createDirectory();
+
+        Array<File> files;
+        const auto noise = makeNoise (2, numSecondsPerZone * sampleRate);
+
+        for (auto i = 0; i < numZones; ++i)
+        {
+            files.add (folder.getFile().getChildFile ("Zone " + String (i) + ".wav"));
+
+            std::unique_ptr<AudioFormatWriter> writer (WavAudioFormat().createWriterFor (new FileOutputStream (files.getLast()),
+                                                                                          sampleRate, 2, 24, {}, 0));
+            writer->writeFromAudioSampleBuffer (noise, 0, noise.getNumSamples());
+        }
+
+        const auto suffix = " (" + String (numZones) + " zones)";
+
+        SamplerDiskStreamer streamer;
+        ReferenceCountedArray<SynthesiserSound> inMemory, streamed;
+
+        logResult ("load, in memory" + suffix,
+                   measureOnce ([&]
+                   {
+                       for (auto i = 0; i < numZones; ++i)
+                       {
+                           std::unique_ptr<AudioFormatReader> reader (WavAudioFormat().createReaderFor (files[i].createInputStream().release(), true));
+                           inMemory.add (new SamplerSound (files[i].getFileName(), *reader, getNotes (i), firstNote + i, 0.0, 0.1, 60.0));
+                       }
+                   }),
+                   "ms");
+
+        logResult ("load, streamed" + suffix,
+                   measureOnce ([&]
+                   {
+                       for (auto i = 0; i < numZones; ++i)
+                       {
+                           std::unique_ptr<MemoryMappedAudioFormatReader> reader (WavAudioFormat().createMemoryMappedReader (files[i]));
+                           reader->mapEntireFile();
+                           streamed.add (new SamplerSound (files[i].getFileName(), std::move (reader), getNotes (i), firstNote + i, 0.0, 0.1, 60.0, numSamplesToPreload));
+                       }
+                   }),
+                   "ms");
+
+        logResult ("memory used, in memory" + suffix, getMegabytesUsed (inMemory), "MB");
+        logResult ("memory used, streamed" + suffix,
+                   getMegabytesUsed (streamed, numVoices * streamer.getNumSamplesToBufferPerVoice()),
+                   "MB");
+
+        logResult ("render block, in memory (" + String (numVoices) + " voices)",
+                   measureRendering (inMemory, [] { return new SamplerVoice(); }) * 1.0e-3,
+                   "us");
+
+        // This renders much faster than real time, so the voices have to wait for the
+        // disk, as they would when bouncing offline
+        streamer.setReadTimeout (-1);
+
+        logResult ("render block, streamed (" + String (numVoices) + " voices)",
+                   measureRendering (streamed, [&] { return new SamplerVoice (streamer); }) * 1.0e-3,
+                   "us");
+    }
+
+private:
+    static constexpr int numZones = 32;
+    static constexpr int numSecondsPerZone = 10;
+    static constexpr int sampleRate = 44100;
+    static constexpr int numSamplesToPreload = 32768;
+    static constexpr int numVoices = 16;
+    static constexpr int blockSize = 256;
+    static constexpr int firstNote = 36;
+
+    /*  Each zone is mapped to a single key. */
+    static BigInteger getNotes (int zone)
+    {
+        BigInteger notes;
+        notes.setBit (firstNote + zone);
+        return notes;
+    }
+
+    template <typename Fn>
+    static double measureOnce (Fn&& fn)
+    {
+        const auto start = Time::getHighResolutionTicks();
+        fn();
+        return Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - start) * 1.0e3;
+    }
+
+    /*  Counts the samples held in memory by the sounds, plus the given number of samples
+        per channel held by the ring buffers of the voices.
+    */
+    static double getMegabytesUsed (const ReferenceCountedArray<SynthesiserSound>& sounds, int numBufferedSamples = 0)
+    {
+        auto numSamples = (int64) numBufferedSamples * 2;
+
+        for (auto* sound : sounds)
+            if (auto* data = static_cast<SamplerSound*> (sound)->getAudioData())
+                numSamples += (int64) data->getNumChannels() * data->getNumSamples();
+
+        return (double) numSamples * sizeof (float) / (1024.0 * 1024.0);
+    }
+
+    /*  Keeps all the voices busy with notes spread across the zones, stealing the oldest
+        voice for each new note, and returns the time taken to render each block in
+        nanoseconds.
+    */
+    template <typename CreateVoice>
+    static double measureRendering (const ReferenceCountedArray<SynthesiserSound>& sounds, CreateVoice&& createVoice)
+    {
+        Synthesiser synth;
+        synth.setCurrentPlaybackSampleRate (sampleRate);
+
+        for (auto i = 0; i < numVoices; ++i)
+            synth.addVoice (createVoice());
+
+        for (auto* sound : sounds)
+            synth.addSound (sound);
+
+        AudioBuffer<float> output (2, blockSize);
+        MidiBuffer midi;
+        int blockIndex = 0;
+
+        const auto result = measureNanosecondsPerCall ([&]
+        {
+            midi.clear();
+
+            if (blockIndex % 4 == 0)
+                midi.addEvent (MidiMessage::noteOn (1, firstNote + (blockIndex / 4) % numZones, 1.0f), 0);
+
+            output.clear();
+            synth.renderNextBlock (output, midi, 0, blockSize);
+            ++blockIndex;
+        });
+
+        synth.allNotesOff (0, false);
+        return result;
+    }
+};
+
+static SamplerBenchmark samplerBenchmark;
@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+
+#include "Benchmark.h"
+
+//==============================================================================
+class ThreadedWriterBenchmark final : public Benchmark
+{
+public:
+    ThreadedWriterBenchmark() : Benchmark ("ThreadedWriter", "Audio") {}
+
+    void run() override
+    {
+        TimeSliceThread thread ("ThreadedWriter benchmark");
+        thread.startThread();
+
+        OwnedArray<AudioFormatWriter::ThreadedWriter> writers;
+
+        for (auto i = 0; i < numWriters; ++i)
+            writers.add (new AudioFormatWriter::ThreadedWriter (WavAudioFormat().createWriterFor (new DiscardingOutputStream(),
+                                                                                                 sampleRate, numChannelsPerWriter,
+                                                                                                 24, {}, 0),
+                                                                thread, sampleRate));
+
+        const auto noise = makeNoise (numChannelsPerWriter, blockSize);
+        const auto blockDuration = Time::secondsToHighResolutionTicks ((double) blockSize / sampleRate);
+        const auto numBlocks = numSeconds * sampleRate / blockSize;
+
+        int64 totalTicks = 0, maxTicks = 0;
+        auto nextBlockTime = Time::getHighResolutionTicks();
+
+        // Pushes the blocks in real time, as an audio callback would
+        for (auto i = 0; i < numBlocks; ++i)
+        {
+            while (Time::getHighResolutionTicks() < nextBlockTime)
+                Thread::yield();
+
+            nextBlockTime += blockDuration;
+
+            const auto start = Time::getHighResolutionTicks();
+
+            for (auto* writer : writers)
+                writer->write (noise.getArrayOfReadPointers(), blockSize);
+
+            const auto elapsed = Time::getHighResolutionTicks() - start;
+            totalTicks += elapsed;
+            maxTicks = jmax (maxTicks, elapsed);
+        }
+
+        const auto suffix = " (" + String (numWriters * numChannelsPerWriter) + " channels, " + String (sampleRate / 1000) + " kHz)";
+
+        logResult ("callback, mean" + suffix, Time::highResolutionTicksToSeconds (totalTicks) * 1.0e6 / numBlocks, "us");
+        logResult ("callback, worst" + suffix, Time::highResolutionTicksToSeconds (maxTicks) * 1.0e6, "us");
+
+        AudioFormatWriter::ThreadedWriter::Statistics worst;
+
+        for (auto* writer : writers)
+        {
+            const auto statistics = writer->getStatistics();
+            worst.maxNumSamplesBuffered = jmax (worst.maxNumSamplesBuffered, statistics.maxNumSamplesBuffered);
+            worst.maxLatencySeconds = jmax (worst.maxLatencySeconds, statistics.maxLatencySeconds);
+            worst.numSamplesDropped += statistics.numSamplesDropped;
+        }
+
+        logResult ("worst buffer fill" + suffix, 100.0 * worst.maxNumSamplesBuffered / sampleRate, "%");
+        logResult ("worst latency" + suffix, worst.maxLatencySeconds * 1.0e3, "ms");
+        logResult ("samples dropped" + suffix, (double) worst.numSamplesDropped, "samples");
+    }
+
+private:
+    static constexpr int numWriters = 16;
+    static constexpr int numChannelsPerWriter = 8;
+    static constexpr int sampleRate = 192000;
+    static constexpr int blockSize = 256;
+    static constexpr int numSeconds = 3;
+
+    /*  Measures the cost of buffering and converting the audio, without the disk. */
+    struct DiscardingOutputStream final : public OutputStream
+    {
+        void flush() override                              {}
+        bool setPosition (int64 newPosition) override      { position = newPosition; return true; }
+        int64 getPosition() override                       { return position; }
+        bool write (const void*, size_t numBytes) override { position += (int64) numBytes; return true; }
+
+        int64 position = 0;
+    };
+};
+
+static ThreadedWriterBenchmark threadedWriterBenchmark;
@@ -23,6 +23,299 @@
 namespace juce
 {
 
+//==============================================================================
+namespace AudioDataHelpers
+{
+    template <typename SampleFormat>
+    using ConstNativePointer = AudioData::Pointer<SampleFormat, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::Const>;
+
+    template <typename SampleFormat>
+    using NativePointer = AudioData::Pointer<SampleFormat, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::NonConst>;
+
+    // The scalar versions convert one sample at a time, in exactly the same way that
+    // Pointer::convertSamples() would.
+    template <typename SampleFormat>
+    static void convertToFloatScalar (float* dest, const void* source, int start, int numSamples) noexcept
+    {
+        ConstNativePointer<SampleFormat> s (addBytesToPointer (source, start * SampleFormat::bytesPerSample));
+
+        for (int i = start; i < numSamples; ++i, ++s)
+            dest[i] = s.getAsFloat();
+    }
+
+    template <typename SampleFormat>
+    static void convertFromFloatScalar (void* dest, const float* source, int start, int numSamples) noexcept
+    {
+        NativePointer<SampleFormat> d (addBytesToPointer (dest, start * SampleFormat::bytesPerSample));
+
+        for (int i = start; i < numSamples; ++i, ++d)
+            d.setAsInt32 (ConstNativePointer<AudioData::Float32> (source + i).getAsInt32());
+    }
+
+   #if JUCE_USE_SSE_INTRINSICS
+    static forcedinline __m128i floatToInt32 (__m128 v) noexcept
+    {
+        const auto scale = _mm_set1_pd ((double) AudioData::Int32::maxValue);
+        v = _mm_min_ps (_mm_max_ps (v, _mm_set1_ps (-1.0f)), _mm_set1_ps (1.0f));
+
+        const auto lo = _mm_cvtpd_epi32 (_mm_mul_pd (_mm_cvtps_pd (v), scale));
+        const auto hi = _mm_cvtpd_epi32 (_mm_mul_pd (_mm_cvtps_pd (_mm_movehl_ps (v, v)), scale));
+        return _mm_unpacklo_epi64 (lo, hi);
+    }
+   #endif
+
+    static int convertToFloatVectorised (AudioData::Int16, float* dest, const void* source, int numSamples) noexcept
+    {
+        int i = 0;
+        const auto* src = static_cast<const int16*> (source);
+
+       #if JUCE_USE_SSE_INTRINSICS
+        const auto scale = _mm_set1_ps (1.0f / 32768.0f);
+
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const auto v = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (src + i));
+            _mm_storeu_ps (dest + i,     _mm_mul_ps (_mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpacklo_epi16 (v, v), 16)), scale));
+            _mm_storeu_ps (dest + i + 4, _mm_mul_ps (_mm_cvtepi32_ps (_mm_srai_epi32 (_mm_unpackhi_epi16 (v, v), 16)), scale));
+        }
+       #elif JUCE_USE_ARM_NEON
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const auto v = vld1q_s16 (src + i);
+            vst1q_f32 (dest + i,     vmulq_n_f32 (vcvtq_f32_s32 (vmovl_s16 (vget_low_s16  (v))), 1.0f / 32768.0f));
+            vst1q_f32 (dest + i + 4, vmulq_n_f32 (vcvtq_f32_s32 (vmovl_s16 (vget_high_s16 (v))), 1.0f / 32768.0f));
+        }
+       #else
+        ignoreUnused (dest, src, numSamples);
+       #endif
+
+        return i;
+    }
+
+    static int convertToFloatVectorised (AudioData::Int24, float* dest, const void* source, int numSamples) noexcept
+    {
+        int i = 0;
+
+       #if JUCE_USE_SSE_INTRINSICS
+        const auto* src = static_cast<const char*> (source);
+        const auto scale = _mm_set1_ps (1.0f / 8388608.0f);
+
+        // Each sample is read as a 4-byte word, so the last sample is always left to the scalar loop
+        for (; i + 5 <= numSamples; i += 4)
+        {
+            const auto* s = src + 3 * i;
+            const auto v = _mm_setr_epi32 (readUnaligned<int32> (s),     readUnaligned<int32> (s + 3),
+                                           readUnaligned<int32> (s + 6), readUnaligned<int32> (s + 9));
+            _mm_storeu_ps (dest + i, _mm_mul_ps (_mm_cvtepi32_ps (_mm_srai_epi32 (_mm_slli_epi32 (v, 8), 8)), scale));
+        }
+       #else
+        ignoreUnused (dest, source, numSamples);
+       #endif
+
+        return i;
+    }
+
+    static int convertToFloatVectorised (AudioData::Int32, float* dest, const void* source, int numSamples) noexcept
+    {
+        int i = 0;
+        const auto* src = static_cast<const int32*> (source);
+
+       #if JUCE_USE_SSE_INTRINSICS
+        const auto scale = _mm_set1_ps (1.0f / 2147483648.0f);
+
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            _mm_storeu_ps (dest + i,     _mm_mul_ps (_mm_cvtepi32_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (src + i))), scale));
+            _mm_storeu_ps (dest + i + 4, _mm_mul_ps (_mm_cvtepi32_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (src + i + 4))), scale));
+        }
+       #elif JUCE_USE_ARM_NEON
+        for (; i + 4 <= numSamples; i += 4)
+            vst1q_f32 (dest + i, vmulq_n_f32 (vcvtq_f32_s32 (vld1q_s32 (src + i)), 1.0f / 2147483648.0f));
+       #else
+        ignoreUnused (dest, src, numSamples);
+       #endif
+
+        return i;
+    }
+
+    static int convertFromFloatVectorised (AudioData::Int16, void* dest, const float* source, int numSamples) noexcept
+    {
+        int i = 0;
+
+       #if JUCE_USE_SSE_INTRINSICS
+        auto* dst = static_cast<int16*> (dest);
+
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const auto lo = _mm_srai_epi32 (floatToInt32 (_mm_loadu_ps (source + i)), 16);
+            const auto hi = _mm_srai_epi32 (floatToInt32 (_mm_loadu_ps (source + i + 4)), 16);
+            _mm_storeu_si128 (reinterpret_cast<__m128i*> (dst + i), _mm_packs_epi32 (lo, hi));
+        }
+       #else
+        ignoreUnused (dest, source, numSamples);
+       #endif
+
+        return i;
+    }
+
+    static int convertFromFloatVectorised (AudioData::Int24, void* dest, const float* source, int numSamples) noexcept
+    {
+        int i = 0;
+
+       #if JUCE_USE_SSE_INTRINSICS
+        auto* dst = static_cast<char*> (dest);
+
+        // Each sample is written as a 4-byte word whose top byte is overwritten by the
+        // next sample, so the last sample is always left to the scalar loop
+        for (; i + 5 <= numSamples; i += 4)
+        {
+            alignas (16) int32 values[4];
+            _mm_store_si128 (reinterpret_cast<__m128i*> (values), _mm_srai_epi32 (floatToInt32 (_mm_loadu_ps (source + i)), 8));
+
+            auto* d = dst + 3 * i;
+            writeUnaligned (d,     values[0]);
+            writeUnaligned (d + 3, values[1]);
+            writeUnaligned (d + 6, values[2]);
+            writeUnaligned (d + 9, values[3]);
+        }
+       #else
+        ignoreUnused (dest, source, numSamples);
+       #endif
+
+        return i;
+    }
+
+    static int convertFromFloatVectorised (AudioData::Int32, void* dest, const float* source, int numSamples) noexcept
+    {
+        int i = 0;
+
+       #if JUCE_USE_SSE_INTRINSICS
+        auto* dst = static_cast<int32*> (dest);
+
+        for (; i + 4 <= numSamples; i += 4)
+            _mm_storeu_si128 (reinterpret_cast<__m128i*> (dst + i), floatToInt32 (_mm_loadu_ps (source + i)));
+       #else
+        ignoreUnused (dest, source, numSamples);
+       #endif
+
+        return i;
+    }
+
+    // Big enough to keep the intermediate float block in L1 while amortising the per-block setup
+    static constexpr int interleavingBlockSize = 2048;
+    static constexpr int maxInterleavedChannels = 32;
+}
+
+template <typename SampleFormat>
+void AudioData::convertToFloat (float* dest, const void* source, int numSamples) noexcept
+{
+    if constexpr (std::is_same_v<SampleFormat, Float32>)
+    {
+        memcpy (dest, source, (size_t) numSamples * sizeof (float));
+    }
+    else
+    {
+        const auto done = AudioDataHelpers::convertToFloatVectorised (SampleFormat (nullptr), dest, source, numSamples);
+        AudioDataHelpers::convertToFloatScalar<SampleFormat> (dest, source, done, numSamples);
+    }
+}
+
+template <typename SampleFormat>
+void AudioData::convertFromFloat (void* dest, const float* source, int numSamples) noexcept
+{
+    if constexpr (std::is_same_v<SampleFormat, Float32>)
+    {
+        memcpy (dest, source, (size_t) numSamples * sizeof (float));
+    }
+    else
+    {
+        const auto done = AudioDataHelpers::convertFromFloatVectorised (SampleFormat (nullptr), dest, source, numSamples);
+        AudioDataHelpers::convertFromFloatScalar<SampleFormat> (dest, source, done, numSamples);
+    }
+}
+
+template <typename SampleFormat>
+bool AudioData::interleaveFromFloat (void* dest, const float* const* source, int numChannels, int numSamples) noexcept
+{
+    using namespace AudioDataHelpers;
+
+    if (numChannels > maxInterleavedChannels)
+        return false;
+
+    if constexpr (std::is_same_v<SampleFormat, Float32>)
+    {
+        FloatVectorOperations::interleave (static_cast<float*> (dest), source, numChannels, numSamples);
+    }
+    else
+    {
+        float block[interleavingBlockSize];
+        const float* channels[maxInterleavedChannels];
+        const auto samplesPerBlock = interleavingBlockSize / jmax (1, numChannels);
+
+        for (int pos = 0; pos < numSamples; pos += samplesPerBlock)
+        {
+            const auto num = jmin (samplesPerBlock, numSamples - pos);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                channels[ch] = source[ch] + pos;
+
+            FloatVectorOperations::interleave (block, channels, numChannels, num);
+            convertFromFloat<SampleFormat> (addBytesToPointer (dest, pos * numChannels * SampleFormat::bytesPerSample),
+                                            block, num * numChannels);
+        }
+    }
+
+    return true;
+}
+
+template <typename SampleFormat>
+bool AudioData::deinterleaveToFloat (float* const* dest, const void* source, int numChannels, int numSamples) noexcept
+{
+    using namespace AudioDataHelpers;
+
+    if (numChannels > maxInterleavedChannels)
+        return false;
+
+    if constexpr (std::is_same_v<SampleFormat, Float32>)
+    {
+        FloatVectorOperations::deinterleave (dest, static_cast<const float*> (source), numChannels, numSamples);
+    }
+    else
+    {
+        float block[interleavingBlockSize];
+        float* channels[maxInterleavedChannels];
+        const auto samplesPerBlock = interleavingBlockSize / jmax (1, numChannels);
+
+        for (int pos = 0; pos < numSamples; pos += samplesPerBlock)
+        {
+            const auto num = jmin (samplesPerBlock, numSamples - pos);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                channels[ch] = dest[ch] + pos;
+
+            convertToFloat<SampleFormat> (block, addBytesToPointer (source, pos * numChannels * SampleFormat::bytesPerSample),
+                                          num * numChannels);
+            FloatVectorOperations::deinterleave (channels, block, numChannels, num);
+        }
+    }
+
+    return true;
+}
+
+#define JUCE_INSTANTIATE_AUDIODATA_VECTOR_OPS(Format) \
+    template void AudioData::convertToFloat<AudioData::Format>   (float*, const void*, int) noexcept; \
+    template void AudioData::convertFromFloat<AudioData::Format> (void*, const float*, int) noexcept; \
+    template bool AudioData::interleaveFromFloat<AudioData::Format> (void*, const float* const*, int, int) noexcept; \
+    template bool AudioData::deinterleaveToFloat<AudioData::Format> (float* const*, const void*, int, int) noexcept;
+
+JUCE_INSTANTIATE_AUDIODATA_VECTOR_OPS (Int16)
+JUCE_INSTANTIATE_AUDIODATA_VECTOR_OPS (Int24)
+JUCE_INSTANTIATE_AUDIODATA_VECTOR_OPS (Int32)
+JUCE_INSTANTIATE_AUDIODATA_VECTOR_OPS (Float32)
+
+#undef JUCE_INSTANTIATE_AUDIODATA_VECTOR_OPS
+
+//==============================================================================
 JUCE_BEGIN_IGNORE_WARNINGS_GCC_LIKE ("-Wdeprecated-declarations")
 JUCE_BEGIN_IGNORE_WARNINGS_MSVC (4996)
 
@@ -565,6 +858,106 @@ public:
         }
     };
 
+    template <class FormatType>
+    struct VectorisedTest
+    {
+        // The vectorised conversions must give exactly the same results as converting one sample at a time
+        static void test (UnitTest& unitTest, Random& r)
+        {
+            using FloatPointer      = AudioData::Pointer<AudioData::Float32, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::NonConst>;
+            using ConstFloatPointer = AudioData::Pointer<AudioData::Float32, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::Const>;
+            using ConstPointer      = AudioData::Pointer<FormatType, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::Const>;
+            using NonConstPointer   = AudioData::Pointer<FormatType, AudioData::NativeEndian, AudioData::NonInterleaved, AudioData::NonConst>;
+            constexpr auto bytesPerSample = (int) FormatType::bytesPerSample;
+
+            for (auto numSamples : { 1, 3, 7, 64, 501 })
+            {
+                for (int offset = 0; offset < 3; ++offset)
+                {
+                    HeapBlock<float> floats ((size_t) numSamples + 1), result ((size_t) numSamples + 1), expected ((size_t) numSamples + 1);
+                    HeapBlock<char> encoded ((size_t) ((numSamples + 1) * bytesPerSample + 4), true),
+                                    encodedExpected ((size_t) ((numSamples + 1) * bytesPerSample + 4), true);
+
+                    for (int i = 0; i < numSamples; ++i)
+                        floats[i + offset % 2] = r.nextFloat() * 2.2f - 1.1f;
+
+                    floats[offset % 2] = 1.0f;
+
+                    auto* source = floats.get() + offset % 2;
+                    auto* raw = encoded.get() + offset;
+                    auto* rawExpected = encodedExpected.get() + offset;
+
+                    NonConstPointer (raw).convertSamples (ConstFloatPointer (source), numSamples);
+
+                    NonConstPointer e (rawExpected);
+
+                    for (int i = 0; i < numSamples; ++i, ++e)
+                    {
+                        if constexpr (FormatType::isFloat)
+                            e.setAsFloat (source[i]);
+                        else
+                            e.setAsInt32 (ConstFloatPointer (source + i).getAsInt32());
+                    }
+
+                    unitTest.expect (memcmp (raw, rawExpected, (size_t) (numSamples * bytesPerSample)) == 0);
+
+                    FloatPointer (result.get()).convertSamples (ConstPointer (raw), numSamples);
+
+                    ConstPointer s (raw);
+
+                    for (int i = 0; i < numSamples; ++i, ++s)
+                        expected[i] = s.getAsFloat();
+
+                    unitTest.expect (memcmp (result.get(), expected.get(), (size_t) numSamples * sizeof (float)) == 0);
+                }
+            }
+
+            for (auto numChannels : { 1, 2, 3, 4, 8 })
+            {
+                constexpr auto numSamples = 3000;
+                using Format = AudioData::Format<FormatType, AudioData::NativeEndian>;
+                using FloatFormat = AudioData::Format<AudioData::Float32, AudioData::NativeEndian>;
+                using InterleavedPointer = AudioData::Pointer<FormatType, AudioData::NativeEndian, AudioData::Interleaved, AudioData::NonConst>;
+                using ConstInterleavedPointer = AudioData::Pointer<FormatType, AudioData::NativeEndian, AudioData::Interleaved, AudioData::Const>;
+                using ElementType = std::remove_pointer_t<decltype (FormatType::data)>;
+                const auto numBytes = (size_t) (numChannels * numSamples * bytesPerSample);
+
+                AudioBuffer<float> sourceBuffer { numChannels, numSamples },
+                                   destBuffer   { numChannels, numSamples },
+                                   expectedBuffer { numChannels, numSamples };
+                HeapBlock<char> interleaved (numBytes), expectedInterleaved (numBytes);
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                    for (int i = 0; i < numSamples; ++i)
+                        sourceBuffer.setSample (ch, i, r.nextFloat() * 2.0f - 1.0f);
+
+                AudioData::interleaveSamples (AudioData::NonInterleavedSource<FloatFormat> { sourceBuffer.getArrayOfReadPointers(), numChannels },
+                                              AudioData::InterleavedDest<Format> { reinterpret_cast<ElementType*> (interleaved.get()), numChannels },
+                                              numSamples);
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                    InterleavedPointer (expectedInterleaved + ch * bytesPerSample, numChannels).convertSamples (ConstFloatPointer (sourceBuffer.getReadPointer (ch)), numSamples);
+
+                unitTest.expect (memcmp (interleaved, expectedInterleaved, numBytes) == 0);
+
+                AudioData::deinterleaveSamples (AudioData::InterleavedSource<Format> { reinterpret_cast<const ElementType*> (interleaved.get()), numChannels },
+                                                AudioData::NonInterleavedDest<FloatFormat> { destBuffer.getArrayOfWritePointers(), numChannels },
+                                                numSamples);
+
+                bool deinterleavingMatches = true;
+
+                for (int ch = 0; ch < numChannels; ++ch)
+                {
+                    FloatPointer (expectedBuffer.getWritePointer (ch)).convertSamples (ConstInterleavedPointer (interleaved + ch * bytesPerSample, numChannels), numSamples);
+                    deinterleavingMatches = deinterleavingMatches
+                                             && memcmp (destBuffer.getReadPointer (ch), expectedBuffer.getReadPointer (ch), (size_t) numSamples * sizeof (float)) == 0;
+                }
+
+                unitTest.expect (deinterleavingMatches);
+            }
+        }
+    };
+
     void runTest() override
     {
         auto r = getRandom();
@@ -579,6 +972,15 @@ public:
         beginTest ("Round-trip conversion: Float32");
         Test1 <AudioData::Float32>::test (*this, r);
 
+        beginTest ("Vectorised conversion: Int16");
+        VectorisedTest<AudioData::Int16>::test (*this, r);
+        beginTest ("Vectorised conversion: Int24");
+        VectorisedTest<AudioData::Int24>::test (*this, r);
+        beginTest ("Vectorised conversion: Int32");
+        VectorisedTest<AudioData::Int32>::test (*this, r);
+        beginTest ("Vectorised conversion: Float32");
+        VectorisedTest<AudioData::Float32>::test (*this, r);
+
         using Format = AudioData::Format<AudioData::Float32, AudioData::NativeEndian>;
 
         beginTest ("Interleaving");
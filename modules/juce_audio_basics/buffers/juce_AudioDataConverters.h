@@ -457,6 +457,9 @@ public:
 
         /** Writes a stream of samples into this pointer from another pointer.
             This will copy the specified number of samples, converting between formats appropriately.
+
+            Conversions between contiguous, native-endian 32-bit floats and 16/24/32-bit integers
+            or floats use vectorised routines when the source and destination don't overlap.
         */
         template <class OtherPointerType>
         void convertSamples (OtherPointerType source, int numSamples) const noexcept
@@ -464,6 +467,9 @@ public:
             // trying to write to a const pointer! For a writeable one, use AudioData::NonConst instead!
             static_assert (Constness::isConst == 0, "Attempt to write to a const pointer");
 
+            if (convertSamplesVectorised (*this, source, numSamples))
+                return;
+
             Pointer dest (*this);
 
             if (source.getRawData() != getRawData() || source.getNumBytesBetweenSamples() >= getNumBytesBetweenSamples())
@@ -691,6 +697,76 @@ private:
         int channels;
     };
 
+    //==============================================================================
+    template <typename PointerType>
+    struct VectorisedPointerInfo
+    {
+        static constexpr bool isNativeFloat = false, isVectorisable = false;
+    };
+
+    template <typename SampleFormat, typename Endianness, typename InterleavingType, typename Constness>
+    struct VectorisedPointerInfo<Pointer<SampleFormat, Endianness, InterleavingType, Constness>>
+    {
+        using Format = SampleFormat;
+
+        static constexpr bool isNativeEndian = (int) Endianness::isBigEndian == (int) NativeEndian::isBigEndian;
+        static constexpr bool isNativeFloat  = isNativeEndian && std::is_same_v<SampleFormat, Float32>;
+        static constexpr bool isVectorisable = isNativeEndian && (std::is_same_v<SampleFormat, Int16>
+                                                                  || std::is_same_v<SampleFormat, Int24>
+                                                                  || std::is_same_v<SampleFormat, Int32>
+                                                                  || std::is_same_v<SampleFormat, Float32>);
+    };
+
+    // These are only instantiated for the Int16, Int24, Int32 and Float32 formats, and
+    // produce exactly the same values as converting each sample through a Pointer.
+    template <typename SampleFormat> static void convertToFloat   (float* dest, const void* source, int numSamples) noexcept;
+    template <typename SampleFormat> static void convertFromFloat (void* dest, const float* source, int numSamples) noexcept;
+
+    template <typename SampleFormat> static bool interleaveFromFloat (void* dest, const float* const* source, int numChannels, int numSamples) noexcept;
+    template <typename SampleFormat> static bool deinterleaveToFloat (float* const* dest, const void* source, int numChannels, int numSamples) noexcept;
+
+    template <typename PointerType>
+    static bool isContiguous (const PointerType& p) noexcept
+    {
+        return p.getNumBytesBetweenSamples() == PointerType::getBytesPerSample();
+    }
+
+    template <typename DestPointer, typename SourcePointer>
+    static bool convertSamplesVectorised (const DestPointer& dest, const SourcePointer& source, int numSamples) noexcept
+    {
+        using DestInfo   = VectorisedPointerInfo<DestPointer>;
+        using SourceInfo = VectorisedPointerInfo<SourcePointer>;
+
+        if constexpr (DestInfo::isVectorisable && SourceInfo::isVectorisable
+                       && (DestInfo::isNativeFloat || SourceInfo::isNativeFloat))
+        {
+            if (numSamples <= 0 || ! isContiguous (dest) || ! isContiguous (source))
+                return false;
+
+            const auto destStart   = (pointer_sized_int) dest.getRawData();
+            const auto sourceStart = (pointer_sized_int) source.getRawData();
+
+            // overlapping conversions are left to the sample-by-sample code, which knows which way to copy
+            if (destStart < sourceStart + numSamples * SourcePointer::getBytesPerSample()
+                 && sourceStart < destStart + numSamples * DestPointer::getBytesPerSample())
+                return false;
+
+            auto* destData = const_cast<void*> (dest.getRawData());
+
+            if constexpr (DestInfo::isNativeFloat)
+                convertToFloat<typename SourceInfo::Format> (static_cast<float*> (destData), source.getRawData(), numSamples);
+            else
+                convertFromFloat<typename DestInfo::Format> (destData, static_cast<const float*> (source.getRawData()), numSamples);
+
+            return true;
+        }
+        else
+        {
+            ignoreUnused (dest, source, numSamples);
+            return false;
+        }
+    }
+
 public:
     //==============================================================================
     /** A sequence of interleaved samples used as the source for the deinterleaveSamples() method. */
@@ -727,6 +803,14 @@ public:
         using SourceType = typename decltype (source)::PointerType;
         using DestType   = typename decltype (dest)  ::PointerType;
 
+        if constexpr (VectorisedPointerInfo<SourceType>::isNativeFloat && VectorisedPointerInfo<DestType>::isVectorisable)
+        {
+            if (source.channels == dest.channels
+                 && std::none_of (source.data, source.data + source.channels, [] (auto* c) { return c == nullptr; })
+                 && interleaveFromFloat<typename VectorisedPointerInfo<DestType>::Format> (dest.data, source.data, dest.channels, numSamples))
+                return;
+        }
+
         for (int i = 0; i < dest.channels; ++i)
         {
             const DestType destType (addBytesToPointer (dest.data, i * DestType::getBytesPerSample()), dest.channels);
@@ -771,6 +855,14 @@ public:
         using SourceType = typename decltype (source)::PointerType;
         using DestType   = typename decltype (dest)  ::PointerType;
 
+        if constexpr (VectorisedPointerInfo<DestType>::isNativeFloat && VectorisedPointerInfo<SourceType>::isVectorisable)
+        {
+            if (source.channels == dest.channels
+                 && std::none_of (dest.data, dest.data + dest.channels, [] (auto* c) { return c == nullptr; })
+                 && deinterleaveToFloat<typename VectorisedPointerInfo<SourceType>::Format> (dest.data, source.data, dest.channels, numSamples))
+                return;
+        }
+
         for (int i = 0; i < dest.channels; ++i)
         {
             if (auto* targetChan = dest.data[i])
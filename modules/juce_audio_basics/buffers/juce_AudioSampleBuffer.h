@@ -737,14 +737,8 @@ public:
                 jassert (isPositiveAndBelow (channel, numChannels));
                 jassert (startSample >= 0 && numSamples >= 0 && startSample + numSamples <= size);
 
-                const auto increment = (endGain - startGain) / (float) numSamples;
                 auto* d = channels[channel] + startSample;
-
-                while (--numSamples >= 0)
-                {
-                    *d++ *= startGain;
-                    startGain += increment;
-                }
+                FloatVectorOperations::multiplyWithRamp (d, d, startGain, endGain, numSamples);
             }
         }
     }
@@ -911,14 +905,16 @@ public:
 
             if (numSamples > 0)
             {
-                isClear = false;
-                const auto increment = (endGain - startGain) / (Type) numSamples;
                 auto* d = channels[destChannel] + destStartSample;
 
-                while (--numSamples >= 0)
+                if (isClear)
+                {
+                    isClear = false;
+                    FloatVectorOperations::multiplyWithRamp (d, source, startGain, endGain, numSamples);
+                }
+                else
                 {
-                    *d++ += startGain * *source++;
-                    startGain += increment;
+                    FloatVectorOperations::addWithRamp (d, source, startGain, endGain, numSamples);
                 }
             }
         }
@@ -1084,14 +1080,8 @@ public:
             if (numSamples > 0)
             {
                 isClear = false;
-                const auto increment = (endGain - startGain) / (Type) numSamples;
-                auto* d = channels[destChannel] + destStartSample;
-
-                while (--numSamples >= 0)
-                {
-                    *d++ = startGain * *source++;
-                    startGain += increment;
-                }
+                FloatVectorOperations::multiplyWithRamp (channels[destChannel] + destStartSample,
+                                                         source, startGain, endGain, numSamples);
             }
         }
     }
@@ -1151,11 +1141,11 @@ public:
         auto* data = channels[channel] + startSample;
         double sum = 0.0;
 
-        for (int i = 0; i < numSamples; ++i)
-        {
-            auto sample = data[i];
-            sum += sample * sample;
-        }
+        // Float squares are summed as doubles, so long sections don't lose precision
+        if constexpr (std::is_same_v<Type, float>)
+            sum = FloatVectorOperations::sumOfSquaresAsDouble (data, numSamples);
+        else
+            sum = FloatVectorOperations::sumOfSquares (data, numSamples);
 
         return static_cast<Type> (std::sqrt (sum / numSamples));
     }
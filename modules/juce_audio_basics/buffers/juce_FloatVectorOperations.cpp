@@ -65,6 +65,25 @@ namespace FloatVectorHelpers
 
         static forcedinline Type max (ParallelType a) noexcept { Type v[numParallel]; storeU (v, a); return jmax (v[0], v[1], v[2], v[3]); }
         static forcedinline Type min (ParallelType a) noexcept { Type v[numParallel]; storeU (v, a); return jmin (v[0], v[1], v[2], v[3]); }
+        static forcedinline Type sum (ParallelType a) noexcept { Type v[numParallel]; storeU (v, a); return (v[0] + v[1]) + (v[2] + v[3]); }
+
+        static forcedinline void interleaveU (Type* dest, ParallelType a, ParallelType b) noexcept
+        {
+            storeU (dest,               _mm_unpacklo_ps (a, b));
+            storeU (dest + numParallel, _mm_unpackhi_ps (a, b));
+        }
+
+        static forcedinline void deinterleaveU (const Type* src, ParallelType& a, ParallelType& b) noexcept
+        {
+            const auto lo = loadU (src), hi = loadU (src + numParallel);
+            a = _mm_shuffle_ps (lo, hi, _MM_SHUFFLE (2, 0, 2, 0));
+            b = _mm_shuffle_ps (lo, hi, _MM_SHUFFLE (3, 1, 3, 1));
+        }
+
+        static forcedinline void transpose (ParallelType& a, ParallelType& b, ParallelType& c, ParallelType& d) noexcept
+        {
+            _MM_TRANSPOSE4_PS (a, b, c, d);
+        }
     };
 
     struct BasicOps64
@@ -97,6 +116,20 @@ namespace FloatVectorHelpers
 
         static forcedinline Type max (ParallelType a) noexcept  { Type v[numParallel]; storeU (v, a); return jmax (v[0], v[1]); }
         static forcedinline Type min (ParallelType a) noexcept  { Type v[numParallel]; storeU (v, a); return jmin (v[0], v[1]); }
+        static forcedinline Type sum (ParallelType a) noexcept  { Type v[numParallel]; storeU (v, a); return v[0] + v[1]; }
+
+        static forcedinline void interleaveU (Type* dest, ParallelType a, ParallelType b) noexcept
+        {
+            storeU (dest,               _mm_unpacklo_pd (a, b));
+            storeU (dest + numParallel, _mm_unpackhi_pd (a, b));
+        }
+
+        static forcedinline void deinterleaveU (const Type* src, ParallelType& a, ParallelType& b) noexcept
+        {
+            const auto lo = loadU (src), hi = loadU (src + numParallel);
+            a = _mm_unpacklo_pd (lo, hi);
+            b = _mm_unpackhi_pd (lo, hi);
+        }
     };
 
 
@@ -230,6 +263,19 @@ namespace FloatVectorHelpers
 
         static forcedinline Type max (ParallelType a) noexcept { Type v[numParallel]; storeU (v, a); return jmax (v[0], v[1], v[2], v[3]); }
         static forcedinline Type min (ParallelType a) noexcept { Type v[numParallel]; storeU (v, a); return jmin (v[0], v[1], v[2], v[3]); }
+        static forcedinline Type sum (ParallelType a) noexcept { Type v[numParallel]; storeU (v, a); return (v[0] + v[1]) + (v[2] + v[3]); }
+
+        static forcedinline void interleaveU (Type* dest, ParallelType a, ParallelType b) noexcept           { vst2q_f32 (dest, (float32x4x2_t { { a, b } })); }
+        static forcedinline void deinterleaveU (const Type* src, ParallelType& a, ParallelType& b) noexcept  { const auto v = vld2q_f32 (src); a = v.val[0]; b = v.val[1]; }
+
+        static forcedinline void transpose (ParallelType& a, ParallelType& b, ParallelType& c, ParallelType& d) noexcept
+        {
+            const auto ab = vtrnq_f32 (a, b), cd = vtrnq_f32 (c, d);
+            a = vcombine_f32 (vget_low_f32  (ab.val[0]), vget_low_f32  (cd.val[0]));
+            b = vcombine_f32 (vget_low_f32  (ab.val[1]), vget_low_f32  (cd.val[1]));
+            c = vcombine_f32 (vget_high_f32 (ab.val[0]), vget_high_f32 (cd.val[0]));
+            d = vcombine_f32 (vget_high_f32 (ab.val[1]), vget_high_f32 (cd.val[1]));
+        }
     };
 
     struct BasicOps64
@@ -262,6 +308,10 @@ namespace FloatVectorHelpers
 
         static forcedinline Type max (ParallelType a) noexcept  { return a; }
         static forcedinline Type min (ParallelType a) noexcept  { return a; }
+        static forcedinline Type sum (ParallelType a) noexcept  { return a; }
+
+        static forcedinline void interleaveU (Type* dest, ParallelType a, ParallelType b) noexcept           { dest[0] = a; dest[1] = b; }
+        static forcedinline void deinterleaveU (const Type* src, ParallelType& a, ParallelType& b) noexcept  { a = src[0]; b = src[1]; }
     };
 
     #define JUCE_BEGIN_VEC_OP \
@@ -489,6 +539,424 @@ namespace FloatVectorHelpers
             return Range<Type>::findMinAndMax (src, num);
         }
     };
+
+    template <typename Mode>
+    struct Accumulate
+    {
+        using Type = typename Mode::Type;
+
+        template <typename Size>
+        static Type dotProduct (const Type* src1, const Type* src2, Size num) noexcept
+        {
+            constexpr auto numParallel = (Size) Mode::numParallel;
+
+            // Two independent accumulators, so that each add doesn't have to wait for the last one
+            auto sum1 = Mode::load1 (Type (0));
+            auto sum2 = sum1;
+            Size i = 0;
+
+            for (; i + 2 * numParallel <= num; i += 2 * numParallel)
+            {
+                sum1 = Mode::add (sum1, Mode::mul (Mode::loadU (src1 + i),               Mode::loadU (src2 + i)));
+                sum2 = Mode::add (sum2, Mode::mul (Mode::loadU (src1 + i + numParallel), Mode::loadU (src2 + i + numParallel)));
+            }
+
+            for (; i + numParallel <= num; i += numParallel)
+                sum1 = Mode::add (sum1, Mode::mul (Mode::loadU (src1 + i), Mode::loadU (src2 + i)));
+
+            auto result = Mode::sum (Mode::add (sum1, sum2));
+
+            for (; i < num; ++i)
+                result += src1[i] * src2[i];
+
+            return result;
+        }
+    };
+
+    template <typename Mode>
+    struct GainRamp
+    {
+        using Type = typename Mode::Type;
+        using ParallelType = typename Mode::ParallelType;
+
+        // Calls vecOp (index, gains) for each complete group of values, then normalOp (index, gain) for
+        // the remainder. Each gain is calculated from its index rather than by accumulating the increment.
+        template <typename Size, typename VecOp, typename NormalOp>
+        static void process (Type startGain, Type increment, Size num, VecOp&& vecOp, NormalOp&& normalOp) noexcept
+        {
+            constexpr auto numParallel = (Size) Mode::numParallel;
+
+            Type offsets[Mode::numParallel];
+
+            for (int j = 0; j < Mode::numParallel; ++j)
+                offsets[j] = (Type) j * increment;
+
+            const auto laneOffsets = Mode::loadU (offsets);
+            Size i = 0;
+
+            for (; i + numParallel <= num; i += numParallel)
+                vecOp (i, Mode::add (Mode::load1 (startGain + (Type) i * increment), laneOffsets));
+
+            for (; i < num; ++i)
+                normalOp (i, startGain + (Type) i * increment);
+        }
+    };
+   #endif
+
+    //==============================================================================
+   #if JUCE_USE_AVX_INTRINSICS
+    // The wider kernels are compiled for their own instruction sets, whatever the rest of
+    // the module is built for, and are only ever called after checking the CPU supports them.
+    #if JUCE_MSVC && ! JUCE_CLANG
+     #define JUCE_AVX2_TARGET
+     #define JUCE_AVX512_TARGET
+    #else
+     #define JUCE_AVX2_TARGET     __attribute__ ((target ("avx2")))
+     #define JUCE_AVX512_TARGET   __attribute__ ((target ("avx512f,avx2")))
+    #endif
+
+    struct Avx2Ops32
+    {
+        using Type = float;
+        using ParallelType = __m256;
+        enum { numParallel = 8 };
+
+        JUCE_AVX2_TARGET static forcedinline ParallelType load1 (Type v) noexcept                        { return _mm256_set1_ps (v); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType loadU (const Type* v) noexcept                 { return _mm256_loadu_ps (v); }
+        JUCE_AVX2_TARGET static forcedinline void storeU (Type* dest, ParallelType a) noexcept           { _mm256_storeu_ps (dest, a); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType loadInt (const int* v) noexcept                { return _mm256_cvtepi32_ps (_mm256_loadu_si256 (reinterpret_cast<const __m256i*> (v))); }
+
+        JUCE_AVX2_TARGET static forcedinline ParallelType add (ParallelType a, ParallelType b) noexcept  { return _mm256_add_ps (a, b); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType mul (ParallelType a, ParallelType b) noexcept  { return _mm256_mul_ps (a, b); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm256_max_ps (a, b); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm256_min_ps (a, b); }
+
+        JUCE_AVX2_TARGET static forcedinline Type addProduct (Type a, Type b, Type c) noexcept           { return a + b * c; }
+    };
+
+    struct Avx2Ops64
+    {
+        using Type = double;
+        using ParallelType = __m256d;
+        enum { numParallel = 4 };
+
+        JUCE_AVX2_TARGET static forcedinline ParallelType load1 (Type v) noexcept                        { return _mm256_set1_pd (v); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType loadU (const Type* v) noexcept                 { return _mm256_loadu_pd (v); }
+        JUCE_AVX2_TARGET static forcedinline void storeU (Type* dest, ParallelType a) noexcept           { _mm256_storeu_pd (dest, a); }
+
+        JUCE_AVX2_TARGET static forcedinline ParallelType add (ParallelType a, ParallelType b) noexcept  { return _mm256_add_pd (a, b); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType mul (ParallelType a, ParallelType b) noexcept  { return _mm256_mul_pd (a, b); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm256_max_pd (a, b); }
+        JUCE_AVX2_TARGET static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm256_min_pd (a, b); }
+
+        JUCE_AVX2_TARGET static forcedinline Type addProduct (Type a, Type b, Type c) noexcept           { return a + b * c; }
+    };
+
+    // AVX-512 implies FMA support, so the explicitly-rounded forms of add and mul are used to
+    // stop the compiler contracting them into fused multiply-adds, which would round differently.
+    struct Avx512Ops32
+    {
+        using Type = float;
+        using ParallelType = __m512;
+        enum { numParallel = 16 };
+
+        JUCE_AVX512_TARGET static forcedinline ParallelType load1 (Type v) noexcept                        { return _mm512_set1_ps (v); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType loadU (const Type* v) noexcept                 { return _mm512_loadu_ps (v); }
+        JUCE_AVX512_TARGET static forcedinline void storeU (Type* dest, ParallelType a) noexcept           { _mm512_storeu_ps (dest, a); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType loadInt (const int* v) noexcept                { return _mm512_cvtepi32_ps (_mm512_loadu_si512 (v)); }
+
+        JUCE_AVX512_TARGET static forcedinline ParallelType add (ParallelType a, ParallelType b) noexcept  { return _mm512_add_round_ps (a, b, _MM_FROUND_CUR_DIRECTION); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType mul (ParallelType a, ParallelType b) noexcept  { return _mm512_mul_round_ps (a, b, _MM_FROUND_CUR_DIRECTION); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm512_max_ps (a, b); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm512_min_ps (a, b); }
+
+        JUCE_AVX512_TARGET static forcedinline Type addProduct (Type a, Type b, Type c) noexcept
+        {
+            return _mm_cvtss_f32 (_mm_add_round_ss (_mm_set_ss (a),
+                                                    _mm_mul_round_ss (_mm_set_ss (b), _mm_set_ss (c), _MM_FROUND_CUR_DIRECTION),
+                                                    _MM_FROUND_CUR_DIRECTION));
+        }
+    };
+
+    struct Avx512Ops64
+    {
+        using Type = double;
+        using ParallelType = __m512d;
+        enum { numParallel = 8 };
+
+        JUCE_AVX512_TARGET static forcedinline ParallelType load1 (Type v) noexcept                        { return _mm512_set1_pd (v); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType loadU (const Type* v) noexcept                 { return _mm512_loadu_pd (v); }
+        JUCE_AVX512_TARGET static forcedinline void storeU (Type* dest, ParallelType a) noexcept           { _mm512_storeu_pd (dest, a); }
+
+        JUCE_AVX512_TARGET static forcedinline ParallelType add (ParallelType a, ParallelType b) noexcept  { return _mm512_add_round_pd (a, b, _MM_FROUND_CUR_DIRECTION); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType mul (ParallelType a, ParallelType b) noexcept  { return _mm512_mul_round_pd (a, b, _MM_FROUND_CUR_DIRECTION); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm512_max_pd (a, b); }
+        JUCE_AVX512_TARGET static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm512_min_pd (a, b); }
+
+        JUCE_AVX512_TARGET static forcedinline Type addProduct (Type a, Type b, Type c) noexcept
+        {
+            return _mm_cvtsd_f64 (_mm_add_round_sd (_mm_set_sd (a),
+                                                    _mm_mul_round_sd (_mm_set_sd (b), _mm_set_sd (c), _MM_FROUND_CUR_DIRECTION),
+                                                    _MM_FROUND_CUR_DIRECTION));
+        }
+    };
+
+    // Each set of kernels must be compiled with its own target attribute, so this macro
+    // stamps out the same code for each instruction set. The arithmetic is performed in the
+    // same order as the baseline code (and without fused multiply-adds), so that the
+    // results are identical.
+    #define JUCE_WIDE_VEC_LOOP(vecOp, normalOp) \
+        size_t i = 0; \
+        for (; i + (size_t) Ops::numParallel <= num; i += (size_t) Ops::numParallel) \
+            { vecOp; } \
+        for (; i < num; ++i) \
+            { normalOp; }
+
+    #define JUCE_DECLARE_WIDE_VECTOR_KERNELS(Name, Target) \
+        template <typename Ops> \
+        struct Name \
+        { \
+            using Type = typename Ops::Type; \
+            \
+            Target static void add (Type* dest, const Type* src, size_t num) noexcept \
+            { \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::add (Ops::loadU (dest + i), Ops::loadU (src + i))), \
+                                    dest[i] += src[i]) \
+            } \
+            \
+            Target static void add (Type* dest, const Type* src1, const Type* src2, size_t num) noexcept \
+            { \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::add (Ops::loadU (src1 + i), Ops::loadU (src2 + i))), \
+                                    dest[i] = src1[i] + src2[i]) \
+            } \
+            \
+            Target static void multiply (Type* dest, const Type* src, size_t num) noexcept \
+            { \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::mul (Ops::loadU (dest + i), Ops::loadU (src + i))), \
+                                    dest[i] *= src[i]) \
+            } \
+            \
+            Target static void multiply (Type* dest, const Type* src1, const Type* src2, size_t num) noexcept \
+            { \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::mul (Ops::loadU (src1 + i), Ops::loadU (src2 + i))), \
+                                    dest[i] = src1[i] * src2[i]) \
+            } \
+            \
+            Target static void multiply (Type* dest, Type multiplier, size_t num) noexcept \
+            { \
+                const auto mult = Ops::load1 (multiplier); \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::mul (Ops::loadU (dest + i), mult)), \
+                                    dest[i] *= multiplier) \
+            } \
+            \
+            Target static void addWithMultiply (Type* dest, const Type* src, Type multiplier, size_t num) noexcept \
+            { \
+                const auto mult = Ops::load1 (multiplier); \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::add (Ops::loadU (dest + i), Ops::mul (mult, Ops::loadU (src + i)))), \
+                                    dest[i] = Ops::addProduct (dest[i], src[i], multiplier)) \
+            } \
+            \
+            Target static void addWithMultiply (Type* dest, const Type* src1, const Type* src2, size_t num) noexcept \
+            { \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::add (Ops::loadU (dest + i), Ops::mul (Ops::loadU (src1 + i), Ops::loadU (src2 + i)))), \
+                                    dest[i] = Ops::addProduct (dest[i], src1[i], src2[i])) \
+            } \
+            \
+            Target static void clip (Type* dest, const Type* src, Type low, Type high, size_t num) noexcept \
+            { \
+                const auto lo = Ops::load1 (low); \
+                const auto hi = Ops::load1 (high); \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::max (Ops::min (Ops::loadU (src + i), hi), lo)), \
+                                    dest[i] = jmax (jmin (src[i], high), low)) \
+            } \
+            \
+            Target static Range<Type> findMinAndMax (const Type* src, size_t num) noexcept \
+            { \
+                if (num < (size_t) Ops::numParallel) \
+                    return Range<Type>::findMinAndMax (src, (int) num); \
+                \
+                auto mn = Ops::loadU (src); \
+                auto mx = mn; \
+                \
+                JUCE_WIDE_VEC_LOOP (mn = Ops::min (mn, Ops::loadU (src + i)); mx = Ops::max (mx, Ops::loadU (src + i)), \
+                                    mn = Ops::min (mn, Ops::load1 (src[i])); mx = Ops::max (mx, Ops::load1 (src[i]))) \
+                \
+                Type mins[Ops::numParallel], maxs[Ops::numParallel]; \
+                Ops::storeU (mins, mn); \
+                Ops::storeU (maxs, mx); \
+                \
+                return { juce::findMinimum (mins, (int) Ops::numParallel), \
+                         juce::findMaximum (maxs, (int) Ops::numParallel) }; \
+            } \
+            \
+            Target static void convertFixedToFloat (float* dest, const int* src, float multiplier, size_t num) noexcept \
+            { \
+                const auto mult = Ops::load1 (multiplier); \
+                JUCE_WIDE_VEC_LOOP (Ops::storeU (dest + i, Ops::mul (mult, Ops::loadInt (src + i))), \
+                                    dest[i] = (float) src[i] * multiplier) \
+            } \
+        };
+
+    JUCE_DECLARE_WIDE_VECTOR_KERNELS (Avx2Kernels, JUCE_AVX2_TARGET)
+    JUCE_DECLARE_WIDE_VECTOR_KERNELS (Avx512Kernels, JUCE_AVX512_TARGET)
+
+    #undef JUCE_DECLARE_WIDE_VECTOR_KERNELS
+    #undef JUCE_WIDE_VEC_LOOP
+    #undef JUCE_AVX2_TARGET
+    #undef JUCE_AVX512_TARGET
+
+    template <typename Type>
+    struct WideVectorKernelTable
+    {
+        void (*add) (Type*, const Type*, size_t) noexcept;
+        void (*addTwo) (Type*, const Type*, const Type*, size_t) noexcept;
+        void (*multiply) (Type*, const Type*, size_t) noexcept;
+        void (*multiplyTwo) (Type*, const Type*, const Type*, size_t) noexcept;
+        void (*multiplyScalar) (Type*, Type, size_t) noexcept;
+        void (*addWithMultiply) (Type*, const Type*, Type, size_t) noexcept;
+        void (*addWithMultiplyTwo) (Type*, const Type*, const Type*, size_t) noexcept;
+        void (*clip) (Type*, const Type*, Type, Type, size_t) noexcept;
+        Range<Type> (*findMinAndMax) (const Type*, size_t) noexcept;
+        void (*convertFixedToFloat) (float*, const int*, float, size_t) noexcept;
+
+        template <typename Kernels>
+        static WideVectorKernelTable create() noexcept
+        {
+            WideVectorKernelTable table;
+            table.add                   = Kernels::add;
+            table.addTwo                = Kernels::add;
+            table.multiply              = Kernels::multiply;
+            table.multiplyTwo           = Kernels::multiply;
+            table.multiplyScalar        = Kernels::multiply;
+            table.addWithMultiply       = Kernels::addWithMultiply;
+            table.addWithMultiplyTwo    = Kernels::addWithMultiply;
+            table.clip                  = Kernels::clip;
+            table.findMinAndMax         = Kernels::findMinAndMax;
+            table.convertFixedToFloat   = nullptr;
+
+            if constexpr (std::is_same_v<Type, float>)
+                table.convertFixedToFloat = Kernels::convertFixedToFloat;
+
+            return table;
+        }
+    };
+
+    /*  CPUID only reports what the processor can do. The OS (or hypervisor) must also have
+        enabled saving of the wider register state, which it reports in XCR0, otherwise the
+        first wide instruction raises an invalid-opcode fault.
+    */
+    struct EnabledRegisterState
+    {
+        static bool hasAVX() noexcept      { return (getXCR0() & avxStateMask) == avxStateMask; }
+        static bool hasAVX512() noexcept   { return (getXCR0() & avx512StateMask) == avx512StateMask; }
+
+    private:
+        static constexpr uint64 avxStateMask    = 0x06;                 // SSE and AVX (bits 1, 2)
+        static constexpr uint64 avx512StateMask = avxStateMask | 0xe0;  // plus opmask, ZMM_Hi256 and Hi16_ZMM (bits 5 - 7)
+
+        static uint64 getXCR0() noexcept
+        {
+            constexpr unsigned int osxsaveBit = 1u << 27;
+
+           #if JUCE_MSVC && ! JUCE_CLANG
+            int info[4] = {};
+            __cpuid (info, 1);
+
+            if ((((unsigned int) info[2]) & osxsaveBit) == 0)
+                return 0;
+
+            return (uint64) _xgetbv (0);
+           #else
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+            if (! __get_cpuid (1, &eax, &ebx, &ecx, &edx) || (ecx & osxsaveBit) == 0)
+                return 0;
+
+            unsigned int low = 0, high = 0;
+            __asm__ volatile ("xgetbv" : "=a" (low), "=d" (high) : "c" (0));
+            return ((uint64) high << 32) | low;
+           #endif
+        }
+    };
+
+    class WideVectorDispatcher
+    {
+    public:
+        using InstructionSet = FloatVectorOperations::InstructionSet;
+
+        static WideVectorDispatcher& getInstance() noexcept
+        {
+            static WideVectorDispatcher instance;
+            return instance;
+        }
+
+        InstructionSet select (InstructionSet maximum) noexcept
+        {
+            auto instructionSet = InstructionSet::baseline;
+            const WideVectorKernelTable<float>* newFloatKernels = nullptr;
+            const WideVectorKernelTable<double>* newDoubleKernels = nullptr;
+
+            if (maximum >= InstructionSet::avx512 && SystemStats::hasAVX512F() && EnabledRegisterState::hasAVX512())
+            {
+                instructionSet = InstructionSet::avx512;
+                newFloatKernels = &avx512Float;
+                newDoubleKernels = &avx512Double;
+            }
+            else if (maximum >= InstructionSet::avx2 && SystemStats::hasAVX2() && EnabledRegisterState::hasAVX())
+            {
+                instructionSet = InstructionSet::avx2;
+                newFloatKernels = &avx2Float;
+                newDoubleKernels = &avx2Double;
+            }
+
+            floatKernels = newFloatKernels;
+            doubleKernels = newDoubleKernels;
+            current = instructionSet;
+            return instructionSet;
+        }
+
+        InstructionSet getInstructionSet() const noexcept     { return current; }
+
+        // Returns nullptr if the baseline kernels should be used
+        template <typename Type>
+        const WideVectorKernelTable<Type>* getKernels() const noexcept
+        {
+            if constexpr (std::is_same_v<Type, float>)
+                return floatKernels.load (std::memory_order_relaxed);
+            else
+                return doubleKernels.load (std::memory_order_relaxed);
+        }
+
+    private:
+        WideVectorDispatcher()    { select (InstructionSet::avx512); }
+
+        const WideVectorKernelTable<float>  avx2Float    = WideVectorKernelTable<float> ::create<Avx2Kernels<Avx2Ops32>>();
+        const WideVectorKernelTable<double> avx2Double   = WideVectorKernelTable<double>::create<Avx2Kernels<Avx2Ops64>>();
+        const WideVectorKernelTable<float>  avx512Float  = WideVectorKernelTable<float> ::create<Avx512Kernels<Avx512Ops32>>();
+        const WideVectorKernelTable<double> avx512Double = WideVectorKernelTable<double>::create<Avx512Kernels<Avx512Ops64>>();
+
+        std::atomic<const WideVectorKernelTable<float>*> floatKernels { nullptr };
+        std::atomic<const WideVectorKernelTable<double>*> doubleKernels { nullptr };
+        std::atomic<InstructionSet> current { InstructionSet::baseline };
+    };
+
+    // Below this size, the cost of the indirect call outweighs the gain from the wider registers.
+    // The comparison is done in the caller's own type, so that a negative int can't become a
+    // huge size_t and run a wide kernel off the end of the buffers.
+    template <typename Type, typename Size>
+    const WideVectorKernelTable<Type>* getWideVectorKernels (Size num) noexcept
+    {
+        if (num < (Size) 32)
+            return nullptr;
+
+        return WideVectorDispatcher::getInstance().getKernels<Type>();
+    }
+
+    #define JUCE_DISPATCH_WIDE_VECTOR_OP(Type, kernel, ...) \
+        if (auto* wideKernels = getWideVectorKernels<Type> (num)) \
+            return wideKernels->kernel (__VA_ARGS__, (size_t) num);
+   #else
+    #define JUCE_DISPATCH_WIDE_VECTOR_OP(Type, kernel, ...)
    #endif
 
 //==============================================================================
@@ -624,6 +1092,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vadd (src, 1, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, add, dest, src)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i],
                                       Mode::add (d, s),
                                       JUCE_LOAD_SRC_DEST,
@@ -637,6 +1106,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vaddD (src, 1, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, add, dest, src)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i],
                                       Mode::add (d, s),
                                       JUCE_LOAD_SRC_DEST,
@@ -650,6 +1120,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vadd (src1, 1, src2, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, addTwo, dest, src1, src2)
         JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST (dest[i] = src1[i] + src2[i],
                                             Mode::add (s1, s2),
                                             JUCE_LOAD_SRC1_SRC2,
@@ -663,6 +1134,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vaddD (src1, 1, src2, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, addTwo, dest, src1, src2)
         JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST (dest[i] = src1[i] + src2[i],
                                             Mode::add (s1, s2),
                                             JUCE_LOAD_SRC1_SRC2,
@@ -728,6 +1200,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vsma (src, 1, &multiplier, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, addWithMultiply, dest, src, multiplier)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i] * multiplier,
                                       Mode::add (d, Mode::mul (mult, s)),
                                       JUCE_LOAD_SRC_DEST,
@@ -742,6 +1215,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vsmaD (src, 1, &multiplier, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, addWithMultiply, dest, src, multiplier)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i] * multiplier,
                                       Mode::add (d, Mode::mul (mult, s)),
                                       JUCE_LOAD_SRC_DEST,
@@ -756,6 +1230,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vma ((float*) src1, 1, (float*) src2, 1, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, addWithMultiplyTwo, dest, src1, src2)
         JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] += src1[i] * src2[i],
                                                  Mode::add (d, Mode::mul (s1, s2)),
                                                  JUCE_LOAD_SRC1_SRC2_DEST,
@@ -769,6 +1244,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vmaD ((double*) src1, 1, (double*) src2, 1, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, addWithMultiplyTwo, dest, src1, src2)
         JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] += src1[i] * src2[i],
                                                  Mode::add (d, Mode::mul (s1, s2)),
                                                  JUCE_LOAD_SRC1_SRC2_DEST,
@@ -820,6 +1296,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vmul (src, 1, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, multiply, dest, src)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] *= src[i],
                                       Mode::mul (d, s),
                                       JUCE_LOAD_SRC_DEST,
@@ -833,6 +1310,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vmulD (src, 1, dest, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, multiply, dest, src)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] *= src[i],
                                       Mode::mul (d, s),
                                       JUCE_LOAD_SRC_DEST,
@@ -846,6 +1324,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vmul (src1, 1, src2, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, multiplyTwo, dest, src1, src2)
         JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST (dest[i] = src1[i] * src2[i],
                                             Mode::mul (s1, s2),
                                             JUCE_LOAD_SRC1_SRC2,
@@ -859,6 +1338,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vmulD (src1, 1, src2, 1, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, multiplyTwo, dest, src1, src2)
         JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST (dest[i] = src1[i] * src2[i],
                                             Mode::mul (s1, s2),
                                             JUCE_LOAD_SRC1_SRC2,
@@ -872,6 +1352,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vsmul (dest, 1, &multiplier, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, multiplyScalar, dest, multiplier)
         JUCE_PERFORM_VEC_OP_DEST (dest[i] *= multiplier,
                                   Mode::mul (d, mult),
                                   JUCE_LOAD_DEST,
@@ -885,6 +1366,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vsmulD (dest, 1, &multiplier, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, multiplyScalar, dest, multiplier)
         JUCE_PERFORM_VEC_OP_DEST (dest[i] *= multiplier,
                                   Mode::mul (d, mult),
                                   JUCE_LOAD_DEST,
@@ -1065,6 +1547,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vclip ((float*) src, 1, &low, &high, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, clip, dest, src, low, high)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] = jmax (jmin (src[i], high), low),
                                       Mode::max (Mode::min (s, hi), lo),
                                       JUCE_LOAD_SRC,
@@ -1082,6 +1565,7 @@ namespace
        #if JUCE_USE_VDSP_FRAMEWORK
         vDSP_vclipD ((double*) src, 1, &low, &high, dest, 1, (vDSP_Length) num);
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, clip, dest, src, low, high)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] = jmax (jmin (src[i], high), low),
                                       Mode::max (Mode::min (s, hi), lo),
                                       JUCE_LOAD_SRC,
@@ -1095,6 +1579,7 @@ namespace
     Range<float> findMinAndMax (const float* src, Size num) noexcept
     {
        #if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, findMinAndMax, src)
         return FloatVectorHelpers::MinMax<FloatVectorHelpers::BasicOps32>::findMinAndMax (src, num);
        #else
         return Range<float>::findMinAndMax (src, num);
@@ -1105,6 +1590,7 @@ namespace
     Range<double> findMinAndMax (const double* src, Size num) noexcept
     {
        #if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON
+        JUCE_DISPATCH_WIDE_VECTOR_OP (double, findMinAndMax, src)
         return FloatVectorHelpers::MinMax<FloatVectorHelpers::BasicOps64>::findMinAndMax (src, num);
        #else
         return Range<double>::findMinAndMax (src, num);
@@ -1160,6 +1646,7 @@ namespace
                                   JUCE_LOAD_NONE,
                                   JUCE_INCREMENT_SRC_DEST, )
        #else
+        JUCE_DISPATCH_WIDE_VECTOR_OP (float, convertFixedToFloat, dest, src, multiplier)
         JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] = (float) src[i] * multiplier,
                                       Mode::mul (mult, _mm_cvtepi32_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (src)))),
                                       JUCE_LOAD_NONE,
@@ -1168,7 +1655,216 @@ namespace
        #endif
     }
 
+
+    template <typename FloatType, typename Size>
+    FloatType dotProduct (const FloatType* src1, const FloatType* src2, Size num) noexcept
+    {
+       #if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON
+        return Accumulate<typename ModeType<sizeof (FloatType)>::Mode>::dotProduct (src1, src2, num);
+       #else
+        FloatType result = 0;
+
+        for (Size i = 0; i < num; ++i)
+            result += src1[i] * src2[i];
+
+        return result;
+       #endif
+    }
+
+    template <typename Size>
+    double sumOfSquaresAsDouble (const float* src, Size num) noexcept
+    {
+        Size i = 0;
+
+       #if JUCE_USE_SSE_INTRINSICS
+        auto sum1 = _mm_setzero_pd();
+        auto sum2 = sum1;
+
+        for (; i + 4 <= num; i += 4)
+        {
+            const auto v = _mm_loadu_ps (src + i);
+            const auto low  = _mm_cvtps_pd (v);
+            const auto high = _mm_cvtps_pd (_mm_movehl_ps (v, v));
+            sum1 = _mm_add_pd (sum1, _mm_mul_pd (low, low));
+            sum2 = _mm_add_pd (sum2, _mm_mul_pd (high, high));
+        }
+
+        const auto total = _mm_add_pd (sum1, sum2);
+        auto result = _mm_cvtsd_f64 (total) + _mm_cvtsd_f64 (_mm_unpackhi_pd (total, total));
+       #elif JUCE_USE_ARM_NEON && JUCE_64BIT
+        auto sum1 = vdupq_n_f64 (0.0);
+        auto sum2 = sum1;
+
+        for (; i + 4 <= num; i += 4)
+        {
+            const auto v = vld1q_f32 (src + i);
+            const auto low  = vcvt_f64_f32 (vget_low_f32 (v));
+            const auto high = vcvt_high_f64_f32 (v);
+            sum1 = vaddq_f64 (sum1, vmulq_f64 (low, low));
+            sum2 = vaddq_f64 (sum2, vmulq_f64 (high, high));
+        }
+
+        auto result = vaddvq_f64 (vaddq_f64 (sum1, sum2));
+       #else
+        auto result = 0.0;
+       #endif
+
+        for (; i < num; ++i)
+            result += (double) src[i] * (double) src[i];
+
+        return result;
+    }
+
+    template <typename FloatType, typename Size>
+    void multiplyWithRamp (FloatType* dest, const FloatType* src, FloatType startGain, FloatType endGain, Size num) noexcept
+    {
+        if (num == 0)
+            return;
+
+        const auto increment = (endGain - startGain) / (FloatType) num;
+
+       #if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON
+        using Mode = typename ModeType<sizeof (FloatType)>::Mode;
+
+        GainRamp<Mode>::process (startGain, increment, num,
+                                 [&] (Size i, typename Mode::ParallelType gains) { Mode::storeU (dest + i, Mode::mul (Mode::loadU (src + i), gains)); },
+                                 [&] (Size i, FloatType gain)                    { dest[i] = src[i] * gain; });
+       #else
+        for (Size i = 0; i < num; ++i)
+            dest[i] = src[i] * (startGain + (FloatType) i * increment);
+       #endif
+    }
+
+    template <typename FloatType, typename Size>
+    void addWithRamp (FloatType* dest, const FloatType* src, FloatType startGain, FloatType endGain, Size num) noexcept
+    {
+        if (num == 0)
+            return;
+
+        const auto increment = (endGain - startGain) / (FloatType) num;
+
+       #if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON
+        using Mode = typename ModeType<sizeof (FloatType)>::Mode;
+
+        GainRamp<Mode>::process (startGain, increment, num,
+                                 [&] (Size i, typename Mode::ParallelType gains) { Mode::storeU (dest + i, Mode::add (Mode::loadU (dest + i), Mode::mul (Mode::loadU (src + i), gains))); },
+                                 [&] (Size i, FloatType gain)                    { dest[i] += src[i] * gain; });
+       #else
+        for (Size i = 0; i < num; ++i)
+            dest[i] += src[i] * (startGain + (FloatType) i * increment);
+       #endif
+    }
+
+    template <typename FloatType, typename Size>
+    void interleave (FloatType* dest, const FloatType* const* src, int numChannels, Size num) noexcept
+    {
+        Size start = 0;
+
+       #if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON
+        using Mode = typename ModeType<sizeof (FloatType)>::Mode;
+        constexpr auto numParallel = (Size) Mode::numParallel;
+
+        if (numChannels == 2)
+        {
+            for (; start + numParallel <= num; start += numParallel)
+                Mode::interleaveU (dest + 2 * start, Mode::loadU (src[0] + start), Mode::loadU (src[1] + start));
+        }
+        else if constexpr (Mode::numParallel == 4)
+        {
+            // Groups of four channels are interleaved by transposing 4x4 blocks of samples
+            if (numChannels % 4 == 0)
+            {
+                const auto stride = (size_t) numChannels;
+
+                for (; start + numParallel <= num; start += numParallel)
+                {
+                    for (int group = 0; group < numChannels; group += 4)
+                    {
+                        auto a = Mode::loadU (src[group]     + start);
+                        auto b = Mode::loadU (src[group + 1] + start);
+                        auto c = Mode::loadU (src[group + 2] + start);
+                        auto d = Mode::loadU (src[group + 3] + start);
+                        Mode::transpose (a, b, c, d);
+
+                        auto* frame = dest + (size_t) start * stride + (size_t) group;
+                        Mode::storeU (frame,              a);
+                        Mode::storeU (frame + stride,     b);
+                        Mode::storeU (frame + stride * 2, c);
+                        Mode::storeU (frame + stride * 3, d);
+                    }
+                }
+            }
+        }
+       #endif
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const auto* s = src[channel];
+
+            for (auto i = start; i < num; ++i)
+                dest[(size_t) i * (size_t) numChannels + (size_t) channel] = s[i];
+        }
+    }
+
+    template <typename FloatType, typename Size>
+    void deinterleave (FloatType* const* dest, const FloatType* src, int numChannels, Size num) noexcept
+    {
+        Size start = 0;
+
+       #if JUCE_USE_SSE_INTRINSICS || JUCE_USE_ARM_NEON
+        using Mode = typename ModeType<sizeof (FloatType)>::Mode;
+        constexpr auto numParallel = (Size) Mode::numParallel;
+
+        if (numChannels == 2)
+        {
+            for (; start + numParallel <= num; start += numParallel)
+            {
+                typename Mode::ParallelType left, right;
+                Mode::deinterleaveU (src + 2 * start, left, right);
+                Mode::storeU (dest[0] + start, left);
+                Mode::storeU (dest[1] + start, right);
+            }
+        }
+        else if constexpr (Mode::numParallel == 4)
+        {
+            if (numChannels % 4 == 0)
+            {
+                const auto stride = (size_t) numChannels;
+
+                for (; start + numParallel <= num; start += numParallel)
+                {
+                    for (int group = 0; group < numChannels; group += 4)
+                    {
+                        const auto* frame = src + (size_t) start * stride + (size_t) group;
+                        auto a = Mode::loadU (frame);
+                        auto b = Mode::loadU (frame + stride);
+                        auto c = Mode::loadU (frame + stride * 2);
+                        auto d = Mode::loadU (frame + stride * 3);
+                        Mode::transpose (a, b, c, d);
+
+                        Mode::storeU (dest[group]     + start, a);
+                        Mode::storeU (dest[group + 1] + start, b);
+                        Mode::storeU (dest[group + 2] + start, c);
+                        Mode::storeU (dest[group + 3] + start, d);
+                    }
+                }
+            }
+        }
+       #endif
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            auto* d = dest[channel];
+
+            for (auto i = start; i < num; ++i)
+                d[i] = src[(size_t) i * (size_t) numChannels + (size_t) channel];
+        }
+    }
+
 } // namespace
+
+#undef JUCE_DISPATCH_WIDE_VECTOR_OP
+
 } // namespace FloatVectorHelpers
 
 //==============================================================================
@@ -1408,6 +2104,59 @@ FloatType JUCE_CALLTYPE FloatVectorOperationsBase<FloatType, CountType>::findMax
     return FloatVectorHelpers::findMaximum (src, numValues);
 }
 
+template <typename FloatType, typename CountType>
+FloatType JUCE_CALLTYPE FloatVectorOperationsBase<FloatType, CountType>::dotProduct (const FloatType* src1,
+                                                                                     const FloatType* src2,
+                                                                                     CountType numValues) noexcept
+{
+    return FloatVectorHelpers::dotProduct (src1, src2, numValues);
+}
+
+template <typename FloatType, typename CountType>
+FloatType JUCE_CALLTYPE FloatVectorOperationsBase<FloatType, CountType>::sumOfSquares (const FloatType* src,
+                                                                                       CountType numValues) noexcept
+{
+    return FloatVectorHelpers::dotProduct (src, src, numValues);
+}
+
+template <typename FloatType, typename CountType>
+void JUCE_CALLTYPE FloatVectorOperationsBase<FloatType, CountType>::multiplyWithRamp (FloatType* dest,
+                                                                                      const FloatType* src,
+                                                                                      FloatType startGain,
+                                                                                      FloatType endGain,
+                                                                                      CountType numValues) noexcept
+{
+    FloatVectorHelpers::multiplyWithRamp (dest, src, startGain, endGain, numValues);
+}
+
+template <typename FloatType, typename CountType>
+void JUCE_CALLTYPE FloatVectorOperationsBase<FloatType, CountType>::addWithRamp (FloatType* dest,
+                                                                                 const FloatType* src,
+                                                                                 FloatType startGain,
+                                                                                 FloatType endGain,
+                                                                                 CountType numValues) noexcept
+{
+    FloatVectorHelpers::addWithRamp (dest, src, startGain, endGain, numValues);
+}
+
+template <typename FloatType, typename CountType>
+void JUCE_CALLTYPE FloatVectorOperationsBase<FloatType, CountType>::interleave (FloatType* dest,
+                                                                                const FloatType* const* src,
+                                                                                int numChannels,
+                                                                                CountType numSamples) noexcept
+{
+    FloatVectorHelpers::interleave (dest, src, numChannels, numSamples);
+}
+
+template <typename FloatType, typename CountType>
+void JUCE_CALLTYPE FloatVectorOperationsBase<FloatType, CountType>::deinterleave (FloatType* const* dest,
+                                                                                  const FloatType* src,
+                                                                                  int numChannels,
+                                                                                  CountType numSamples) noexcept
+{
+    FloatVectorHelpers::deinterleave (dest, src, numChannels, numSamples);
+}
+
 template struct FloatVectorOperationsBase<float, int>;
 template struct FloatVectorOperationsBase<float, size_t>;
 template struct FloatVectorOperationsBase<double, int>;
@@ -1423,6 +2172,16 @@ void JUCE_CALLTYPE FloatVectorOperations::convertFixedToFloat (float* dest, cons
     FloatVectorHelpers::convertFixedToFloat (dest, src, multiplier, num);
 }
 
+double JUCE_CALLTYPE FloatVectorOperations::sumOfSquaresAsDouble (const float* src, size_t num) noexcept
+{
+    return FloatVectorHelpers::sumOfSquaresAsDouble (src, num);
+}
+
+double JUCE_CALLTYPE FloatVectorOperations::sumOfSquaresAsDouble (const float* src, int num) noexcept
+{
+    return FloatVectorHelpers::sumOfSquaresAsDouble (src, num);
+}
+
 intptr_t JUCE_CALLTYPE FloatVectorOperations::getFpStatusRegister() noexcept
 {
     intptr_t fpsr = 0;
@@ -1529,6 +2288,24 @@ bool JUCE_CALLTYPE FloatVectorOperations::areDenormalsDisabled() noexcept
   #endif
 }
 
+FloatVectorOperations::InstructionSet JUCE_CALLTYPE FloatVectorOperations::getInstructionSet() noexcept
+{
+  #if JUCE_USE_AVX_INTRINSICS
+    return FloatVectorHelpers::WideVectorDispatcher::getInstance().getInstructionSet();
+  #else
+    return InstructionSet::baseline;
+  #endif
+}
+
+FloatVectorOperations::InstructionSet JUCE_CALLTYPE FloatVectorOperations::setMaximumInstructionSet ([[maybe_unused]] InstructionSet maximumToUse) noexcept
+{
+  #if JUCE_USE_AVX_INTRINSICS
+    return FloatVectorHelpers::WideVectorDispatcher::getInstance().select (maximumToUse);
+  #else
+    return InstructionSet::baseline;
+  #endif
+}
+
 ScopedNoDenormals::ScopedNoDenormals() noexcept
 {
   #if JUCE_USE_SSE_INTRINSICS || (JUCE_USE_ARM_NEON || (JUCE_64BIT && JUCE_ARM))
@@ -1644,6 +2421,129 @@ public:
             FloatVectorOperations::fill (data2, (ValueType) 3, num);
             FloatVectorOperations::addWithMultiply (data1, data1, data2, num);
             u.expect (areAllValuesEqual (data1, num, (ValueType) 8));
+
+            doAccumulationAndRampTests (u, random, data1, data2, num);
+            doInterleavingTest (u, random, num);
+        }
+
+        static void doAccumulationAndRampTests (UnitTest& u, Random& random, ValueType* data1, ValueType* data2, int num)
+        {
+            fillRandomly (random, data1, num);
+            fillRandomly (random, data2, num);
+
+            ValueType expectedDotProduct = 0, expectedSumOfSquares = 0;
+
+            for (int i = 0; i < num; ++i)
+            {
+                expectedDotProduct += data1[i] * data2[i];
+                expectedSumOfSquares += data1[i] * data1[i];
+            }
+
+            const auto tolerance = relativeTolerance ((ValueType) 1.0e-4);
+            u.expect (approximatelyEqual (FloatVectorOperations::dotProduct (data1, data2, num), expectedDotProduct, tolerance));
+            u.expect (approximatelyEqual (FloatVectorOperations::sumOfSquares (data1, num), expectedSumOfSquares, tolerance));
+
+            HeapBlock<ValueType> expected (num);
+            const ValueType startGain = (ValueType) 0.25, endGain = (ValueType) 2;
+            const auto increment = (endGain - startGain) / (ValueType) num;
+
+            for (int i = 0; i < num; ++i)
+                expected[i] = data2[i] + data1[i] * (startGain + (ValueType) i * increment);
+
+            FloatVectorOperations::addWithRamp (data2, data1, startGain, endGain, num);
+            u.expect (buffersMatch (data2, expected, num, tolerance));
+
+            for (int i = 0; i < num; ++i)
+                expected[i] = data1[i] * (startGain + (ValueType) i * increment);
+
+            FloatVectorOperations::multiplyWithRamp (data2, data1, startGain, endGain, num);
+            u.expect (buffersMatch (data2, expected, num, tolerance));
+        }
+
+        static void doInterleavingTest (UnitTest& u, Random& random, int num)
+        {
+            const int numChannels = random.nextInt ({ 1, 5 });
+
+            AudioBuffer<ValueType> original (numChannels, num), result (numChannels, num);
+            HeapBlock<ValueType> interleaved ((size_t) (numChannels * num));
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                fillRandomly (random, original.getWritePointer (channel), num);
+
+            FloatVectorOperations::interleave (interleaved.get(), original.getArrayOfReadPointers(), numChannels, num);
+
+            bool interleavedCorrectly = true;
+
+            for (int i = 0; i < num; ++i)
+                for (int channel = 0; channel < numChannels; ++channel)
+                    interleavedCorrectly &= exactlyEqual (interleaved[i * numChannels + channel], original.getSample (channel, i));
+
+            u.expect (interleavedCorrectly);
+
+            FloatVectorOperations::deinterleave (result.getArrayOfWritePointers(), interleaved.get(), numChannels, num);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                u.expect (std::memcmp (result.getReadPointer (channel), original.getReadPointer (channel), (size_t) num * sizeof (ValueType)) == 0);
+        }
+
+        static void runInstructionSetTest (UnitTest& u, Random random)
+        {
+            const int num = random.nextInt (1000) + 1;
+            const int offset = random.nextInt (8);
+
+            HeapBlock<ValueType> src1 (num + 8), src2 (num + 8);
+            HeapBlock<int> ints (num + 8);
+            fillRandomly (random, src1 + offset, num);
+            fillRandomly (random, src2 + offset, num);
+            fillRandomly (random, ints + offset, num);
+
+            const auto applyAllOps = [&] (ValueType* dest, Range<ValueType>& minMax)
+            {
+                const ValueType* s1 = src1 + offset;
+                const ValueType* s2 = src2 + offset;
+                const int sliceSize = num / 8;
+                auto* d = dest;
+
+                FloatVectorOperations::copy (d, s1, sliceSize);
+                FloatVectorOperations::add (d, s2, sliceSize);                                 d += sliceSize;
+                FloatVectorOperations::add (d, s1, s2, sliceSize);                             d += sliceSize;
+                FloatVectorOperations::copy (d, s1, sliceSize);
+                FloatVectorOperations::multiply (d, s2, sliceSize);
+                FloatVectorOperations::multiply (d, (ValueType) 0.37, sliceSize);              d += sliceSize;
+                FloatVectorOperations::multiply (d, s1, s2, sliceSize);                        d += sliceSize;
+                FloatVectorOperations::copy (d, s1, sliceSize);
+                FloatVectorOperations::addWithMultiply (d, s2, (ValueType) -1.3, sliceSize);   d += sliceSize;
+                FloatVectorOperations::copy (d, s2, sliceSize);
+                FloatVectorOperations::addWithMultiply (d, s1, s2, sliceSize);                 d += sliceSize;
+                FloatVectorOperations::clip (d, s1, (ValueType) 100, (ValueType) 600, sliceSize);
+                d += sliceSize;
+
+                if constexpr (std::is_same_v<ValueType, float>)
+                    FloatVectorOperations::convertFixedToFloat (d, ints + offset, 1.0f / 0x7fffffff, num - (int) (d - dest));
+                else
+                    FloatVectorOperations::copy (d, s1, num - (int) (d - dest));
+
+                minMax = FloatVectorOperations::findMinAndMax (s1, num);
+            };
+
+            HeapBlock<ValueType> expected (num), actual (num);
+            Range<ValueType> expectedMinMax, actualMinMax;
+
+            const auto original = FloatVectorOperations::getInstructionSet();
+            FloatVectorOperations::setMaximumInstructionSet (FloatVectorOperations::InstructionSet::baseline);
+            applyAllOps (expected, expectedMinMax);
+
+            for (auto set : { FloatVectorOperations::InstructionSet::avx2, FloatVectorOperations::InstructionSet::avx512 })
+            {
+                if (FloatVectorOperations::setMaximumInstructionSet (set) != set)
+                    continue;
+
+                applyAllOps (actual, actualMinMax);
+                u.expect (std::memcmp (expected, actual, (size_t) num * sizeof (ValueType)) == 0);
+                u.expect (expectedMinMax == actualMinMax);
+            }
+
+            FloatVectorOperations::setMaximumInstructionSet (original);
         }
 
         static void doConversionTest (UnitTest& u, float* data1, float* data2, int* const int1, int num)
@@ -1691,6 +2591,15 @@ public:
             return true;
         }
 
+        static bool buffersMatch (const ValueType* d1, const ValueType* d2, int num, Tolerance<ValueType> tolerance)
+        {
+            while (--num >= 0)
+                if (! approximatelyEqual (*d1++, *d2++, tolerance))
+                    return false;
+
+            return true;
+        }
+
         static bool valuesMatch (ValueType v1, ValueType v2)
         {
             return std::abs (v1 - v2) < std::numeric_limits<ValueType>::epsilon();
@@ -1706,6 +2615,61 @@ public:
             TestRunner<float>::runTest (*this, getRandom());
             TestRunner<double>::runTest (*this, getRandom());
         }
+
+        beginTest ("Wider instruction sets give identical results");
+
+        for (int i = 100; --i >= 0;)
+        {
+            TestRunner<float>::runInstructionSetTest (*this, getRandom());
+            TestRunner<double>::runInstructionSetTest (*this, getRandom());
+        }
+
+        beginTest ("Negative sizes don't use the wider instruction sets");
+        {
+            float dest[64], src[64];
+            FloatVectorOperations::fill (dest, 1.0f, 64);
+            FloatVectorOperations::fill (src, 2.0f, 64);
+
+            FloatVectorOperations::add (dest, src, -64);
+            FloatVectorOperations::multiply (dest, src, -64);
+            FloatVectorOperations::clip (dest, src, -0.5f, 0.5f, -64);
+
+            expect (FloatVectorOperations::findMinAndMax (dest, 64) == Range<float> (1.0f, 1.0f));
+        }
+
+        beginTest ("Sums of squares of floats can be accumulated in double precision");
+        {
+            auto random = getRandom();
+            HeapBlock<float> data (100003);
+            double expected = 0.0;
+
+            for (int i = 0; i < 100003; ++i)
+            {
+                data[i] = random.nextFloat() * 2.0f - 1.0f;
+                expected += (double) data[i] * (double) data[i];
+            }
+
+            for (const auto num : { 0, 3, 100003 })
+            {
+                const auto expectedForNum = num == 100003 ? expected : [&]
+                {
+                    double sum = 0.0;
+
+                    for (int i = 0; i < num; ++i)
+                        sum += (double) data[i] * (double) data[i];
+
+                    return sum;
+                }();
+
+                expectWithinAbsoluteError (FloatVectorOperations::sumOfSquaresAsDouble (data.get(), num), expectedForNum, expectedForNum * 1.0e-12);
+            }
+
+            // Long buffers of floats keep the precision of a double accumulator
+            AudioBuffer<float> buffer (1, 100003);
+            buffer.copyFrom (0, 0, data.get(), 100003);
+            const auto expectedRMS = std::sqrt (expected / 100003.0);
+            expectWithinAbsoluteError ((double) buffer.getRMSLevel (0, 0, 100003), expectedRMS, expectedRMS * 1.0e-7);
+        }
     }
 };
 
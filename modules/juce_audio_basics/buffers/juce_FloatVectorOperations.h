@@ -136,6 +136,33 @@ struct FloatVectorOperationsBase
 
     /** Finds the maximum value in the given array. */
     static FloatType JUCE_CALLTYPE findMaximum (const FloatType* src, CountType numValues) noexcept;
+
+    /** Returns the sum of the products of each source1 value and the corresponding source2 value. */
+    static FloatType JUCE_CALLTYPE dotProduct (const FloatType* src1, const FloatType* src2, CountType numValues) noexcept;
+
+    /** Returns the sum of the squares of the values in the given array. */
+    static FloatType JUCE_CALLTYPE sumOfSquares (const FloatType* src, CountType numValues) noexcept;
+
+    /** Multiplies each source value by a linearly changing gain and stores the result in the destination array.
+
+        The gain starts at startGain, and changes by (endGain - startGain) / numValues for each value, which
+        is the same ramp that AudioBuffer::applyGainRamp() uses.
+    */
+    static void JUCE_CALLTYPE multiplyWithRamp (FloatType* dest, const FloatType* src, FloatType startGain, FloatType endGain, CountType numValues) noexcept;
+
+    /** Multiplies each source value by a linearly changing gain, then adds it to the destination value.
+
+        The gain changes in the same way as for multiplyWithRamp().
+    */
+    static void JUCE_CALLTYPE addWithRamp (FloatType* dest, const FloatType* src, FloatType startGain, FloatType endGain, CountType numValues) noexcept;
+
+    /** Interleaves a set of separate channels into a single array, with the samples for each channel
+        following one another. The destination must have space for numChannels * numSamples values.
+    */
+    static void JUCE_CALLTYPE interleave (FloatType* dest, const FloatType* const* src, int numChannels, CountType numSamples) noexcept;
+
+    /** Splits an array of interleaved samples into a set of separate channels. */
+    static void JUCE_CALLTYPE deinterleave (FloatType* const* dest, const FloatType* src, int numChannels, CountType numSamples) noexcept;
 };
 
 #if ! DOXYGEN
@@ -161,7 +188,13 @@ struct NameForwarder : public Bases...
           Bases::clip...,
           Bases::findMinAndMax...,
           Bases::findMinimum...,
-          Bases::findMaximum...;
+          Bases::findMaximum...,
+          Bases::dotProduct...,
+          Bases::sumOfSquares...,
+          Bases::multiplyWithRamp...,
+          Bases::addWithRamp...,
+          Bases::interleave...,
+          Bases::deinterleave...;
 };
 
 } // namespace detail
@@ -187,6 +220,18 @@ public:
 
     static void JUCE_CALLTYPE convertFixedToFloat (float* dest, const int* src, float multiplier, size_t num) noexcept;
 
+    /** Returns the sum of the squares of the values in the given array.
+        Unlike sumOfSquares(), the squares are accumulated as doubles, so no precision is
+        lost when summing long arrays.
+    */
+    static double JUCE_CALLTYPE sumOfSquaresAsDouble (const float* src, int num) noexcept;
+
+    /** Returns the sum of the squares of the values in the given array.
+        Unlike sumOfSquares(), the squares are accumulated as doubles, so no precision is
+        lost when summing long arrays.
+    */
+    static double JUCE_CALLTYPE sumOfSquaresAsDouble (const float* src, size_t num) noexcept;
+
     /** This method enables or disables the SSE/NEON flush-to-zero mode. */
     static void JUCE_CALLTYPE enableFlushToZeroMode (bool shouldEnable) noexcept;
 
@@ -201,6 +246,39 @@ public:
     /** This method returns true if denormals are currently disabled. */
     static bool JUCE_CALLTYPE areDenormalsDisabled() noexcept;
 
+    //==============================================================================
+    /** The instruction sets that can be selected at runtime for the most commonly
+        used operations.
+
+        On Intel CPUs, add(), multiply(), addWithMultiply(), clip(), findMinAndMax()
+        and convertFixedToFloat() will use 256-bit AVX2 or 512-bit AVX-512 kernels
+        when the CPU supports them and the OS has enabled their register state,
+        regardless of the instruction set that the code was compiled for. All the
+        other operations, and all systems without these extensions, use the
+        baseline SSE, NEON or plain C++ implementations.
+
+        The wider kernels produce bit-identical results to the baseline ones.
+    */
+    enum class InstructionSet
+    {
+        baseline,   /**< SSE on Intel CPUs, NEON on ARM, or plain C++ code. */
+        avx2,       /**< 256-bit AVX2 instructions. */
+        avx512      /**< 512-bit AVX-512 Foundation instructions. */
+    };
+
+    /** Returns the instruction set that's currently being used. */
+    static InstructionSet JUCE_CALLTYPE getInstructionSet() noexcept;
+
+    /** Limits the instruction sets that may be used, and returns the one that's now in use.
+
+        By default, the widest instruction set that's supported by the CPU and the OS is chosen.
+        If the CPU doesn't support the requested instruction set, the widest one that's
+        available below it will be used instead. This is mainly useful for benchmarking
+        and testing, or for avoiding the clock speed reductions that some CPUs apply
+        when running AVX-512 code.
+    */
+    static InstructionSet JUCE_CALLTYPE setMaximumInstructionSet (InstructionSet maximumToUse) noexcept;
+
 private:
     friend ScopedNoDenormals;
 
@@ -39,6 +39,16 @@
  #include <emmintrin.h>
 #endif
 
+#if JUCE_USE_AVX_INTRINSICS
+ #include <immintrin.h>
+
+ #if JUCE_MSVC && ! JUCE_CLANG
+  #include <intrin.h>
+ #else
+  #include <cpuid.h>
+ #endif
+#endif
+
 #if JUCE_MAC || JUCE_IOS
  #ifndef JUCE_USE_VDSP_FRAMEWORK
   #define JUCE_USE_VDSP_FRAMEWORK 1
@@ -104,5 +114,6 @@
 
 #if JUCE_UNIT_TESTS
  #include "utilities/juce_ADSR_test.cpp"
+ #include "synthesisers/juce_Synthesiser_test.cpp"
  #include "midi/ump/juce_UMP_test.cpp"
 #endif
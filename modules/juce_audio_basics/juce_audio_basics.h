@@ -70,6 +70,14 @@
  #undef JUCE_USE_SSE_INTRINSICS
 #endif
 
+#if JUCE_USE_SSE_INTRINSICS && ! defined (JUCE_USE_AVX_INTRINSICS)
+ #define JUCE_USE_AVX_INTRINSICS 1
+#endif
+
+#if ! JUCE_USE_SSE_INTRINSICS
+ #undef JUCE_USE_AVX_INTRINSICS
+#endif
+
 #if __ARM_NEON__ && ! (JUCE_USE_VDSP_FRAMEWORK || defined (JUCE_USE_ARM_NEON))
  #define JUCE_USE_ARM_NEON 1
 #endif
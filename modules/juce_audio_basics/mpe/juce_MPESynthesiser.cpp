@@ -264,6 +264,9 @@ void MPESynthesiser::addVoice (MPESynthesiserVoice* const newVoice)
         const ScopedLock sl (voicesLock);
         newVoice->setCurrentSampleRate (getSampleRate());
         voices.add (newVoice);
+
+        bankedVoices.ensureStorageAllocated (voices.size());
+        voicesToRenderInBank.ensureStorageAllocated (voices.size());
     }
 
     {
@@ -327,26 +330,176 @@ void MPESynthesiser::turnOffAllVoices (bool allowTailOff)
 }
 
 //==============================================================================
-void MPESynthesiser::renderNextSubBlock (AudioBuffer<float>& buffer, int startSample, int numSamples)
+template <typename FloatType>
+void MPESynthesiser::renderVoices (AudioBuffer<FloatType>& buffer, int startSample, int numSamples)
 {
     const ScopedLock sl (voicesLock);
 
+    bankedVoices.clearQuick();
+
     for (auto* voice : voices)
     {
         if (voice->isActive())
-            voice->renderNextBlock (buffer, startSample, numSamples);
+        {
+            if (voice->getVoiceBank() != nullptr)
+                bankedVoices.add (voice);
+            else
+                voice->renderNextBlock (buffer, startSample, numSamples);
+        }
     }
+
+    // Gather the voices of each bank in turn, in the order the banks first appear
+    for (int i = 0; i < bankedVoices.size(); ++i)
+    {
+        auto* firstVoice = bankedVoices.getUnchecked (i);
+
+        if (firstVoice == nullptr)
+            continue;
+
+        auto* bank = firstVoice->getVoiceBank();
+        voicesToRenderInBank.clearQuick();
+
+        for (int j = i; j < bankedVoices.size(); ++j)
+        {
+            auto* voice = bankedVoices.getUnchecked (j);
+
+            if (voice != nullptr && voice->getVoiceBank() == bank)
+            {
+                voicesToRenderInBank.add (voice);
+                bankedVoices.setUnchecked (j, nullptr);
+            }
+        }
+
+        bank->renderVoices (buffer, startSample, numSamples,
+                            { voicesToRenderInBank.data(), (size_t) voicesToRenderInBank.size() });
+    }
+}
+
+void MPESynthesiser::renderNextSubBlock (AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    renderVoices (buffer, startSample, numSamples);
 }
 
 void MPESynthesiser::renderNextSubBlock (AudioBuffer<double>& buffer, int startSample, int numSamples)
 {
-    const ScopedLock sl (voicesLock);
+    renderVoices (buffer, startSample, numSamples);
+}
 
-    for (auto* voice : voices)
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+namespace
+{
+    class MPESynthesiserTests final : public UnitTest
     {
-        if (voice->isActive())
-            voice->renderNextBlock (buffer, startSample, numSamples);
-    }
+    public:
+        MPESynthesiserTests()
+            : UnitTest ("MPESynthesiser class", UnitTestCategories::midi) {}
+
+        void runTest() override
+        {
+            beginTest ("Voices that share a bank are rendered together");
+            {
+                TestBank bank;
+
+                MPESynthesiser synth;
+                synth.setCurrentPlaybackSampleRate (44100.0);
+                synth.enableLegacyMode();
+                synth.addVoice (new TestVoice (&bank));
+                synth.addVoice (new TestVoice (nullptr));
+                synth.addVoice (new TestVoice (&bank));
+                synth.addVoice (new TestVoice (&bank));
+
+                MidiBuffer midi;
+
+                for (int note = 60; note < 64; ++note)
+                    midi.addEvent (MidiMessage::noteOn (1, note, 0.5f), 0);
+
+                AudioBuffer<float> buffer (1, 32);
+                buffer.clear();
+                synth.renderNextBlock (buffer, midi, 0, buffer.getNumSamples());
+
+                expectEquals (bank.numCalls, 1);
+                expectEquals (bank.numVoicesInLastCall, 3);
+
+                for (int i = 0; i < buffer.getNumSamples(); ++i)
+                    expectEquals (buffer.getSample (0, i), (float) (60 + 61 + 62 + 63));
+            }
+
+            beginTest ("Voices that finish in a bank are freed");
+            {
+                TestBank bank;
+
+                MPESynthesiser synth;
+                synth.setCurrentPlaybackSampleRate (44100.0);
+                synth.enableLegacyMode();
+                synth.addVoice (new TestVoice (&bank));
+
+                MidiBuffer midi;
+                midi.addEvent (MidiMessage::noteOn (1, 60, 0.5f), 0);
+                midi.addEvent (MidiMessage::noteOff (1, 60), 8);
+
+                AudioBuffer<double> buffer (1, 32);
+                buffer.clear();
+                synth.renderNextBlock (buffer, midi, 0, buffer.getNumSamples());
+
+                expect (! synth.getVoice (0)->isActive());
+                expectEquals (buffer.getSample (0, 7), 60.0);
+                expectEquals (buffer.getSample (0, 8), 0.0);
+            }
+        }
+
+    private:
+        // Adds the voice's note number to the output
+        struct TestVoice final : public MPESynthesiserVoice
+        {
+            explicit TestVoice (MPESynthesiserVoiceBank* b) : bank (b) {}
+
+            void noteStarted() override                 {}
+            void noteStopped (bool) override            { clearCurrentNote(); }
+            void notePressureChanged() override         {}
+            void notePitchbendChanged() override        {}
+            void noteTimbreChanged() override           {}
+            void noteKeyStateChanged() override         {}
+
+            void renderNextBlock (AudioBuffer<float>& output, int startSample, int numSamples) override
+            {
+                for (int i = startSample; i < startSample + numSamples; ++i)
+                    output.addSample (0, i, (float) currentlyPlayingNote.initialNote);
+            }
+
+            void renderNextBlock (AudioBuffer<double>& output, int startSample, int numSamples) override
+            {
+                for (int i = startSample; i < startSample + numSamples; ++i)
+                    output.addSample (0, i, (double) currentlyPlayingNote.initialNote);
+            }
+
+            MPESynthesiserVoiceBank* getVoiceBank() const override   { return bank; }
+
+            MPESynthesiserVoiceBank* bank = nullptr;
+        };
+
+        struct TestBank final : public MPESynthesiserVoiceBank
+        {
+            void renderVoices (AudioBuffer<float>& output, int startSample, int numSamples,
+                               Span<MPESynthesiserVoice* const> voices) override
+            {
+                ++numCalls;
+                numVoicesInLastCall = (int) voices.size();
+
+                for (auto* voice : voices)
+                    voice->renderNextBlock (output, startSample, numSamples);
+            }
+
+            using MPESynthesiserVoiceBank::renderVoices;
+
+            int numCalls = 0, numVoicesInLastCall = 0;
+        };
+    };
+
+    MPESynthesiserTests mpeSynthesiserTests;
 }
 
+#endif
+
 } // namespace juce
@@ -239,6 +239,10 @@ protected:
     //==============================================================================
     /** This will simply call renderNextBlock for each currently active
         voice and fill the buffer with the sum.
+
+        Active voices that belong to an MPESynthesiserVoiceBank are rendered with a
+        single call to the bank's renderVoices() method instead.
+
         Override this method if you need to do more work to render your audio.
     */
     void renderNextSubBlock (AudioBuffer<float>& outputAudio,
@@ -306,6 +310,10 @@ private:
     uint32 lastNoteOnCounter = 0;
     mutable CriticalSection stealLock;
     mutable Array<MPESynthesiserVoice*> usableVoicesToStealArray;
+    Array<MPESynthesiserVoice*> bankedVoices, voicesToRenderInBank;
+
+    template <typename FloatType>
+    void renderVoices (AudioBuffer<FloatType>&, int startSample, int numSamples);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MPESynthesiser)
 };
@@ -23,6 +23,8 @@
 namespace juce
 {
 
+class MPESynthesiserVoiceBank;
+
 //==============================================================================
 /**
     Represents an MPE voice that an MPESynthesiser can use to play a sound.
@@ -156,6 +158,19 @@ public:
     */
     double getSampleRate() const noexcept                 { return currentSampleRate; }
 
+    /** Returns the voice bank that renders this voice, if there is one.
+
+        By default this returns nullptr, and the MPESynthesiser will call this voice's
+        renderNextBlock() method to render it. If it returns a bank, the voice will
+        instead be rendered by a call to MPESynthesiserVoiceBank::renderVoices(),
+        together with all the other active voices that return the same bank.
+
+        The result must not change while the voice is owned by a synthesiser.
+
+        @see MPESynthesiserVoiceBank
+    */
+    virtual MPESynthesiserVoiceBank* getVoiceBank() const   { return nullptr; }
+
     /** This will be set to an incrementing counter value in MPESynthesiser::startVoice()
         and can be used to determine the order in which voices started.
     */
@@ -188,4 +203,58 @@ private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MPESynthesiserVoice)
 };
 
+//==============================================================================
+/**
+    Renders a group of MPESynthesiserVoices together.
+
+    Normally, an MPESynthesiser renders each of its active voices separately, by
+    calling its renderNextBlock() method. Voices that return a bank from
+    MPESynthesiserVoice::getVoiceBank() are rendered by their bank instead, which
+    receives all the active voices that share it in a single call.
+
+    This allows voices of the same type to keep their state in a structure-of-arrays
+    layout that's owned by the bank, and to process several voices at once, for
+    example by using dsp::SIMDRegister to render one voice in each SIMD lane.
+
+    A bank must outlive all the voices that use it.
+
+    @see MPESynthesiserVoice::getVoiceBank, MPESynthesiser
+
+    @tags{Audio}
+*/
+class JUCE_API  MPESynthesiserVoiceBank
+{
+public:
+    /** Destructor. */
+    virtual ~MPESynthesiserVoiceBank() = default;
+
+    /** Renders the next block of data for a set of active voices.
+
+        This behaves as if renderNextBlock() had been called on each of the voices:
+        the output must be added to the current contents of the buffer, and any voice
+        that finishes playing must clear its current note before this method returns.
+
+        The voices will always be active and will all belong to this bank, but the
+        number of voices, and the order in which they're passed, may change between
+        calls.
+    */
+    virtual void renderVoices (AudioBuffer<float>& outputBuffer,
+                               int startSample,
+                               int numSamples,
+                               Span<MPESynthesiserVoice* const> voices) = 0;
+
+    /** Renders the next block of 64-bit data for a set of active voices.
+
+        The default implementation simply calls renderNextBlock() on each voice.
+    */
+    virtual void renderVoices (AudioBuffer<double>& outputBuffer,
+                               int startSample,
+                               int numSamples,
+                               Span<MPESynthesiserVoice* const> voices)
+    {
+        for (auto* voice : voices)
+            voice->renderNextBlock (outputBuffer, startSample, numSamples);
+    }
+};
+
 } // namespace juce
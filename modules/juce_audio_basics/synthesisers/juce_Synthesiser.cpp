@@ -72,6 +72,256 @@ void SynthesiserVoice::renderNextBlock (AudioBuffer<double>& outputBuffer,
     subBuffer.makeCopyOf (tempBuffer, true);
 }
 
+//==============================================================================
+class Synthesiser::VoicePool
+{
+public:
+    enum ListType { freeVoices, activeVoices, releasedVoices, numListTypes };
+
+    explicit VoicePool (const OwnedArray<SynthesiserVoice>& voices)
+    {
+        for (auto* voice : voices)
+        {
+            voice->poolLinks = {};
+            update (voice);
+        }
+    }
+
+    ~VoicePool()
+    {
+        for (auto& list : lists)
+            while (list.head != nullptr)
+                unlink (list.head);
+    }
+
+    // Moves a voice into the list (and note index entry) that matches its current state
+    void update (SynthesiserVoice* voice) noexcept
+    {
+        if (! voice->isVoiceActive())
+        {
+            removeFromNoteIndex (voice);
+
+            if (voice->poolLinks.list != freeVoices)
+            {
+                unlink (voice);
+                append (voice, freeVoices);
+            }
+
+            return;
+        }
+
+        const auto slot = getNoteSlot (voice->currentPlayingMidiChannel, voice->currentlyPlayingNote);
+
+        if (slot != voice->poolLinks.noteSlot)
+        {
+            removeFromNoteIndex (voice);
+            addToNoteIndex (voice, slot);
+        }
+
+        const auto targetList = voice->isPlayingButReleased() ? releasedVoices : activeVoices;
+
+        // A voice that's been stolen is still in the active list, but it's now the newest one
+        if (voice->poolLinks.list != targetList || voice->poolLinks.sortedNoteOnTime != voice->noteOnTime)
+        {
+            unlink (voice);
+            insertByAge (voice, targetList);
+            voice->poolLinks.sortedNoteOnTime = voice->noteOnTime;
+        }
+    }
+
+    // Moves any voices that have finished playing back into the free list
+    void removeFinishedVoices() noexcept
+    {
+        for (auto listType : { activeVoices, releasedVoices })
+        {
+            for (auto* voice = lists[(size_t) listType].head; voice != nullptr;)
+            {
+                auto* next = voice->poolLinks.next;
+
+                if (! voice->isVoiceActive())
+                    update (voice);
+
+                voice = next;
+            }
+        }
+    }
+
+    SynthesiserVoice* getFirst (ListType listType) const noexcept           { return lists[(size_t) listType].head; }
+    static SynthesiserVoice* getNext (const SynthesiserVoice* voice) noexcept { return voice->poolLinks.next; }
+
+    // Returns the first of the voices playing a given note on a given channel
+    SynthesiserVoice* getFirstPlayingNote (int midiChannel, int midiNoteNumber) const noexcept
+    {
+        const auto slot = getNoteSlot (midiChannel, midiNoteNumber);
+        return slot >= 0 ? noteIndex[(size_t) slot] : nullptr;
+    }
+
+    static int getNoteSlot (int midiChannel, int midiNoteNumber) noexcept
+    {
+        if (! isPositiveAndBelow (midiChannel - 1, 16) || ! isPositiveAndBelow (midiNoteNumber, 128))
+            return -1;
+
+        return (midiChannel - 1) * 128 + midiNoteNumber;
+    }
+
+    //==============================================================================
+    // Called on the message thread, with the synthesiser's lock held
+    void publishSounds (const ReferenceCountedArray<SynthesiserSound>& sounds)
+    {
+        auto snapshot = std::make_unique<ReferenceCountedArray<SynthesiserSound>> (sounds);
+        latestSounds.store (snapshot.get());
+        soundSnapshots.push_back (std::move (snapshot));
+
+        // Any snapshot that's no longer the latest one, and that the audio thread
+        // isn't using, can never be picked up again, so it's safe to delete it
+        const auto* latest = latestSounds.load();
+        const auto* inUse = soundsInUse.load();
+
+        soundSnapshots.erase (std::remove_if (soundSnapshots.begin(), soundSnapshots.end(), [&] (const auto& s)
+                                              {
+                                                  return s.get() != latest && s.get() != inUse;
+                                              }),
+                              soundSnapshots.end());
+    }
+
+    // Called on the audio thread. The result stays valid until the next call.
+    const ReferenceCountedArray<SynthesiserSound>& acquireSounds() noexcept
+    {
+        ReferenceCountedArray<SynthesiserSound>* snapshot = nullptr;
+
+        do
+        {
+            snapshot = latestSounds.load();
+            soundsInUse.store (snapshot);
+        }
+        while (snapshot != latestSounds.load());
+
+        return *snapshot;
+    }
+
+private:
+    struct List
+    {
+        SynthesiserVoice* head = nullptr;
+        SynthesiserVoice* tail = nullptr;
+    };
+
+    void unlink (SynthesiserVoice* voice) noexcept
+    {
+        auto& links = voice->poolLinks;
+
+        if (links.list < 0)
+            return;
+
+        auto& list = lists[(size_t) links.list];
+
+        (links.previous != nullptr ? links.previous->poolLinks.next : list.head) = links.next;
+        (links.next != nullptr ? links.next->poolLinks.previous : list.tail) = links.previous;
+
+        links.previous = links.next = nullptr;
+        links.list = -1;
+    }
+
+    void append (SynthesiserVoice* voice, ListType listType) noexcept
+    {
+        auto& list = lists[(size_t) listType];
+        auto& links = voice->poolLinks;
+
+        links.previous = list.tail;
+        links.next = nullptr;
+        links.list = listType;
+
+        (list.tail != nullptr ? list.tail->poolLinks.next : list.head) = voice;
+        list.tail = voice;
+    }
+
+    // Keeps the list sorted with the oldest voices first. New notes are the newest
+    // voices, so this normally just appends to the end of the list.
+    void insertByAge (SynthesiserVoice* voice, ListType listType) noexcept
+    {
+        auto& list = lists[(size_t) listType];
+        auto* after = list.tail;
+
+        while (after != nullptr && voice->wasStartedBefore (*after))
+            after = after->poolLinks.previous;
+
+        if (after == list.tail)
+        {
+            append (voice, listType);
+            return;
+        }
+
+        auto& links = voice->poolLinks;
+        auto* before = after != nullptr ? after->poolLinks.next : list.head;
+
+        links.previous = after;
+        links.next = before;
+        links.list = listType;
+
+        before->poolLinks.previous = voice;
+        (after != nullptr ? after->poolLinks.next : list.head) = voice;
+    }
+
+    void addToNoteIndex (SynthesiserVoice* voice, int slot) noexcept
+    {
+        if (slot < 0)
+            return;
+
+        voice->poolLinks.noteSlot = slot;
+        voice->poolLinks.nextWithSameNote = std::exchange (noteIndex[(size_t) slot], voice);
+    }
+
+    void removeFromNoteIndex (SynthesiserVoice* voice) noexcept
+    {
+        auto& links = voice->poolLinks;
+
+        if (links.noteSlot < 0)
+            return;
+
+        for (auto** v = &noteIndex[(size_t) links.noteSlot]; *v != nullptr; v = &(*v)->poolLinks.nextWithSameNote)
+        {
+            if (*v == voice)
+            {
+                *v = links.nextWithSameNote;
+                break;
+            }
+        }
+
+        links.nextWithSameNote = nullptr;
+        links.noteSlot = -1;
+    }
+
+    std::array<List, numListTypes> lists;
+    std::array<SynthesiserVoice*, 16 * 128> noteIndex {};
+
+    std::atomic<ReferenceCountedArray<SynthesiserSound>*> latestSounds { nullptr }, soundsInUse { nullptr };
+    std::vector<std::unique_ptr<ReferenceCountedArray<SynthesiserSound>>> soundSnapshots;
+};
+
+// Takes the synthesiser's lock, unless the voice pool is in use, in which case
+// the audio thread must never block
+class ScopedSynthesiserLock
+{
+public:
+    ScopedSynthesiserLock (const CriticalSection& lockToUse, bool usingVoicePool) noexcept
+        : lock (usingVoicePool ? nullptr : &lockToUse)
+    {
+        if (lock != nullptr)
+            lock->enter();
+    }
+
+    ~ScopedSynthesiserLock() noexcept
+    {
+        if (lock != nullptr)
+            lock->exit();
+    }
+
+private:
+    const CriticalSection* lock;
+
+    JUCE_DECLARE_NON_COPYABLE (ScopedSynthesiserLock)
+};
+
 //==============================================================================
 Synthesiser::Synthesiser()
 {
@@ -92,12 +342,14 @@ SynthesiserVoice* Synthesiser::getVoice (const int index) const
 
 void Synthesiser::clearVoices()
 {
+    jassert (voicePool == nullptr); // voices can't be removed while the voice pool is enabled!
     const ScopedLock sl (lock);
     voices.clear();
 }
 
 SynthesiserVoice* Synthesiser::addVoice (SynthesiserVoice* const newVoice)
 {
+    jassert (voicePool == nullptr); // voices can't be added while the voice pool is enabled!
     SynthesiserVoice* voice;
 
     {
@@ -116,6 +368,7 @@ SynthesiserVoice* Synthesiser::addVoice (SynthesiserVoice* const newVoice)
 
 void Synthesiser::removeVoice (const int index)
 {
+    jassert (voicePool == nullptr); // voices can't be removed while the voice pool is enabled!
     const ScopedLock sl (lock);
     voices.remove (index);
 }
@@ -124,18 +377,29 @@ void Synthesiser::clearSounds()
 {
     const ScopedLock sl (lock);
     sounds.clear();
+
+    if (voicePool != nullptr)
+        voicePool->publishSounds (sounds);
 }
 
 SynthesiserSound* Synthesiser::addSound (const SynthesiserSound::Ptr& newSound)
 {
     const ScopedLock sl (lock);
-    return sounds.add (newSound);
+    auto* sound = sounds.add (newSound);
+
+    if (voicePool != nullptr)
+        voicePool->publishSounds (sounds);
+
+    return sound;
 }
 
 void Synthesiser::removeSound (const int index)
 {
     const ScopedLock sl (lock);
     sounds.remove (index);
+
+    if (voicePool != nullptr)
+        voicePool->publishSounds (sounds);
 }
 
 void Synthesiser::setNoteStealingEnabled (const bool shouldSteal)
@@ -150,6 +414,30 @@ void Synthesiser::setMinimumRenderingSubdivisionSize (int numSamples, bool shoul
     subBlockSubdivisionIsStrict = shouldBeStrict;
 }
 
+void Synthesiser::setVoicePoolEnabled (bool shouldUseVoicePool)
+{
+    if (shouldUseVoicePool == isVoicePoolEnabled())
+        return;
+
+    const ScopedLock sl (lock);
+
+    if (shouldUseVoicePool)
+    {
+        voicePool = std::make_unique<VoicePool> (voices);
+        voicePool->publishSounds (sounds);
+    }
+    else
+    {
+        voicePool.reset();
+    }
+}
+
+void Synthesiser::updateVoicePool (SynthesiserVoice* voice)
+{
+    if (voicePool != nullptr)
+        voicePool->update (voice);
+}
+
 //==============================================================================
 void Synthesiser::setCurrentPlaybackSampleRate (const double newRate)
 {
@@ -178,15 +466,22 @@ void Synthesiser::processNextBlock (AudioBuffer<floatType>& outputAudio,
 
     bool firstEvent = true;
 
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
+
+    const auto render = [&] (int start, int num)
+    {
+        if (targetChannels > 0)
+            renderVoices (outputAudio, start, num);
+
+        if (voicePool != nullptr)
+            voicePool->removeFinishedVoices();
+    };
 
     for (; numSamples > 0; ++midiIterator)
     {
         if (midiIterator == midiData.cend())
         {
-            if (targetChannels > 0)
-                renderVoices (outputAudio, startSample, numSamples);
-
+            render (startSample, numSamples);
             return;
         }
 
@@ -195,8 +490,7 @@ void Synthesiser::processNextBlock (AudioBuffer<floatType>& outputAudio,
 
         if (samplesToNextMidiMessage >= numSamples)
         {
-            if (targetChannels > 0)
-                renderVoices (outputAudio, startSample, numSamples);
+            render (startSample, numSamples);
 
             handleMidiEvent (metadata.getMessage());
             break;
@@ -210,8 +504,7 @@ void Synthesiser::processNextBlock (AudioBuffer<floatType>& outputAudio,
 
         firstEvent = false;
 
-        if (targetChannels > 0)
-            renderVoices (outputAudio, startSample, samplesToNextMidiMessage);
+        render (startSample, samplesToNextMidiMessage);
 
         handleMidiEvent (metadata.getMessage());
         startSample += samplesToNextMidiMessage;
@@ -296,6 +589,30 @@ void Synthesiser::noteOn (const int midiChannel,
                           const int midiNoteNumber,
                           const float velocity)
 {
+    if (voicePool != nullptr)
+    {
+        for (auto* sound : voicePool->acquireSounds())
+        {
+            if (sound->appliesToNote (midiNoteNumber) && sound->appliesToChannel (midiChannel))
+            {
+                for (auto* voice = voicePool->getFirstPlayingNote (midiChannel, midiNoteNumber); voice != nullptr;)
+                {
+                    auto* next = voice->poolLinks.nextWithSameNote;
+
+                    if (voice->getCurrentlyPlayingNote() == midiNoteNumber && voice->isPlayingChannel (midiChannel))
+                        stopVoice (voice, 1.0f, true);
+
+                    voice = next;
+                }
+
+                startVoice (findFreeVoice (sound, midiChannel, midiNoteNumber, shouldStealNotes),
+                            sound, midiChannel, midiNoteNumber, velocity);
+            }
+        }
+
+        return;
+    }
+
     const ScopedLock sl (lock);
 
     for (auto* sound : sounds)
@@ -335,6 +652,8 @@ void Synthesiser::startVoice (SynthesiserVoice* const voice,
 
         voice->startNote (midiNoteNumber, velocity, sound,
                           lastPitchWheelValues [midiChannel - 1]);
+
+        updateVoicePool (voice);
     }
 }
 
@@ -346,6 +665,8 @@ void Synthesiser::stopVoice (SynthesiserVoice* voice, float velocity, const bool
 
     // the subclass MUST call clearCurrentNote() if it's not tailing off! RTFM for stopNote()!
     jassert (allowTailOff || (voice->getCurrentlyPlayingNote() < 0 && voice->getCurrentlyPlayingSound() == nullptr));
+
+    updateVoicePool (voice);
 }
 
 void Synthesiser::noteOff (const int midiChannel,
@@ -353,9 +674,9 @@ void Synthesiser::noteOff (const int midiChannel,
                            const float velocity,
                            const bool allowTailOff)
 {
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
 
-    for (auto* voice : voices)
+    const auto releaseVoice = [&] (SynthesiserVoice* voice)
     {
         if (voice->getCurrentlyPlayingNote() == midiNoteNumber
               && voice->isPlayingChannel (midiChannel))
@@ -371,26 +692,48 @@ void Synthesiser::noteOff (const int midiChannel,
 
                     if (! (voice->isSustainPedalDown() || voice->isSostenutoPedalDown()))
                         stopVoice (voice, velocity, allowTailOff);
+                    else
+                        updateVoicePool (voice);
                 }
             }
         }
+    };
+
+    if (voicePool != nullptr)
+    {
+        for (auto* voice = voicePool->getFirstPlayingNote (midiChannel, midiNoteNumber); voice != nullptr;)
+        {
+            auto* next = voice->poolLinks.nextWithSameNote;
+            releaseVoice (voice);
+            voice = next;
+        }
+
+        return;
     }
+
+    for (auto* voice : voices)
+        releaseVoice (voice);
 }
 
 void Synthesiser::allNotesOff (const int midiChannel, const bool allowTailOff)
 {
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
 
     for (auto* voice : voices)
+    {
         if (midiChannel <= 0 || voice->isPlayingChannel (midiChannel))
+        {
             voice->stopNote (1.0f, allowTailOff);
+            updateVoicePool (voice);
+        }
+    }
 
     sustainPedalsDown.clear();
 }
 
 void Synthesiser::handlePitchWheel (const int midiChannel, const int wheelValue)
 {
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
 
     for (auto* voice : voices)
         if (midiChannel <= 0 || voice->isPlayingChannel (midiChannel))
@@ -409,7 +752,7 @@ void Synthesiser::handleController (const int midiChannel,
         default:    break;
     }
 
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
 
     for (auto* voice : voices)
         if (midiChannel <= 0 || voice->isPlayingChannel (midiChannel))
@@ -418,7 +761,16 @@ void Synthesiser::handleController (const int midiChannel,
 
 void Synthesiser::handleAftertouch (int midiChannel, int midiNoteNumber, int aftertouchValue)
 {
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
+
+    if (voicePool != nullptr && midiChannel > 0)
+    {
+        for (auto* voice = voicePool->getFirstPlayingNote (midiChannel, midiNoteNumber); voice != nullptr; voice = voice->poolLinks.nextWithSameNote)
+            if (voice->getCurrentlyPlayingNote() == midiNoteNumber && voice->isPlayingChannel (midiChannel))
+                voice->aftertouchChanged (aftertouchValue);
+
+        return;
+    }
 
     for (auto* voice : voices)
         if (voice->getCurrentlyPlayingNote() == midiNoteNumber
@@ -428,7 +780,7 @@ void Synthesiser::handleAftertouch (int midiChannel, int midiNoteNumber, int aft
 
 void Synthesiser::handleChannelPressure (int midiChannel, int channelPressureValue)
 {
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
 
     for (auto* voice : voices)
         if (midiChannel <= 0 || voice->isPlayingChannel (midiChannel))
@@ -438,15 +790,20 @@ void Synthesiser::handleChannelPressure (int midiChannel, int channelPressureVal
 void Synthesiser::handleSustainPedal (int midiChannel, bool isDown)
 {
     jassert (midiChannel > 0 && midiChannel <= 16);
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
 
     if (isDown)
     {
         sustainPedalsDown.setBit (midiChannel);
 
         for (auto* voice : voices)
+        {
             if (voice->isPlayingChannel (midiChannel) && voice->isKeyDown())
+            {
                 voice->setSustainPedalDown (true);
+                updateVoicePool (voice);
+            }
+        }
     }
     else
     {
@@ -458,6 +815,8 @@ void Synthesiser::handleSustainPedal (int midiChannel, bool isDown)
 
                 if (! (voice->isKeyDown() || voice->isSostenutoPedalDown()))
                     stopVoice (voice, 1.0f, true);
+                else
+                    updateVoicePool (voice);
             }
         }
 
@@ -468,16 +827,21 @@ void Synthesiser::handleSustainPedal (int midiChannel, bool isDown)
 void Synthesiser::handleSostenutoPedal (int midiChannel, bool isDown)
 {
     jassert (midiChannel > 0 && midiChannel <= 16);
-    const ScopedLock sl (lock);
+    const ScopedSynthesiserLock sl (lock, voicePool != nullptr);
 
     for (auto* voice : voices)
     {
         if (voice->isPlayingChannel (midiChannel))
         {
             if (isDown)
+            {
                 voice->setSostenutoPedalDown (true);
+                updateVoicePool (voice);
+            }
             else if (voice->isSostenutoPedalDown())
+            {
                 stopVoice (voice, 1.0f, true);
+            }
         }
     }
 }
@@ -498,6 +862,18 @@ SynthesiserVoice* Synthesiser::findFreeVoice (SynthesiserSound* soundToPlay,
                                               int midiChannel, int midiNoteNumber,
                                               const bool stealIfNoneAvailable) const
 {
+    if (voicePool != nullptr)
+    {
+        for (auto* voice = voicePool->getFirst (VoicePool::freeVoices); voice != nullptr; voice = VoicePool::getNext (voice))
+            if (voice->canPlaySound (soundToPlay))
+                return voice;
+
+        if (stealIfNoneAvailable)
+            return findVoiceToSteal (soundToPlay, midiChannel, midiNoteNumber);
+
+        return nullptr;
+    }
+
     const ScopedLock sl (lock);
 
     for (auto* voice : voices)
@@ -520,6 +896,9 @@ SynthesiserVoice* Synthesiser::findVoiceToSteal (SynthesiserSound* soundToPlay,
     // apparently you are trying to render audio without having any voices...
     jassert (! voices.isEmpty());
 
+    if (voicePool != nullptr)
+        return findVoiceToStealInPool (soundToPlay, midiNoteNumber);
+
     // These are the voices we want to protect (ie: only steal if unavoidable)
     SynthesiserVoice* low = nullptr; // Lowest sounding note, might be sustained, but NOT in release phase
     SynthesiserVoice* top = nullptr; // Highest sounding note, might be sustained, but NOT in release phase
@@ -596,4 +975,62 @@ SynthesiserVoice* Synthesiser::findVoiceToSteal (SynthesiserSound* soundToPlay,
     return low;
 }
 
+SynthesiserVoice* Synthesiser::findVoiceToStealInPool (SynthesiserSound* soundToPlay, int midiNoteNumber) const
+{
+    // This applies the same heuristics as findVoiceToSteal(), but the pool's lists are
+    // already sorted by age, and released voices are kept separately, so no sorting or
+    // extra storage is needed.
+    SynthesiserVoice* low = nullptr;
+    SynthesiserVoice* top = nullptr;
+
+    for (auto* voice = voicePool->getFirst (VoicePool::activeVoices); voice != nullptr; voice = VoicePool::getNext (voice))
+    {
+        if (voice->canPlaySound (soundToPlay))
+        {
+            auto note = voice->getCurrentlyPlayingNote();
+
+            if (low == nullptr || note < low->getCurrentlyPlayingNote())
+                low = voice;
+
+            if (top == nullptr || note > top->getCurrentlyPlayingNote())
+                top = voice;
+        }
+    }
+
+    if (top == low)
+        top = nullptr;
+
+    // The oldest note that's playing with the target pitch, on any channel
+    SynthesiserVoice* samePitch = nullptr;
+
+    for (int channel = 1; channel <= 16; ++channel)
+        for (auto* voice = voicePool->getFirstPlayingNote (channel, midiNoteNumber); voice != nullptr; voice = voice->poolLinks.nextWithSameNote)
+            if (voice->getCurrentlyPlayingNote() == midiNoteNumber && voice->canPlaySound (soundToPlay)
+                 && (samePitch == nullptr || voice->wasStartedBefore (*samePitch)))
+                samePitch = voice;
+
+    if (samePitch != nullptr)
+        return samePitch;
+
+    // Oldest voice that has been released. These are never protected.
+    for (auto* voice = voicePool->getFirst (VoicePool::releasedVoices); voice != nullptr; voice = VoicePool::getNext (voice))
+        if (voice->canPlaySound (soundToPlay))
+            return voice;
+
+    // Oldest voice that doesn't have a finger on it
+    for (auto* voice = voicePool->getFirst (VoicePool::activeVoices); voice != nullptr; voice = VoicePool::getNext (voice))
+        if (voice != low && voice != top && ! voice->isKeyDown() && voice->canPlaySound (soundToPlay))
+            return voice;
+
+    // Oldest voice that isn't protected
+    for (auto* voice = voicePool->getFirst (VoicePool::activeVoices); voice != nullptr; voice = VoicePool::getNext (voice))
+        if (voice != low && voice != top && voice->canPlaySound (soundToPlay))
+            return voice;
+
+    if (top != nullptr)
+        return top;
+
+    return low;
+}
+
 } // namespace juce
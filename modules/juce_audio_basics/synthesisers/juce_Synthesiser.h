@@ -272,6 +272,18 @@ private:
     SynthesiserSound::Ptr currentlyPlayingSound;
     bool keyIsDown = false, sustainPedalDown = false, sostenutoPedalDown = false;
 
+    // Intrusive links used by the Synthesiser's voice pool
+    struct PoolLinks
+    {
+        SynthesiserVoice* previous = nullptr;
+        SynthesiserVoice* next = nullptr;
+        SynthesiserVoice* nextWithSameNote = nullptr;
+        int list = -1, noteSlot = -1;
+        uint32 sortedNoteOnTime = 0;
+    };
+
+    PoolLinks poolLinks;
+
     AudioBuffer<float> tempBuffer;
 
     JUCE_LEAK_DETECTOR (SynthesiserVoice)
@@ -557,6 +569,34 @@ public:
     */
     void setMinimumRenderingSubdivisionSize (int numSamples, bool shouldBeStrict = false) noexcept;
 
+    //==============================================================================
+    /** Enables or disables voice-pool mode.
+
+        By default, each note event scans every voice and sound while holding the
+        synthesiser's lock. In voice-pool mode, the synthesiser instead keeps its voices
+        in lists of free, active and released voices, and indexes the playing voices by
+        midi channel and note number, so that the cost of a note event doesn't depend
+        on the number of voices. The audio thread also never takes the lock: changes
+        made with addSound(), removeSound() and clearSounds() are published to it with
+        a lock-free swap, and are picked up by the next note-on.
+
+        This mode has some restrictions:
+        - renderNextBlock() and any direct calls to noteOn(), noteOff() and the other
+          midi handling methods must all be made from the same thread.
+        - Voices must not be added or removed while the mode is enabled.
+        - Voices must not override SynthesiserVoice::isPlayingChannel().
+        - This method must not be called while renderNextBlock() is running.
+
+        Custom implementations of findFreeVoice() and findVoiceToSteal() still work
+        in voice-pool mode.
+    */
+    void setVoicePoolEnabled (bool shouldUseVoicePool);
+
+    /** Returns true if voice-pool mode is enabled.
+        @see setVoicePoolEnabled
+    */
+    bool isVoicePoolEnabled() const noexcept                    { return voicePool != nullptr; }
+
 protected:
     //==============================================================================
     /** This is used to control access to the rendering callback and the note trigger methods. */
@@ -630,6 +670,12 @@ private:
     mutable CriticalSection stealLock;
     mutable Array<SynthesiserVoice*> usableVoicesToStealArray;
 
+    class VoicePool;
+    std::unique_ptr<VoicePool> voicePool;
+
+    SynthesiserVoice* findVoiceToStealInPool (SynthesiserSound*, int midiNoteNumber) const;
+    void updateVoicePool (SynthesiserVoice*);
+
     template <typename floatType>
     void processNextBlock (AudioBuffer<floatType>&, const MidiBuffer&, int startSample, int numSamples);
 
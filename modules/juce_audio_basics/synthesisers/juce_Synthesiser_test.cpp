@@ -0,0 +1,244 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   The code included in this file is provided under the terms of the ISC license
+   http://www.isc.org/downloads/software-support-policy/isc-license. Permission
+   To use, copy, modify, and/or distribute this software for any purpose with or
+   without fee is hereby granted provided that the above copyright notice and
+   this permission notice appear in all copies.
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+namespace juce
+{
+
+class SynthesiserTests final : public UnitTest
+{
+public:
+    SynthesiserTests()  : UnitTest ("Synthesiser", UnitTestCategories::audio)  {}
+
+    void runTest() override
+    {
+        beginTest ("Voice pool renders the same output as the default voice allocation");
+        {
+            for (auto seed : { 1, 2, 3 })
+            {
+                const auto midi = createRandomMidi (seed);
+
+                const auto withoutPool = render (midi, false);
+                const auto withPool    = render (midi, true);
+
+                expect (withoutPool.first.getNumSamples() == withPool.first.getNumSamples());
+
+                for (int i = 0; i < withPool.first.getNumSamples(); ++i)
+                {
+                    if (! exactlyEqual (withoutPool.first.getSample (0, i), withPool.first.getSample (0, i)))
+                    {
+                        expect (false, "Output differs at sample " + String (i));
+                        break;
+                    }
+                }
+
+                expectEquals (withPool.second, withoutPool.second);
+            }
+        }
+
+        beginTest ("Voice pool steals the same voices as the default voice allocation");
+        {
+            // With every key held, the oldest voice that's neither the lowest nor the
+            // highest note is stolen, so a voice that's just been stolen must become the
+            // newest one rather than keeping its old place
+            const auto getNotesAfterStealing = [] (bool useVoicePool)
+            {
+                Synthesiser synth;
+                synth.setCurrentPlaybackSampleRate (44100.0);
+                synth.addSound (new TestSound());
+
+                for (int i = 0; i < 4; ++i)
+                    synth.addVoice (new TestVoice());
+
+                synth.setVoicePoolEnabled (useVoicePool);
+
+                AudioBuffer<float> buffer (1, blockSize);
+
+                for (const auto note : { 50, 60, 61, 70, 62, 63, 64 })
+                {
+                    MidiBuffer midi;
+                    midi.addEvent (MidiMessage::noteOn (1, note, 1.0f), 0);
+                    synth.renderNextBlock (buffer, midi, 0, blockSize);
+                }
+
+                std::set<int> notes;
+
+                for (int i = 0; i < synth.getNumVoices(); ++i)
+                    notes.insert (synth.getVoice (i)->getCurrentlyPlayingNote());
+
+                return notes;
+            };
+
+            const auto withoutPool = getNotesAfterStealing (false);
+            const auto withPool    = getNotesAfterStealing (true);
+
+            expect (withoutPool == std::set<int> { 50, 63, 64, 70 });
+            expect (withPool == withoutPool);
+        }
+
+        beginTest ("Voice pool picks up sounds added and removed while enabled");
+        {
+            Synthesiser synth;
+            synth.setCurrentPlaybackSampleRate (44100.0);
+
+            for (int i = 0; i < 4; ++i)
+                synth.addVoice (new TestVoice());
+
+            synth.setVoicePoolEnabled (true);
+            expect (synth.isVoicePoolEnabled());
+
+            AudioBuffer<float> buffer (1, blockSize);
+
+            const auto renderNote = [&] (int note)
+            {
+                MidiBuffer midi;
+                midi.addEvent (MidiMessage::noteOn (1, note, 1.0f), 0);
+                buffer.clear();
+                synth.renderNextBlock (buffer, midi, 0, blockSize);
+                return buffer.getSample (0, 0);
+            };
+
+            expectEquals (renderNote (60), 0.0f);
+
+            synth.addSound (new TestSound());
+            expectEquals (renderNote (61), 61.0f);
+
+            synth.clearSounds();
+            synth.allNotesOff (0, false);
+            expectEquals (renderNote (62), 0.0f);
+
+            synth.setVoicePoolEnabled (false);
+            expect (! synth.isVoicePoolEnabled());
+        }
+    }
+
+private:
+    static constexpr int blockSize = 64;
+    static constexpr int numBlocks = 400;
+
+    struct TestSound final : public SynthesiserSound
+    {
+        bool appliesToNote (int) override     { return true; }
+        bool appliesToChannel (int) override  { return true; }
+    };
+
+    // Produces small integer sample values, so that the output doesn't depend on the
+    // order in which the voices are summed
+    struct TestVoice final : public SynthesiserVoice
+    {
+        bool canPlaySound (SynthesiserSound* s) override  { return dynamic_cast<TestSound*> (s) != nullptr; }
+
+        void startNote (int note, float, SynthesiserSound*, int) override
+        {
+            currentNote = note;
+            age = 0;
+            tailRemaining = -1;
+        }
+
+        void stopNote (float, bool allowTailOff) override
+        {
+            if (allowTailOff && tailRemaining < 0)
+                tailRemaining = 100;
+            else if (! allowTailOff)
+                clearCurrentNote();
+        }
+
+        void pitchWheelMoved (int) override            {}
+        void controllerMoved (int, int) override       {}
+
+        void renderNextBlock (AudioBuffer<float>& output, int startSample, int numSamples) override
+        {
+            for (int i = startSample; i < startSample + numSamples && isVoiceActive(); ++i)
+            {
+                output.addSample (0, i, (float) (currentNote + (age++ % 7)));
+
+                if (tailRemaining >= 0 && --tailRemaining < 0)
+                    clearCurrentNote();
+            }
+        }
+
+        using SynthesiserVoice::renderNextBlock;
+
+        int currentNote = 0, age = 0, tailRemaining = -1;
+    };
+
+    static MidiBuffer createRandomMidi (int seed)
+    {
+        Random random (seed);
+        MidiBuffer midi;
+
+        for (int pos = 0; pos < blockSize * numBlocks; pos += random.nextInt (40))
+        {
+            const auto channel = 1 + random.nextInt (3);
+            const auto note = 40 + random.nextInt (24);
+            const auto choice = random.nextInt (100);
+
+            if (choice < 50)
+                midi.addEvent (MidiMessage::noteOn (channel, note, 0.5f), pos);
+            else if (choice < 90)
+                midi.addEvent (MidiMessage::noteOff (channel, note), pos);
+            else if (choice < 94)
+                midi.addEvent (MidiMessage::controllerEvent (channel, 0x40, random.nextBool() ? 127 : 0), pos);
+            else if (choice < 97)
+                midi.addEvent (MidiMessage::controllerEvent (channel, 0x42, random.nextBool() ? 127 : 0), pos);
+            else if (choice < 99)
+                midi.addEvent (MidiMessage::aftertouchChange (channel, note, 64), pos);
+            else
+                midi.addEvent (MidiMessage::allNotesOff (channel), pos);
+        }
+
+        return midi;
+    }
+
+    static std::pair<AudioBuffer<float>, int> render (const MidiBuffer& midi, bool useVoicePool)
+    {
+        Synthesiser synth;
+        synth.setCurrentPlaybackSampleRate (44100.0);
+        synth.addSound (new TestSound());
+
+        for (int i = 0; i < 8; ++i)
+            synth.addVoice (new TestVoice());
+
+        synth.setVoicePoolEnabled (useVoicePool);
+
+        AudioBuffer<float> output (1, blockSize * numBlocks);
+        output.clear();
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            MidiBuffer blockMidi;
+            blockMidi.addEvents (midi, block * blockSize, blockSize, -block * blockSize);
+            synth.renderNextBlock (output, blockMidi, block * blockSize, blockSize);
+        }
+
+        int numActiveVoices = 0;
+
+        for (int i = 0; i < synth.getNumVoices(); ++i)
+            if (synth.getVoice (i)->isVoiceActive())
+                ++numActiveVoices;
+
+        return { std::move (output), numActiveVoices };
+    }
+};
+
+static SynthesiserTests synthesiserTests;
+
+} // namespace juce
@@ -614,18 +614,21 @@ public:
         return true;
     }
 
-    template <typename Endianness>
+    template <typename Endianness, typename TargetType>
     static void copySampleData (unsigned int numBitsPerSample, bool floatingPointData,
-                                int* const* destSamples, int startOffsetInDestBuffer, int numDestChannels,
+                                TargetType* const* destSamples, int startOffsetInDestBuffer, int numDestChannels,
                                 const void* sourceData, int numberOfChannels, int numSamples) noexcept
     {
+        // fixed-point data goes into int buffers as 32-bit values, or into float buffers as floats
+        using FixedDest = std::conditional_t<std::is_same_v<TargetType, float>, AudioData::Float32, AudioData::Int32>;
+
         switch (numBitsPerSample)
         {
-            case 8:     ReadHelper<AudioData::Int32, AudioData::Int8,  Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
-            case 16:    ReadHelper<AudioData::Int32, AudioData::Int16, Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
-            case 24:    ReadHelper<AudioData::Int32, AudioData::Int24, Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
+            case 8:     ReadHelper<FixedDest, AudioData::Int8,  Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
+            case 16:    ReadHelper<FixedDest, AudioData::Int16, Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
+            case 24:    ReadHelper<FixedDest, AudioData::Int24, Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
             case 32:    if (floatingPointData) ReadHelper<AudioData::Float32, AudioData::Float32, Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples);
-                        else                   ReadHelper<AudioData::Int32,   AudioData::Int32,   Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples);
+                        else                   ReadHelper<FixedDest,          AudioData::Int32,   Endianness>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples);
                         break;
             default:    jassertfalse; break;
         }
@@ -831,28 +834,13 @@ public:
     bool readSamples (int* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
                       int64 startSampleInFile, int numSamples) override
     {
-        clearSamplesBeyondAvailableLength (destSamples, numDestChannels, startOffsetInDestBuffer,
-                                           startSampleInFile, numSamples, lengthInSamples);
-
-        if (numSamples <= 0)
-            return true;
-
-        if (map == nullptr || ! mappedSection.contains (Range<int64> (startSampleInFile, startSampleInFile + numSamples)))
-        {
-            jassertfalse; // you must make sure that the window contains all the samples you're going to attempt to read.
-            return false;
-        }
-
-        if (littleEndian)
-            AiffAudioFormatReader::copySampleData<AudioData::LittleEndian>
-                    (bitsPerSample, usesFloatingPointData, destSamples, startOffsetInDestBuffer,
-                     numDestChannels, sampleToPointer (startSampleInFile), (int) numChannels, numSamples);
-        else
-            AiffAudioFormatReader::copySampleData<AudioData::BigEndian>
-                    (bitsPerSample, usesFloatingPointData, destSamples, startOffsetInDestBuffer,
-                     numDestChannels, sampleToPointer (startSampleInFile), (int) numChannels, numSamples);
+        return readMappedSamples (destSamples, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
+    }
 
-        return true;
+    bool readSamplesAsFloat (float* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
+                             int64 startSampleInFile, int numSamples) override
+    {
+        return readMappedSamples (destSamples, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
     }
 
     void getSample (int64 sample, float* result) const noexcept override
@@ -929,18 +917,41 @@ public:
 private:
     const bool littleEndian;
 
-    template <typename SampleType>
-    void scanMinAndMax (int64 startSampleInFile, int64 numSamples, Range<float>* results, int numChannelsToRead) const noexcept
+    template <typename TargetType>
+    bool readMappedSamples (TargetType* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
+                            int64 startSampleInFile, int numSamples)
     {
-        for (int i = 0; i < numChannelsToRead; ++i)
-            results[i] = scanMinAndMaxForChannel<SampleType> (i, startSampleInFile, numSamples);
+        clearSamplesBeyondAvailableLength (reinterpret_cast<int* const*> (destSamples), numDestChannels, startOffsetInDestBuffer,
+                                           startSampleInFile, numSamples, lengthInSamples);
+
+        if (numSamples <= 0)
+            return true;
+
+        if (map == nullptr || ! mappedSection.contains (Range<int64> (startSampleInFile, startSampleInFile + numSamples)))
+        {
+            jassertfalse; // you must make sure that the window contains all the samples you're going to attempt to read.
+            return false;
+        }
+
+        if (littleEndian)
+            AiffAudioFormatReader::copySampleData<AudioData::LittleEndian>
+                    (bitsPerSample, usesFloatingPointData, destSamples, startOffsetInDestBuffer,
+                     numDestChannels, sampleToPointer (startSampleInFile), (int) numChannels, numSamples);
+        else
+            AiffAudioFormatReader::copySampleData<AudioData::BigEndian>
+                    (bitsPerSample, usesFloatingPointData, destSamples, startOffsetInDestBuffer,
+                     numDestChannels, sampleToPointer (startSampleInFile), (int) numChannels, numSamples);
+
+        return true;
     }
 
     template <typename SampleType>
-    Range<float> scanMinAndMaxForChannel (int channel, int64 startSampleInFile, int64 numSamples) const noexcept
+    void scanMinAndMax (int64 startSampleInFile, int64 numSamples, Range<float>* results, int numChannelsToRead) const
     {
-        return littleEndian ? scanMinAndMaxInterleaved<SampleType, AudioData::LittleEndian> (channel, startSampleInFile, numSamples)
-                            : scanMinAndMaxInterleaved<SampleType, AudioData::BigEndian>    (channel, startSampleInFile, numSamples);
+        if (littleEndian)
+            scanMinAndMaxOfChannels<SampleType, AudioData::LittleEndian> (startSampleInFile, numSamples, results, numChannelsToRead);
+        else
+            scanMinAndMaxOfChannels<SampleType, AudioData::BigEndian> (startSampleInFile, numSamples, results, numChannelsToRead);
     }
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MemoryMappedAiffReader)
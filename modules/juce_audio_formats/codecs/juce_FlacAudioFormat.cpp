@@ -192,14 +192,215 @@ static const char* const flacFormatName = "FLAC file";
 template <typename Item>
 auto emptyRange (Item item) { return Range<Item>::emptyRange (item); }
 
+//==============================================================================
+namespace FlacFileHelpers
+{
+    using StreamInfo = FlacNamespace::FLAC__StreamMetadata_StreamInfo;
+
+    static void packUint32 (FlacNamespace::FLAC__uint32 val, FlacNamespace::FLAC__byte* b, const int bytes)
+    {
+        b += bytes;
+
+        for (int i = 0; i < bytes; ++i)
+        {
+            *(--b) = (FlacNamespace::FLAC__byte) (val & 0xff);
+            val >>= 8;
+        }
+    }
+
+    static void packStreamInfo (const StreamInfo& info, FlacNamespace::FLAC__byte* buffer)
+    {
+        const unsigned int channelsMinus1 = info.channels - 1;
+        const unsigned int bitsMinus1 = info.bits_per_sample - 1;
+
+        packUint32 (info.min_blocksize, buffer, 2);
+        packUint32 (info.max_blocksize, buffer + 2, 2);
+        packUint32 (info.min_framesize, buffer + 4, 3);
+        packUint32 (info.max_framesize, buffer + 7, 3);
+        buffer[10] = (uint8) ((info.sample_rate >> 12) & 0xff);
+        buffer[11] = (uint8) ((info.sample_rate >> 4) & 0xff);
+        buffer[12] = (uint8) (((info.sample_rate & 0x0f) << 4) | (channelsMinus1 << 1) | (bitsMinus1 >> 4));
+        buffer[13] = (FlacNamespace::FLAC__byte) (((bitsMinus1 & 0x0f) << 4) | (unsigned int) ((info.total_samples >> 32) & 0x0f));
+        packUint32 ((FlacNamespace::FLAC__uint32) info.total_samples, buffer + 14, 4);
+        memcpy (buffer + 18, info.md5sum, 16);
+    }
+
+    //==============================================================================
+    /*  The parts of a frame header that are needed to find and renumber frames without
+        decoding them.
+    */
+    struct FrameHeader
+    {
+        uint64 number = 0;      // the frame number, or the first sample if the block size is variable
+        bool variableBlockSize = false;
+        int numSamples = 0;
+        int numberSize = 0;     // the coded number always starts at the fifth byte
+        int size = 0;           // including the CRC-8
+    };
+
+    constexpr int maxFrameHeaderSize = 16;
+
+    /*  Parses and checks the frame header at the start of the data. */
+    static bool parseFrameHeader (const uint8* data, size_t available, FrameHeader& header)
+    {
+        if (available < 6 || data[0] != 0xff || (data[1] & 0xfe) != 0xf8)
+            return false;
+
+        const auto blockSizeCode  = data[2] >> 4;
+        const auto sampleRateCode = data[2] & 0x0f;
+        const auto channelCode    = data[3] >> 4;
+        const auto sampleSizeCode = (data[3] >> 1) & 7;
+
+        if (blockSizeCode == 0 || sampleRateCode == 15 || channelCode > 10 || sampleSizeCode == 3 || (data[3] & 1) != 0)
+            return false;
+
+        // the number is coded in the same way as a UTF-8 character, but with up to 36 bits
+        uint64 number = data[4];
+        auto numberSize = 1;
+
+        if ((data[4] & 0x80) != 0)
+        {
+            while (numberSize < 8 && (data[4] & (0x80 >> numberSize)) != 0)
+                ++numberSize;
+
+            if (numberSize < 2 || numberSize > 7 || available < (size_t) (4 + numberSize))
+                return false;
+
+            number = data[4] & (0x7f >> numberSize);
+
+            for (int i = 1; i < numberSize; ++i)
+            {
+                if ((data[4 + i] & 0xc0) != 0x80)
+                    return false;
+
+                number = (number << 6) | (data[4 + i] & 0x3f);
+            }
+        }
+
+        auto pos = (size_t) (4 + numberSize);
+        int numSamples = 0;
+
+        if (blockSizeCode == 1)         numSamples = 192;
+        else if (blockSizeCode <= 5)    numSamples = 576 << (blockSizeCode - 2);
+        else if (blockSizeCode == 6)    numSamples = (pos < available ? data[pos] : 0) + 1;
+        else if (blockSizeCode == 7)    numSamples = (pos + 1 < available ? (data[pos] << 8) | data[pos + 1] : 0) + 1;
+        else                            numSamples = 256 << (blockSizeCode - 8);
+
+        if (blockSizeCode == 6 || blockSizeCode == 7)
+            pos += (size_t) (blockSizeCode - 5);
+
+        if (sampleRateCode == 12)
+            pos += 1;
+        else if (sampleRateCode == 13 || sampleRateCode == 14)
+            pos += 2;
+
+        if (pos >= available || FlacNamespace::FLAC__crc8 (data, (uint32) pos) != data[pos])
+            return false;
+
+        header = { number, (data[1] & 1) != 0, numSamples, numberSize, (int) pos + 1 };
+        return true;
+    }
+
+    /*  Writes a number in the form used by frame headers, and returns the number of bytes used. */
+    static int writeFrameNumber (uint64 number, uint8* dest)
+    {
+        if (number < 0x80)
+        {
+            dest[0] = (uint8) number;
+            return 1;
+        }
+
+        auto size = 2;
+
+        while (size < 7 && number >= ((uint64) 1 << (5 * size + 1)))
+            ++size;
+
+        for (int i = size; --i > 0;)
+        {
+            dest[i] = (uint8) (0x80 | (number & 0x3f));
+            number >>= 6;
+        }
+
+        dest[0] = (uint8) ((0xff00 >> size) | number);
+        return size;
+    }
+
+    /*  Writes a copy of a fixed-block-size frame with a different frame number, updating
+        both of its checksums.
+    */
+    static void writeRenumberedFrame (const uint8* frame, size_t size, const FrameHeader& header,
+                                      uint64 newNumber, MemoryOutputStream& out)
+    {
+        jassert (! header.variableBlockSize);
+
+        uint8 newHeader[maxFrameHeaderSize];
+        memcpy (newHeader, frame, 4);
+        auto headerSize = 4 + writeFrameNumber (newNumber, newHeader + 4);
+
+        // the optional block size and sample rate fields that follow the number
+        const auto numExtraBytes = header.size - 5 - header.numberSize;
+        memcpy (newHeader + headerSize, frame + 4 + header.numberSize, (size_t) numExtraBytes);
+        headerSize += numExtraBytes;
+        newHeader[headerSize] = FlacNamespace::FLAC__crc8 (newHeader, (uint32) headerSize);
+        ++headerSize;
+
+        const auto start = out.getPosition();
+        out.write (newHeader, (size_t) headerSize);
+        out.write (frame + header.size, size - (size_t) header.size - 2);
+
+        const auto crc = FlacNamespace::FLAC__crc16 (static_cast<const uint8*> (out.getData()) + start,
+                                                    (uint32) (out.getPosition() - start));
+        out.writeByte ((char) (crc >> 8));
+        out.writeByte ((char) (crc & 0xff));
+    }
+
+    //==============================================================================
+    /*  Calls fn (i) for each i in [0, numItems) on the pool's threads and on the calling
+        thread, and returns once all the calls have finished.
+    */
+    template <typename Fn>
+    static void forEachInParallel (ThreadPool& pool, int numItems, Fn&& fn)
+    {
+        struct State
+        {
+            std::atomic<int> nextItem { 0 }, numFinished { 0 };
+            WaitableEvent finished;
+        };
+
+        // Jobs that only start once all the items have been taken just return, so they
+        // never use fn, which may have gone out of scope by then
+        auto state = std::make_shared<State>();
+
+        const auto work = [state, numItems, &fn]
+        {
+            for (int i; (i = state->nextItem++) < numItems;)
+            {
+                fn (i);
+
+                if (++state->numFinished == numItems)
+                    state->finished.signal();
+            }
+        };
+
+        for (int i = 0; i < jmin (pool.getNumThreads(), numItems - 1); ++i)
+            pool.addJob (work);
+
+        work();
+        state->finished.wait();
+    }
+}
+
 //==============================================================================
 class FlacReader final : public AudioFormatReader
 {
 public:
-    FlacReader (InputStream* in)  : AudioFormatReader (in, flacFormatName)
+    FlacReader (InputStream* in, ThreadPool* pool)
+        : AudioFormatReader (in, flacFormatName),
+          threadPool (pool)
     {
         lengthInSamples = 0;
         decoder = FlacNamespace::FLAC__stream_decoder_new();
+        FLAC__stream_decoder_set_metadata_respond (decoder, FlacNamespace::FLAC__METADATA_TYPE_SEEKTABLE);
 
         ok = FLAC__stream_decoder_init_stream (decoder,
                                                readCallback_, seekCallback_, tellCallback_, lengthCallback_,
@@ -223,6 +424,18 @@ public:
                 FLAC__stream_decoder_process_until_end_of_metadata (decoder);
                 lengthInSamples = tempLength;
             }
+
+            FlacNamespace::FLAC__uint64 firstFramePosition = 0;
+
+            if (threadPool != nullptr && FLAC__stream_decoder_get_decode_position (decoder, &firstFramePosition))
+            {
+                addToFrameIndex ({ 0, (int64) firstFramePosition });
+
+                for (const auto& point : seekPoints)
+                    addToFrameIndex ({ (int64) point.sample_number, (int64) (firstFramePosition + point.stream_offset) });
+            }
+
+            seekPoints.clear();
         }
     }
 
@@ -237,16 +450,32 @@ public:
         bitsPerSample = info.bits_per_sample;
         lengthInSamples = (unsigned int) info.total_samples;
         numChannels = info.channels;
+        streamInfo = info;
+        seekPoints.clear();
 
         reservoir.setSize ((int) numChannels, 2 * (int) info.max_blocksize, false, false, true);
     }
 
+    void useSeekTable (const FlacNamespace::FLAC__StreamMetadata_SeekTable& table)
+    {
+        for (uint32 i = 0; i < table.num_points; ++i)
+            if (table.points[i].sample_number != FlacNamespace::FLAC__STREAM_METADATA_SEEKPOINT_PLACEHOLDER)
+                seekPoints.push_back (table.points[i]);
+    }
+
     bool readSamples (int* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
                       int64 startSampleInFile, int numSamples) override
     {
         if (! ok)
             return false;
 
+        if (threadPool != nullptr
+             && numSamples >= framesPerParallelGroup * 2 * (int) streamInfo.max_blocksize
+             && readSamplesInParallel (destSamples, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples))
+        {
+            return true;
+        }
+
         const auto getBufferedRange = [this] { return bufferedRange; };
 
         const auto readFromReservoir = [this, &destSamples, &numDestChannels, &startOffsetInDestBuffer, &startSampleInFile] (const Range<int64> rangeToRead)
@@ -335,6 +564,295 @@ public:
         }
     }
 
+    //==============================================================================
+    /*  The position of the start of a frame in the stream. */
+    struct FramePosition
+    {
+        int64 firstSample = 0, byteOffset = 0;
+    };
+
+    /*  The destination of a read that's being shared out between several decoders. */
+    struct ParallelRead
+    {
+        int* const* destSamples;
+        int numDestChannels, startOffsetInDestBuffer;
+        Range<int64> range;
+        int numChannels, bitsToShift;
+        std::atomic<int64> numSamplesDecoded { 0 };
+    };
+
+    /*  Decodes a run of whole frames from memory with its own libFLAC decoder, writing any
+        samples that fall within the range of a ParallelRead.
+    */
+    struct FrameGroupDecoder
+    {
+        void decode()
+        {
+            auto* groupDecoder = FlacNamespace::FLAC__stream_decoder_new();
+
+            if (FLAC__stream_decoder_init_stream (groupDecoder, readCallback, nullptr, nullptr, nullptr, nullptr,
+                                                  writeCallback, nullptr, errorCallback, this)
+                    == FlacNamespace::FLAC__STREAM_DECODER_INIT_STATUS_OK)
+            {
+                FLAC__stream_decoder_process_until_end_of_stream (groupDecoder);
+            }
+
+            FlacNamespace::FLAC__stream_decoder_delete (groupDecoder);
+        }
+
+        static FlacNamespace::FLAC__StreamDecoderReadStatus readCallback (const FlacNamespace::FLAC__StreamDecoder*, FlacNamespace::FLAC__byte buffer[], size_t* bytes, void* client_data)
+        {
+            auto& d = *static_cast<FrameGroupDecoder*> (client_data);
+            size_t numDone = 0;
+
+            while (numDone < *bytes && d.part < 2)
+            {
+                const auto numToCopy = jmin (*bytes - numDone, d.sizes[d.part] - d.position);
+                memcpy (buffer + numDone, d.parts[d.part] + d.position, numToCopy);
+                numDone += numToCopy;
+                d.position += numToCopy;
+
+                if (d.position == d.sizes[d.part])
+                {
+                    ++d.part;
+                    d.position = 0;
+                }
+            }
+
+            *bytes = numDone;
+            return numDone > 0 ? FlacNamespace::FLAC__STREAM_DECODER_READ_STATUS_CONTINUE
+                               : FlacNamespace::FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
+        }
+
+        static FlacNamespace::FLAC__StreamDecoderWriteStatus writeCallback (const FlacNamespace::FLAC__StreamDecoder*,
+                                                                            const FlacNamespace::FLAC__Frame* frame,
+                                                                            const FlacNamespace::FLAC__int32* const buffer[],
+                                                                            void* client_data)
+        {
+            auto& read = *static_cast<FrameGroupDecoder*> (client_data)->read;
+            const auto frameStart = (int64) frame->header.number.sample_number;
+            const auto range = read.range.getIntersectionWith ({ frameStart, frameStart + (int64) frame->header.blocksize });
+
+            if (range.isEmpty())
+                return FlacNamespace::FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+
+            const auto srcOffset = (int) (range.getStart() - frameStart);
+            const auto destOffset = read.startOffsetInDestBuffer + (int) (range.getStart() - read.range.getStart());
+            const auto numToCopy = (int) range.getLength();
+
+            for (int i = 0; i < jmin (read.numDestChannels, read.numChannels); ++i)
+            {
+                auto* src = buffer[i];
+                int n = i;
+
+                while (src == nullptr && n > 0)
+                    src = buffer [--n];
+
+                if (src != nullptr && read.destSamples[i] != nullptr)
+                {
+                    auto* dest = read.destSamples[i] + destOffset;
+                    src += srcOffset;
+
+                    for (int j = 0; j < numToCopy; ++j)
+                        dest[j] = src[j] << read.bitsToShift;
+                }
+            }
+
+            read.numSamplesDecoded += numToCopy;
+            return FlacNamespace::FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+        }
+
+        static void errorCallback (const FlacNamespace::FLAC__StreamDecoder*, FlacNamespace::FLAC__StreamDecoderErrorStatus, void*)
+        {
+            // Any samples that are lost will be noticed because they haven't been counted
+        }
+
+        ParallelRead* read = nullptr;
+        const uint8* parts[2] {};   // a copy of the stream header, then the frames
+        size_t sizes[2] {};
+        int part = 0;
+        size_t position = 0;
+    };
+
+    void addToFrameIndex (FramePosition position)
+    {
+        auto existing = std::lower_bound (frameIndex.begin(), frameIndex.end(), position.firstSample,
+                                          [] (const FramePosition& p, int64 sample) { return p.firstSample < sample; });
+
+        if (existing == frameIndex.end() || existing->firstSample != position.firstSample)
+            frameIndex.insert (existing, position);
+    }
+
+    uint64 getFirstSample (const FlacFileHelpers::FrameHeader& header) const noexcept
+    {
+        return header.variableBlockSize ? header.number : header.number * streamInfo.max_blocksize;
+    }
+
+    /*  Reads the compressed data that covers a range of samples, starting from a known
+        frame, and finds the frames in it by checking the header and CRC-16 of each one.
+        Returns the frames that overlap the range, and the offset at which the last of
+        them ends.
+    */
+    bool findFrames (FramePosition start, Range<int64> range, MemoryBlock& data,
+                     std::vector<FramePosition>& frames, size_t& endOfFrames)
+    {
+        using namespace FlacFileHelpers;
+
+        constexpr size_t readSize = 1 << 18;
+
+        if (! input->setPosition (start.byteOffset))
+            return false;
+
+        size_t numRead = 0;
+        bool exhausted = false;
+
+        const auto ensureAvailable = [&] (size_t end)
+        {
+            while (numRead < end && ! exhausted)
+            {
+                if (data.getSize() < numRead + readSize)
+                    data.ensureSize (jmax (numRead + readSize, data.getSize() * 2));
+
+                const auto n = input->read (static_cast<char*> (data.getData()) + numRead, (int) readSize);
+
+                if (n > 0)
+                    numRead += (size_t) n;
+                else
+                    exhausted = true;
+            }
+
+            return numRead >= end;
+        };
+
+        const auto getBytes = [&] { return static_cast<const uint8*> (data.getData()); };
+
+        FrameHeader header;
+        ensureAvailable (maxFrameHeaderSize);
+
+        if (! parseFrameHeader (getBytes(), numRead, header) || (int64) getFirstSample (header) != start.firstSample)
+            return false;
+
+        size_t frameStart = 0;
+        int64 frameFirstSample = start.firstSample;
+
+        for (int frameNumber = 0;; ++frameNumber)
+        {
+            if (frameFirstSample + header.numSamples > range.getStart())
+                frames.push_back ({ frameFirstSample, (int64) frameStart });
+
+            if (frameNumber % framesPerIndexEntry == 0)
+                addToFrameIndex ({ frameFirstSample, start.byteOffset + (int64) frameStart });
+
+            const auto nextFirstSample = frameFirstSample + header.numSamples;
+            auto pos = frameStart + (size_t) jmax (header.size + 2, (int) streamInfo.min_framesize);
+            FrameHeader next;
+
+            for (;; ++pos)
+            {
+                if (! ensureAvailable (pos + maxFrameHeaderSize) && pos + 6 > numRead)
+                {
+                    // that was the last frame in the stream
+                    endOfFrames = numRead;
+                    return ! frames.empty();
+                }
+
+                const auto* bytes = getBytes();
+
+                if (bytes[pos] != 0xff)
+                {
+                    // skip straight to the next byte that could start a sync code
+                    auto* found = std::memchr (bytes + pos, 0xff, numRead - pos);
+                    pos = (found != nullptr ? (size_t) (static_cast<const uint8*> (found) - bytes) : numRead) - 1;
+                    continue;
+                }
+
+                if (parseFrameHeader (bytes + pos, numRead - pos, next)
+                     && (int64) getFirstSample (next) == nextFirstSample
+                     && FlacNamespace::FLAC__crc16 (bytes + frameStart, (uint32) (pos - 2 - frameStart))
+                            == ((bytes[pos - 2] << 8) | bytes[pos - 1]))
+                {
+                    break;
+                }
+            }
+
+            if (nextFirstSample >= range.getEnd())
+            {
+                addToFrameIndex ({ nextFirstSample, start.byteOffset + (int64) pos });
+                endOfFrames = pos;
+                return ! frames.empty();
+            }
+
+            header = next;
+            frameStart = pos;
+            frameFirstSample = nextFirstSample;
+        }
+    }
+
+    bool readSamplesInParallel (int* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
+                                int64 startSampleInFile, int numSamples)
+    {
+        const Range<int64> range (startSampleInFile, jmin (lengthInSamples, startSampleInFile + numSamples));
+
+        if (range.isEmpty() || range.getStart() < 0
+             || (streamInfo.min_blocksize != streamInfo.max_blocksize && streamInfo.min_blocksize != 0))
+            return false;
+
+        auto known = std::upper_bound (frameIndex.begin(), frameIndex.end(), range.getStart(),
+                                       [] (int64 sample, const FramePosition& p) { return sample < p.firstSample; });
+
+        // If the closest frame we know about is a long way back, it's quicker to let
+        // libFLAC seek to the start of the range
+        if (known == frameIndex.begin() || range.getStart() - std::prev (known)->firstSample > 4 * (int64) numSamples)
+            return false;
+
+        MemoryBlock data;
+        std::vector<FramePosition> frames;
+        size_t endOfFrames = 0;
+
+        const auto found = findFrames (*std::prev (known), range, data, frames, endOfFrames);
+
+        // the stream position has moved, so the next sequential read will need to seek
+        bufferedRange = emptyRange (std::numeric_limits<int64>::max());
+
+        const auto numGroups = jmin ((int) frames.size() / framesPerParallelGroup, 4 * (threadPool->getNumThreads() + 1));
+
+        if (! found || numGroups < 2)
+            return false;
+
+        FlacNamespace::FLAC__byte streamHeader[4 + 4 + FLAC__STREAM_METADATA_STREAMINFO_LENGTH] = { 'f', 'L', 'a', 'C', 0x80, 0, 0, FLAC__STREAM_METADATA_STREAMINFO_LENGTH };
+        FlacFileHelpers::packStreamInfo (streamInfo, streamHeader + 8);
+
+        ParallelRead read { destSamples, numDestChannels, startOffsetInDestBuffer, range,
+                            (int) numChannels, 32 - (int) bitsPerSample };
+
+        FlacFileHelpers::forEachInParallel (*threadPool, numGroups, [&] (int group)
+        {
+            const auto first = (size_t) group * frames.size() / (size_t) numGroups;
+            const auto last  = (size_t) (group + 1) * frames.size() / (size_t) numGroups;
+            const auto start = (size_t) frames[first].byteOffset;
+            const auto end   = last < frames.size() ? (size_t) frames[last].byteOffset : endOfFrames;
+
+            FrameGroupDecoder groupDecoder;
+            groupDecoder.read = &read;
+            groupDecoder.parts[0] = streamHeader;
+            groupDecoder.sizes[0] = sizeof (streamHeader);
+            groupDecoder.parts[1] = static_cast<const uint8*> (data.getData()) + start;
+            groupDecoder.sizes[1] = end - start;
+            groupDecoder.decode();
+        });
+
+        if (read.numSamplesDecoded != range.getLength())
+            return false;
+
+        if (range.getLength() < numSamples)
+            for (int i = numDestChannels; --i >= 0;)
+                if (destSamples[i] != nullptr)
+                    zeromem (destSamples[i] + startOffsetInDestBuffer + range.getLength(),
+                             (size_t) (numSamples - range.getLength()) * sizeof (int));
+
+        return true;
+    }
+
     //==============================================================================
     static FlacNamespace::FLAC__StreamDecoderReadStatus readCallback_ (const FlacNamespace::FLAC__StreamDecoder*, FlacNamespace::FLAC__byte buffer[], size_t* bytes, void* client_data)
     {
@@ -378,7 +896,10 @@ public:
                                    const FlacNamespace::FLAC__StreamMetadata* metadata,
                                    void* client_data)
     {
-        static_cast<FlacReader*> (client_data)->useMetadata (metadata->data.stream_info);
+        if (metadata->type == FlacNamespace::FLAC__METADATA_TYPE_SEEKTABLE)
+            static_cast<FlacReader*> (client_data)->useSeekTable (metadata->data.seek_table);
+        else
+            static_cast<FlacReader*> (client_data)->useMetadata (metadata->data.stream_info);
     }
 
     static void errorCallback_ (const FlacNamespace::FLAC__StreamDecoder*, FlacNamespace::FLAC__StreamDecoderErrorStatus, void*)
@@ -386,11 +907,19 @@ public:
     }
 
 private:
+    static constexpr int framesPerParallelGroup = 4;
+    static constexpr int framesPerIndexEntry = 16;
+
     FlacNamespace::FLAC__StreamDecoder* decoder;
     AudioBuffer<float> reservoir;
     Range<int64> bufferedRange;
     bool ok = false, scanningForLength = false;
 
+    ThreadPool* threadPool;
+    FlacNamespace::FLAC__StreamMetadata_StreamInfo streamInfo {};
+    std::vector<FlacNamespace::FLAC__StreamMetadata_SeekPoint> seekPoints;
+    std::vector<FramePosition> frameIndex;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlacReader)
 };
 
@@ -399,33 +928,50 @@ private:
 class FlacWriter final : public AudioFormatWriter
 {
 public:
-    FlacWriter (OutputStream* out, double rate, uint32 numChans, uint32 bits, int qualityOptionIndex)
+    FlacWriter (OutputStream* out, double rate, uint32 numChans, uint32 bits, int qualityOptionIndex, ThreadPool* pool)
         : AudioFormatWriter (out, flacFormatName, rate, numChans, bits),
-          streamStartPos (output != nullptr ? jmax (output->getPosition(), 0ll) : 0ll)
+          streamStartPos (output != nullptr ? jmax (output->getPosition(), 0ll) : 0ll),
+          compressionLevel (qualityOptionIndex)
     {
         encoder = FlacNamespace::FLAC__stream_encoder_new();
-
-        if (qualityOptionIndex > 0)
-            FLAC__stream_encoder_set_compression_level (encoder, (uint32) jmin (8, qualityOptionIndex));
-
-        FLAC__stream_encoder_set_do_mid_side_stereo (encoder, numChannels == 2);
-        FLAC__stream_encoder_set_loose_mid_side_stereo (encoder, numChannels == 2);
-        FLAC__stream_encoder_set_channels (encoder, numChannels);
-        FLAC__stream_encoder_set_bits_per_sample (encoder, jmin ((unsigned int) 24, bitsPerSample));
-        FLAC__stream_encoder_set_sample_rate (encoder, (unsigned int) sampleRate);
-        FLAC__stream_encoder_set_blocksize (encoder, 0);
-        FLAC__stream_encoder_set_do_escape_coding (encoder, true);
+        configureEncoder (encoder);
 
         ok = FLAC__stream_encoder_init_stream (encoder,
                                                encodeWriteCallback, encodeSeekCallback,
                                                encodeTellCallback, encodeMetadataCallback,
                                                this) == FlacNamespace::FLAC__STREAM_ENCODER_INIT_STATUS_OK;
+
+        if (ok && pool != nullptr)
+        {
+            // The audio is collected into batches of jobs, each of which covers a whole number
+            // of frames, and is encoded separately. This main encoder just writes the headers.
+            threadPool = pool;
+            blockSize = (int) FLAC__stream_encoder_get_blocksize (encoder);
+            auto framesPerJob = jmax (2, samplesPerJobForAllChannels / ((int) numChannels * blockSize));
+
+            // Loose mid-side stereo only compares both channel assignments at the start of each of
+            // its periods, and sticks with the winner until the next one. Each job starts with a
+            // fresh encoder, so it must begin at the start of a period to make the same choices.
+            if (FLAC__stream_encoder_get_loose_mid_side_stereo (encoder))
+            {
+                const auto period = jmax (1, (int) ((double) (uint32) sampleRate * 0.4 / (double) blockSize + 0.5));
+                framesPerJob = ((framesPerJob + period - 1) / period) * period;
+            }
+
+            samplesPerJob = blockSize * framesPerJob;
+            pendingCapacity = samplesPerJob * 2 * (threadPool->getNumThreads() + 1);
+            pending.malloc ((size_t) numChannels * (size_t) pendingCapacity);
+            FlacNamespace::FLAC__MD5Init (&md5);
+        }
     }
 
     ~FlacWriter() override
     {
         if (ok)
         {
+            if (threadPool != nullptr)
+                encodePending();
+
             FlacNamespace::FLAC__stream_encoder_finish (encoder);
             output->flush();
         }
@@ -435,15 +981,38 @@ public:
                               // to the caller of createWriter()
         }
 
+        if (threadPool != nullptr && ! md5Finished)
+        {
+            FlacNamespace::FLAC__byte unused[16];
+            FlacNamespace::FLAC__MD5Final (unused, &md5);
+        }
+
         FlacNamespace::FLAC__stream_encoder_delete (encoder);
     }
 
+    void configureEncoder (FlacNamespace::FLAC__StreamEncoder* encoderToConfigure) const
+    {
+        if (compressionLevel > 0)
+            FLAC__stream_encoder_set_compression_level (encoderToConfigure, (uint32) jmin (8, compressionLevel));
+
+        FLAC__stream_encoder_set_do_mid_side_stereo (encoderToConfigure, numChannels == 2);
+        FLAC__stream_encoder_set_loose_mid_side_stereo (encoderToConfigure, numChannels == 2);
+        FLAC__stream_encoder_set_channels (encoderToConfigure, numChannels);
+        FLAC__stream_encoder_set_bits_per_sample (encoderToConfigure, jmin ((unsigned int) 24, bitsPerSample));
+        FLAC__stream_encoder_set_sample_rate (encoderToConfigure, (unsigned int) sampleRate);
+        FLAC__stream_encoder_set_blocksize (encoderToConfigure, 0);
+        FLAC__stream_encoder_set_do_escape_coding (encoderToConfigure, true);
+    }
+
     //==============================================================================
     bool write (const int** samplesToWrite, int numSamples) override
     {
         if (! ok)
             return false;
 
+        if (threadPool != nullptr)
+            return writeInParallel (samplesToWrite, numSamples);
+
         HeapBlock<int*> channels;
         HeapBlock<int> temp;
         auto bitsToShift = 32 - (int) bitsPerSample;
@@ -476,36 +1045,157 @@ public:
         return output->write (data, (size_t) size);
     }
 
-    static void packUint32 (FlacNamespace::FLAC__uint32 val, FlacNamespace::FLAC__byte* b, const int bytes)
+    //==============================================================================
+    /*  The frames encoded from one part of a batch of audio. */
+    struct EncodedJob
     {
-        b += bytes;
+        MemoryOutputStream frames;
+        uint64 firstFrameNumber = 0;
+        uint32 minFrameSize = std::numeric_limits<uint32>::max(), maxFrameSize = 0;
+        bool ok = false;
+    };
 
-        for (int i = 0; i < bytes; ++i)
+    bool writeInParallel (const int** samplesToWrite, int numSamples)
+    {
+        const auto bitsToShift = 32 - (int) bitsPerSample;
+
+        for (int done = 0; done < numSamples;)
         {
-            *(--b) = (FlacNamespace::FLAC__byte) (val & 0xff);
-            val >>= 8;
+            const auto numToCopy = jmin (numSamples - done, pendingCapacity - numPending);
+
+            for (unsigned int i = 0; i < numChannels; ++i)
+            {
+                auto* dest = getPendingChannel ((int) i) + numPending;
+
+                if (samplesToWrite[i] == nullptr)
+                    zeromem (dest, (size_t) numToCopy * sizeof (int));
+                else
+                    for (int j = 0; j < numToCopy; ++j)
+                        dest[j] = (samplesToWrite[i][done + j] >> bitsToShift);
+            }
+
+            numPending += numToCopy;
+            done += numToCopy;
+
+            if (numPending == pendingCapacity && ! encodePending())
+                return false;
+        }
+
+        return true;
+    }
+
+    /*  Encodes the collected audio as a series of jobs, and writes their frames in order. */
+    bool encodePending()
+    {
+        if (numPending == 0)
+            return true;
+
+        const auto numJobs = (numPending + samplesPerJob - 1) / samplesPerJob;
+        const auto framesPerJob = (uint64) (samplesPerJob / blockSize);
+        std::vector<EncodedJob> jobs ((size_t) numJobs);
+
+        FlacFileHelpers::forEachInParallel (*threadPool, numJobs, [&] (int index)
+        {
+            const auto start = index * samplesPerJob;
+            auto& job = jobs[(size_t) index];
+            job.firstFrameNumber = numFramesWritten + (uint64) index * framesPerJob;
+            encodeJob (job, start, jmin (samplesPerJob, numPending - start));
+        });
+
+        HeapBlock<const FlacNamespace::FLAC__int32*> channels (numChannels);
+
+        for (unsigned int i = 0; i < numChannels; ++i)
+            channels[i] = getPendingChannel ((int) i);
+
+        FlacNamespace::FLAC__MD5Accumulate (&md5, channels, numChannels, (uint32) numPending, (jmin (24u, bitsPerSample) + 7) / 8);
+
+        for (auto& job : jobs)
+        {
+            if (! job.ok || ! output->write (job.frames.getData(), job.frames.getDataSize()))
+                return false;
+
+            minFrameSize = jmin (minFrameSize, job.minFrameSize);
+            maxFrameSize = jmax (maxFrameSize, job.maxFrameSize);
+        }
+
+        numFramesWritten += (uint64) ((numPending + blockSize - 1) / blockSize);
+        numSamplesWritten += (uint64) numPending;
+        numPending = 0;
+        return true;
+    }
+
+    void encodeJob (EncodedJob& job, int startSample, int numSamples) const
+    {
+        auto* jobEncoder = FlacNamespace::FLAC__stream_encoder_new();
+        configureEncoder (jobEncoder);
+        FLAC__stream_encoder_set_blocksize (jobEncoder, (uint32) blockSize);
+        FLAC__stream_encoder_set_do_md5 (jobEncoder, false);
+
+        if (FLAC__stream_encoder_init_stream (jobEncoder, jobWriteCallback, nullptr, nullptr, nullptr, &job)
+                == FlacNamespace::FLAC__STREAM_ENCODER_INIT_STATUS_OK)
+        {
+            HeapBlock<const FlacNamespace::FLAC__int32*> channels (numChannels);
+
+            for (unsigned int i = 0; i < numChannels; ++i)
+                channels[i] = getPendingChannel ((int) i) + startSample;
+
+            job.ok = FLAC__stream_encoder_process (jobEncoder, channels, (uint32) numSamples) != 0;
+            job.ok = FLAC__stream_encoder_finish (jobEncoder) != 0 && job.ok;
         }
+
+        FlacNamespace::FLAC__stream_encoder_delete (jobEncoder);
+    }
+
+    int* getPendingChannel (int channel) const noexcept
+    {
+        return pending + (size_t) channel * (size_t) pendingCapacity;
     }
 
+    static FlacNamespace::FLAC__StreamEncoderWriteStatus jobWriteCallback (const FlacNamespace::FLAC__StreamEncoder*,
+                                                                           const FlacNamespace::FLAC__byte buffer[],
+                                                                           size_t bytes,
+                                                                           unsigned int samples,
+                                                                           unsigned int /*current_frame*/,
+                                                                           void* client_data)
+    {
+        // the job's own stream header isn't needed
+        if (samples == 0)
+            return FlacNamespace::FLAC__STREAM_ENCODER_WRITE_STATUS_OK;
+
+        auto& job = *static_cast<EncodedJob*> (client_data);
+        FlacFileHelpers::FrameHeader header;
+
+        if (! FlacFileHelpers::parseFrameHeader (buffer, bytes, header))
+            return FlacNamespace::FLAC__STREAM_ENCODER_WRITE_STATUS_FATAL_ERROR;
+
+        const auto start = job.frames.getPosition();
+        FlacFileHelpers::writeRenumberedFrame (buffer, bytes, header, job.firstFrameNumber + header.number, job.frames);
+
+        const auto frameSize = (uint32) (job.frames.getPosition() - start);
+        job.minFrameSize = jmin (job.minFrameSize, frameSize);
+        job.maxFrameSize = jmax (job.maxFrameSize, frameSize);
+
+        return FlacNamespace::FLAC__STREAM_ENCODER_WRITE_STATUS_OK;
+    }
+
+    //==============================================================================
     void writeMetaData (const FlacNamespace::FLAC__StreamMetadata* metadata)
     {
         using namespace FlacNamespace;
-        auto& info = metadata->data.stream_info;
+        auto info = metadata->data.stream_info;
 
-        unsigned char buffer[FLAC__STREAM_METADATA_STREAMINFO_LENGTH];
-        const unsigned int channelsMinus1 = info.channels - 1;
-        const unsigned int bitsMinus1 = info.bits_per_sample - 1;
+        if (threadPool != nullptr)
+        {
+            // the main encoder hasn't seen any of the audio, so it can't fill these in
+            info.total_samples = numSamplesWritten;
+            info.min_framesize = maxFrameSize > 0 ? minFrameSize : 0;
+            info.max_framesize = maxFrameSize;
+            FLAC__MD5Final (info.md5sum, &md5);
+            md5Finished = true;
+        }
 
-        packUint32 (info.min_blocksize, buffer, 2);
-        packUint32 (info.max_blocksize, buffer + 2, 2);
-        packUint32 (info.min_framesize, buffer + 4, 3);
-        packUint32 (info.max_framesize, buffer + 7, 3);
-        buffer[10] = (uint8) ((info.sample_rate >> 12) & 0xff);
-        buffer[11] = (uint8) ((info.sample_rate >> 4) & 0xff);
-        buffer[12] = (uint8) (((info.sample_rate & 0x0f) << 4) | (channelsMinus1 << 1) | (bitsMinus1 >> 4));
-        buffer[13] = (FLAC__byte) (((bitsMinus1 & 0x0f) << 4) | (unsigned int) ((info.total_samples >> 32) & 0x0f));
-        packUint32 ((FLAC__uint32) info.total_samples, buffer + 14, 4);
-        memcpy (buffer + 18, info.md5sum, 16);
+        unsigned char buffer[FLAC__STREAM_METADATA_STREAMINFO_LENGTH];
+        FlacFileHelpers::packStreamInfo (info, buffer);
 
         [[maybe_unused]] const bool seekOk = output->setPosition (streamStartPos + 4);
 
@@ -552,8 +1242,19 @@ public:
     bool ok = false;
 
 private:
+    static constexpr int samplesPerJobForAllChannels = 1 << 18;
+
     FlacNamespace::FLAC__StreamEncoder* encoder;
     int64 streamStartPos;
+    int compressionLevel;
+
+    ThreadPool* threadPool = nullptr;
+    int blockSize = 0, samplesPerJob = 0, pendingCapacity = 0, numPending = 0;
+    HeapBlock<int> pending;
+    uint64 numFramesWritten = 0, numSamplesWritten = 0;
+    uint32 minFrameSize = std::numeric_limits<uint32>::max(), maxFrameSize = 0;
+    FlacNamespace::FLAC__MD5Context md5;
+    bool md5Finished = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlacWriter)
 };
@@ -580,7 +1281,7 @@ bool FlacAudioFormat::isCompressed()    { return true; }
 
 AudioFormatReader* FlacAudioFormat::createReaderFor (InputStream* in, const bool deleteStreamIfOpeningFails)
 {
-    std::unique_ptr<FlacReader> r (new FlacReader (in));
+    std::unique_ptr<FlacReader> r (new FlacReader (in, threadPool));
 
     if (r->sampleRate > 0)
         return r.release();
@@ -601,7 +1302,7 @@ AudioFormatWriter* FlacAudioFormat::createWriterFor (OutputStream* out,
     if (out != nullptr && getPossibleBitDepths().contains (bitsPerSample))
     {
         std::unique_ptr<FlacWriter> w (new FlacWriter (out, sampleRate, numberOfChannels,
-                                                     (uint32) bitsPerSample, qualityOptionIndex));
+                                                     (uint32) bitsPerSample, qualityOptionIndex, threadPool));
         if (w->ok)
             return w.release();
     }
@@ -614,6 +1315,130 @@ StringArray FlacAudioFormat::getQualityOptions()
     return { "0 (Fastest)", "1", "2", "3", "4", "5 (Default)","6", "7", "8 (Highest quality)" };
 }
 
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+struct FlacAudioFormatTests final : public UnitTest
+{
+    FlacAudioFormatTests()
+        : UnitTest ("FLAC audio format tests", UnitTestCategories::audio)
+    {}
+
+    void runTest() override
+    {
+        constexpr int numChannels = 2;
+        constexpr int numSamples = 1000003; // deliberately not a whole number of blocks
+
+        AudioBuffer<int> source (numChannels, numSamples);
+        Random random (0x1234);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < numSamples; ++i)
+                source.setSample (ch, i, (((int) (std::sin (i * 0.01 * (ch + 1)) * 0x300000)
+                                             + random.nextInt (0x10000) - 0x8000) * 256));
+
+        ThreadPool pool { ThreadPoolOptions{}.withNumberOfThreads (2) };
+
+        FlacAudioFormat sequentialFormat, parallelFormat;
+        parallelFormat.setThreadPool (&pool);
+
+        const auto sequentialData = write (sequentialFormat, source);
+        const auto parallelData = write (parallelFormat, source);
+
+        {
+            beginTest ("Encoding in parallel produces the same stream as encoding sequentially");
+
+            expect (sequentialData.getSize() > 0);
+            expect (parallelData == sequentialData);
+
+            // Loose mid-side stereo works in periods that depend on the sample rate
+            for (const auto sampleRate : { 48000.0, 96000.0, 22050.0 })
+            {
+                const auto expected = write (sequentialFormat, source, sampleRate);
+                expect (write (parallelFormat, source, sampleRate) == expected, "Mismatch at " + String (sampleRate) + "Hz");
+            }
+        }
+
+        {
+            beginTest ("Audio encoded in parallel can be read back");
+
+            auto reader = createReader (sequentialFormat, parallelData);
+            expect (reader != nullptr);
+            expectEquals (reader->lengthInSamples, (int64) numSamples);
+
+            AudioBuffer<int> result (numChannels, numSamples);
+            reader->read (result.getArrayOfWritePointers(), numChannels, 0, numSamples, false);
+            expect (buffersMatch (source, 0, result, numSamples));
+        }
+
+        {
+            beginTest ("Reading in parallel matches reading sequentially");
+
+            auto sequentialReader = createReader (sequentialFormat, sequentialData);
+            auto parallelReader = createReader (parallelFormat, sequentialData);
+
+            for (const auto& [start, length] : { std::pair<int64, int> { 0, numSamples },
+                                                { 12345, 100000 },
+                                                { 500000, 200000 },
+                                                { 3, 50 },
+                                                { 100, 300000 },
+                                                { numSamples - 60000, 100000 },
+                                                { 4096, 65536 } })
+            {
+                AudioBuffer<int> expected (numChannels, length), result (numChannels, length);
+                sequentialReader->read (expected.getArrayOfWritePointers(), numChannels, start, length, false);
+                parallelReader->read (result.getArrayOfWritePointers(), numChannels, start, length, false);
+
+                expect (buffersMatch (expected, 0, result, length), "Mismatch reading from " + String (start));
+            }
+        }
+    }
+
+    static MemoryBlock write (FlacAudioFormat& format, const AudioBuffer<int>& source, double sampleRate = 44100.0)
+    {
+        MemoryBlock block;
+
+        {
+            std::unique_ptr<AudioFormatWriter> writer (format.createWriterFor (new MemoryOutputStream (block, false),
+                                                                               sampleRate, (unsigned int) source.getNumChannels(),
+                                                                               24, {}, 0));
+            if (writer == nullptr)
+                return {};
+
+            // written in awkwardly sized pieces, to make sure they're collected correctly
+            HeapBlock<const int*> channels ((size_t) source.getNumChannels());
+
+            for (int start = 0; start < source.getNumSamples(); start += 7001)
+            {
+                for (int ch = 0; ch < source.getNumChannels(); ++ch)
+                    channels[ch] = source.getReadPointer (ch, start);
+
+                writer->write (channels, jmin (7001, source.getNumSamples() - start));
+            }
+        }
+
+        return block;
+    }
+
+    static std::unique_ptr<AudioFormatReader> createReader (FlacAudioFormat& format, const MemoryBlock& data)
+    {
+        return std::unique_ptr<AudioFormatReader> (format.createReaderFor (new MemoryInputStream (data, false), true));
+    }
+
+    static bool buffersMatch (const AudioBuffer<int>& a, int startInA, const AudioBuffer<int>& b, int numSamples)
+    {
+        for (int ch = 0; ch < a.getNumChannels(); ++ch)
+            if (std::memcmp (a.getReadPointer (ch, startInA), b.getReadPointer (ch), (size_t) numSamples * sizeof (int)) != 0)
+                return false;
+
+        return true;
+    }
+};
+
+static FlacAudioFormatTests flacAudioFormatTests;
+
+#endif
+
 #endif
 
 } // namespace juce
@@ -65,7 +65,27 @@ public:
                                         int qualityOptionIndex) override;
     using AudioFormat::createWriterFor;
 
+    //==============================================================================
+    /** Makes the readers and writers created by this format share out their work
+        between the threads of a pool.
+
+        Readers decode large reads by splitting the stream at frame boundaries, and
+        decoding groups of frames concurrently. Writers collect the incoming audio and
+        encode several chunks of frames at once. The calling thread also does some of
+        the work, so this still helps when the pool is busy with other jobs.
+
+        The pool must outlive all the readers and writers that are created while it is
+        set. Passing nullptr, which is the default, makes them do all their work on the
+        calling thread.
+    */
+    void setThreadPool (ThreadPool* poolToUse) noexcept     { threadPool = poolToUse; }
+
+    /** Returns the pool set with setThreadPool(), or nullptr. */
+    ThreadPool* getThreadPool() const noexcept              { return threadPool; }
+
 private:
+    ThreadPool* threadPool = nullptr;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlacAudioFormat)
 };
 
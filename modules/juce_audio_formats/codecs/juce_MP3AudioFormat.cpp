@@ -39,6 +39,187 @@ namespace juce
 */
 #if JUCE_USE_MP3AUDIOFORMAT
 
+//==============================================================================
+/*  Holds the frame indexes of the files that an MP3AudioFormat's readers have read, so
+    that each file only needs to be scanned once.
+
+    The total number of positions held is limited, and the least recently used indexes are
+    dropped to make room for new ones.
+*/
+struct MP3AudioFormat::FrameIndexCache
+{
+    /*  A complete set of frame positions, and the state of the file they were found in. */
+    struct Entry
+    {
+        int64 fileSize = 0, modificationTime = 0;
+        Array<int64> positions;
+        uint64 lastUsed = 0;
+    };
+
+    bool find (const File& file, Array<int64>& positions)
+    {
+        const auto fileSize = file.getSize();
+        const auto modificationTime = file.getLastModificationTime().toMilliseconds();
+
+        {
+            const ScopedLock sl (lock);
+            auto found = entries.find (file.getFullPathName());
+
+            if (found != entries.end()
+                 && found->second.fileSize == fileSize
+                 && found->second.modificationTime == modificationTime)
+            {
+                found->second.lastUsed = ++useCount;
+                positions = found->second.positions;
+                return true;
+            }
+        }
+
+        Entry entry;
+
+        if (! persistIndexes
+             || ! readIndexFile (MP3AudioFormat::getFrameIndexFile (file), entry)
+             || entry.fileSize != fileSize
+             || entry.modificationTime != modificationTime)
+            return false;
+
+        positions = entry.positions;
+        store (file.getFullPathName(), std::move (entry));
+        return true;
+    }
+
+    void add (const File& file, const Array<int64>& positions)
+    {
+        Entry entry { file.getSize(), file.getLastModificationTime().toMilliseconds(), positions };
+
+        if (persistIndexes)
+            writeIndexFile (MP3AudioFormat::getFrameIndexFile (file), entry);
+
+        store (file.getFullPathName(), std::move (entry));
+    }
+
+    void clear()
+    {
+        const ScopedLock sl (lock);
+        entries.clear();
+        numPositions = 0;
+    }
+
+    void store (const String& path, Entry&& entry)
+    {
+        const ScopedLock sl (lock);
+
+        if (auto old = entries.find (path); old != entries.end())
+        {
+            numPositions -= old->second.positions.size();
+            entries.erase (old);
+        }
+
+        // An index that wouldn't fit on its own isn't worth evicting everything else for
+        if (entry.positions.size() > maxNumPositions)
+            return;
+
+        numPositions += entry.positions.size();
+        entry.lastUsed = ++useCount;
+        entries[path] = std::move (entry);
+
+        while (numPositions > maxNumPositions)
+        {
+            const auto oldest = std::min_element (entries.begin(), entries.end(), [] (const auto& a, const auto& b)
+            {
+                return a.second.lastUsed < b.second.lastUsed;
+            });
+
+            numPositions -= oldest->second.positions.size();
+            entries.erase (oldest);
+        }
+    }
+
+    static bool readIndexFile (const File& indexFile, Entry& entry)
+    {
+        MemoryBlock data;
+
+        if (! indexFile.loadFileAsData (data))
+            return false;
+
+        MemoryInputStream in (data, false);
+
+        if (in.readInt() != magicNumber || in.readInt() != formatVersion)
+            return false;
+
+        entry.fileSize = in.readInt64();
+        entry.modificationTime = in.readInt64();
+
+        const auto numPositions = in.readCompressedInt();
+
+        if (numPositions <= 0 || numPositions > in.getNumBytesRemaining())
+            return false;
+
+        entry.positions.ensureStorageAllocated (numPositions);
+        int64 position = 0;
+
+        for (int i = 0; i < numPositions; ++i)
+        {
+            const auto delta = in.readCompressedInt();
+
+            if (delta < 0 || (i > 0 && delta == 0))
+                return false;
+
+            position += delta;
+            entry.positions.add (position);
+        }
+
+        return position < entry.fileSize;
+    }
+
+    static bool writeIndexFile (const File& indexFile, const Entry& entry)
+    {
+        TemporaryFile temp (indexFile);
+
+        {
+            FileOutputStream out (temp.getFile());
+
+            if (out.failedToOpen())
+                return false;
+
+            out.writeInt (magicNumber);
+            out.writeInt (formatVersion);
+            out.writeInt64 (entry.fileSize);
+            out.writeInt64 (entry.modificationTime);
+            out.writeCompressedInt (entry.positions.size());
+
+            int64 lastPosition = 0;
+
+            for (auto position : entry.positions)
+            {
+                if (position - lastPosition > std::numeric_limits<int>::max())
+                    return false;
+
+                out.writeCompressedInt ((int) (position - lastPosition));
+                lastPosition = position;
+            }
+
+            out.flush();
+
+            if (out.getStatus().failed())
+                return false;
+        }
+
+        return temp.overwriteTargetFileWithTemporary();
+    }
+
+    static constexpr int magicNumber = (int) ByteOrder::makeInt ('J', 'M', 'F', 'I');
+    static constexpr int formatVersion = 1;
+
+    CriticalSection lock;
+    std::map<String, Entry> entries;
+    int numPositions = 0;
+    uint64 useCount = 0;
+    int maxNumPositions = 1 << 20; // 8MB, or about thirty hours of 44.1kHz audio
+    std::atomic<bool> shareIndexes { true }, persistIndexes { false };
+};
+
+//==============================================================================
 namespace MP3Decoder
 {
 
@@ -1558,8 +1739,14 @@ struct MP3Stream
     {
         frameIndex = jmax (0, frameIndex);
 
+        if (frameIndex >= frameStreamPositions.size() * storedStartPosInterval)
+            indexRemainingFrames();
+
         while (frameIndex >= frameStreamPositions.size() * storedStartPosInterval)
         {
+            if (allFramesIndexed)
+                return false;
+
             int dummy = 0;
             auto result = decodeNextBlock (nullptr, nullptr, dummy);
 
@@ -1579,6 +1766,82 @@ struct MP3Stream
         return true;
     }
 
+    /*  Finds the positions of all the frames after the last one that's known by hopping
+        from header to header, which is much quicker than walking through them with
+        decodeNextBlock(). The positions are found with the same scan that the decoder
+        uses, so they're identical to the ones it would have found.
+
+        Frames that use the free format bitrate don't say how long they are, so any that
+        come after one of those are left to be found by decoding.
+    */
+    void indexRemainingFrames()
+    {
+        if (allFramesIndexed || ! canIndexFrames || frameStreamPositions.isEmpty())
+            return;
+
+        const auto originalPosition = stream.getPosition();
+        const auto originalFrameIndex = currentFrameIndex;
+        const auto originalFrame = frame;
+
+        currentFrameIndex = (frameStreamPositions.size() - 1) * storedStartPosInterval;
+        stream.setPosition (frameStreamPositions.getLast());
+
+        // The decoder looks for a VBR header in the first frame after it's been reset, and
+        // in the frame after any junk that it has had to skip
+        bool checkForVBRHeader = true;
+
+        for (;;)
+        {
+            const auto nextFrameOffset = scanForNextFrameHeader (false);
+
+            if (nextFrameOffset < 0)
+            {
+                allFramesIndexed = true;
+                break;
+            }
+
+            if (checkForVBRHeader)
+            {
+                if (const auto vbrHeaderSize = getVBRHeaderSize(); vbrHeaderSize > 0)
+                {
+                    stream.setPosition (stream.getPosition() + vbrHeaderSize);
+                    continue;
+                }
+            }
+
+            checkForVBRHeader = nextFrameOffset > 0;
+            stream.skipNextBytes (nextFrameOffset);
+
+            if (frame.decodeHeader ((uint32) stream.readIntBigEndian()) == MP3Frame::ParseSuccessful::no)
+            {
+                allFramesIndexed = true;
+                break;
+            }
+
+            if (frame.frameSize == 0)
+            {
+                canIndexFrames = false;
+                break;
+            }
+
+            stream.skipNextBytes (frame.frameSize);
+        }
+
+        frame = originalFrame;
+        currentFrameIndex = originalFrameIndex;
+        stream.setPosition (originalPosition);
+    }
+
+    /*  Replaces the known frame positions with a complete set that was found earlier. */
+    void setFrameIndex (const Array<int64>& positions)
+    {
+        frameStreamPositions = positions;
+        allFramesIndexed = true;
+    }
+
+    const Array<int64>& getFrameIndex() const noexcept     { return frameStreamPositions; }
+    bool hasIndexedAllFrames() const noexcept               { return allFramesIndexed; }
+
     MP3Frame frame;
     VBRTagData vbrTagData;
     BufferedInputStream stream;
@@ -1620,6 +1883,7 @@ private:
 
     enum { storedStartPosInterval = 4 };
     Array<int64> frameStreamPositions;
+    bool allFramesIndexed = false, canIndexFrames = true;
 
     struct SideInfoLayer1
     {
@@ -1741,6 +2005,17 @@ private:
         return offset;
     }
 
+    int getVBRHeaderSize()
+    {
+        const auto oldPos = stream.getPosition();
+        uint8 xing[194] {};
+        stream.read (xing, sizeof (xing));
+        stream.setPosition (oldPos);
+
+        VBRTagData tagData;
+        return tagData.read (xing) ? jmax (tagData.headersize, 1) : 0;
+    }
+
     void readVBRHeader()
     {
         auto oldPos = stream.getPosition();
@@ -2957,7 +3232,7 @@ static const char* const mp3FormatName = "MP3 file";
 class MP3Reader final : public AudioFormatReader
 {
 public:
-    MP3Reader (InputStream* const in)
+    MP3Reader (InputStream* const in, std::shared_ptr<MP3AudioFormat::FrameIndexCache> cache)
         : AudioFormatReader (in, mp3FormatName),
           stream (*in), currentPosition (0),
           decodedStart (0), decodedEnd (0)
@@ -2972,6 +3247,22 @@ public:
             sampleRate = stream.frame.getFrequency();
             numChannels = (unsigned int) stream.frame.numChannels;
             lengthInSamples = findLength (streamPos);
+
+            // Only files can share an index, as there's no other way to tell whether two
+            // streams contain the same data
+            if (auto* fileStream = dynamic_cast<FileInputStream*> (in); fileStream != nullptr && cache != nullptr)
+            {
+                frameIndexCache = std::move (cache);
+                sourceFile = fileStream->getFile();
+
+                Array<int64> positions;
+
+                if (frameIndexCache->find (sourceFile, positions))
+                {
+                    stream.setFrameIndex (positions);
+                    frameIndexCache = nullptr;
+                }
+            }
         }
     }
 
@@ -2986,7 +3277,15 @@ public:
 
         if (currentPosition != startSampleInFile)
         {
-            if (! stream.seek ((int) (startSampleInFile / 1152 - 1)))
+            const auto seekSucceeded = stream.seek ((int) (startSampleInFile / 1152 - 1));
+
+            if (frameIndexCache != nullptr && stream.hasIndexedAllFrames())
+            {
+                frameIndexCache->add (sourceFile, stream.getFrameIndex());
+                frameIndexCache = nullptr;
+            }
+
+            if (! seekSucceeded)
             {
                 currentPosition = -1;
                 createEmptyDecodedData();
@@ -3050,6 +3349,8 @@ public:
 
 private:
     MP3Stream stream;
+    std::shared_ptr<MP3AudioFormat::FrameIndexCache> frameIndexCache;
+    File sourceFile;
     int64 currentPosition;
     enum { decodedDataSize = 1152 };
     float decoded0[decodedDataSize], decoded1[decodedDataSize];
@@ -3141,7 +3442,12 @@ private:
 }
 
 //==============================================================================
-MP3AudioFormat::MP3AudioFormat()  : AudioFormat (MP3Decoder::mp3FormatName, ".mp3") {}
+MP3AudioFormat::MP3AudioFormat()
+    : AudioFormat (MP3Decoder::mp3FormatName, ".mp3"),
+      frameIndexCache (std::make_shared<FrameIndexCache>())
+{
+}
+
 MP3AudioFormat::~MP3AudioFormat() {}
 
 Array<int> MP3AudioFormat::getPossibleSampleRates() { return {}; }
@@ -3153,7 +3459,7 @@ StringArray MP3AudioFormat::getQualityOptions()     { return {}; }
 
 AudioFormatReader* MP3AudioFormat::createReaderFor (InputStream* sourceStream, const bool deleteStreamIfOpeningFails)
 {
-    std::unique_ptr<MP3Decoder::MP3Reader> r (new MP3Decoder::MP3Reader (sourceStream));
+    std::unique_ptr<MP3Decoder::MP3Reader> r (new MP3Decoder::MP3Reader (sourceStream, frameIndexCache->shareIndexes ? frameIndexCache : nullptr));
 
     if (r->lengthInSamples > 0)
         return r.release();
@@ -3172,6 +3478,199 @@ AudioFormatWriter* MP3AudioFormat::createWriterFor (OutputStream*, double /*samp
     return nullptr;
 }
 
+void MP3AudioFormat::setFrameIndexOptions (bool shouldShareIndexes, bool shouldPersistIndexes)
+{
+    frameIndexCache->shareIndexes = shouldShareIndexes;
+    frameIndexCache->persistIndexes = shouldShareIndexes && shouldPersistIndexes;
+}
+
+void MP3AudioFormat::clearFrameIndexCache()
+{
+    frameIndexCache->clear();
+}
+
+File MP3AudioFormat::getFrameIndexFile (const File& mp3File)
+{
+    return mp3File.getSiblingFile (mp3File.getFileName() + ".frameindex");
+}
+
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+struct MP3AudioFormatTests final : public UnitTest
+{
+    MP3AudioFormatTests()
+        : UnitTest ("MP3 audio format tests", UnitTestCategories::audio)
+    {}
+
+    void runTest() override
+    {
+        const auto data = createStream (2000);
+
+        {
+            beginTest ("Indexing frames finds the same positions as decoding them");
+
+            MemoryInputStream walkedInput (data, false), indexedInput (data, false);
+            MP3Decoder::MP3Stream walked (walkedInput), indexed (indexedInput);
+
+            for (int i = 0; i < 10000; ++i)
+            {
+                int numDone = 0;
+
+                if (walked.decodeNextBlock (nullptr, nullptr, numDone) < 0)
+                    break;
+            }
+
+            int numDone = 0;
+            indexed.decodeNextBlock (nullptr, nullptr, numDone);
+            indexed.indexRemainingFrames();
+
+            expect (indexed.hasIndexedAllFrames());
+            expectEquals (indexed.getFrameIndex().size(), 2001 / 4 + 1);
+            expect (indexed.getFrameIndex() == walked.getFrameIndex());
+        }
+
+        const TemporaryFile temp (".mp3");
+        const auto file = temp.getFile();
+        const auto indexFile = MP3AudioFormat::getFrameIndexFile (file);
+        file.replaceWithData (data.getData(), data.getSize());
+
+        {
+            beginTest ("Seeking beyond the last frame fails cleanly");
+
+            MP3AudioFormat format;
+            std::unique_ptr<AudioFormatReader> reader (format.createReaderFor (file.createInputStream().release(), true));
+            expect (reader != nullptr);
+
+            AudioBuffer<float> buffer (2, 1152);
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                FloatVectorOperations::fill (buffer.getWritePointer (ch), 1.0f, buffer.getNumSamples());
+
+            reader->read (&buffer, 0, buffer.getNumSamples(), 1152 * 5000, true, true);
+            expectEquals (buffer.getMagnitude (0, buffer.getNumSamples()), 0.0f);
+
+            expect (! indexFile.exists(), "Indexes shouldn't be saved unless that's been enabled");
+        }
+
+        {
+            beginTest ("Indexes can be persisted");
+
+            MP3AudioFormat format;
+            format.setFrameIndexOptions (true, true);
+
+            std::unique_ptr<AudioFormatReader> reader (format.createReaderFor (file.createInputStream().release(), true));
+            AudioBuffer<float> buffer (2, 1152);
+            reader->read (&buffer, 0, buffer.getNumSamples(), 1152 * 1000, true, true);
+
+            expect (indexFile.existsAsFile());
+
+            MP3AudioFormat::FrameIndexCache cache;
+            cache.persistIndexes = true;
+
+            Array<int64> positions;
+            expect (cache.find (file, positions));
+            expectEquals (positions.size(), 2001 / 4 + 1);
+        }
+
+        {
+            beginTest ("Persisted indexes are ignored once the file changes");
+
+            file.appendData (data.begin(), 417);
+
+            MP3AudioFormat::FrameIndexCache cache;
+            cache.persistIndexes = true;
+
+            Array<int64> positions;
+            expect (! cache.find (file, positions));
+        }
+
+        {
+            beginTest ("The least recently used indexes are dropped when the cache is full");
+
+            MP3AudioFormat::FrameIndexCache cache;
+            cache.maxNumPositions = 250;
+
+            const auto makePositions = [] (int num)
+            {
+                Array<int64> positions;
+
+                for (int i = 0; i < num; ++i)
+                    positions.add (i * 417);
+
+                return positions;
+            };
+
+            const auto isCached = [&] (const String& fileName)
+            {
+                Array<int64> positions;
+                return cache.find (File::getCurrentWorkingDirectory().getChildFile (fileName), positions);
+            };
+
+            const auto dir = File::getCurrentWorkingDirectory();
+            cache.add (dir.getChildFile ("a.mp3"), makePositions (100));
+            cache.add (dir.getChildFile ("b.mp3"), makePositions (100));
+            expect (isCached ("a.mp3"));
+
+            cache.add (dir.getChildFile ("c.mp3"), makePositions (100));
+            expect (isCached ("a.mp3") && isCached ("c.mp3"));
+            expect (! isCached ("b.mp3"));
+
+            cache.add (dir.getChildFile ("d.mp3"), makePositions (300));
+            expect (! isCached ("d.mp3"), "An index bigger than the whole cache shouldn't be kept");
+            expect (isCached ("a.mp3"));
+
+            cache.clear();
+            expect (! isCached ("a.mp3") && ! isCached ("c.mp3"));
+            expectEquals (cache.numPositions, 0);
+        }
+
+        indexFile.deleteFile();
+    }
+
+    /*  Creates a stream of silent MPEG-1 layer III frames at 44.1kHz and 128kb/s, which
+        starts with a Xing header, and has some junk between a few of the frames.
+    */
+    static MemoryBlock createStream (int numFrames)
+    {
+        MemoryOutputStream out;
+
+        const auto writeFrame = [&] (bool padded, bool xing)
+        {
+            const auto header = 0xfffb9000u | (padded ? 0x200u : 0u);
+            out.writeIntBigEndian ((int) header);
+
+            MemoryBlock body (padded ? 414 : 413, true);
+
+            if (xing)
+            {
+                memcpy (body.begin() + 32, "Xing", 4);
+                body[39] = 1; // the frame count is present
+                body[43] = (char) (numFrames & 0xff);
+                body[42] = (char) ((numFrames >> 8) & 0xff);
+            }
+
+            out.write (body.getData(), body.getSize());
+        };
+
+        writeFrame (false, true);
+
+        for (int i = 0; i < numFrames; ++i)
+        {
+            writeFrame ((i % 3) == 1, false);
+
+            if (i == 300 || i == 1201)
+                out.writeRepeatedByte (0, 7);
+        }
+
+        return out.getMemoryBlock();
+    }
+};
+
+static MP3AudioFormatTests mp3AudioFormatTests;
+
+#endif
+
 #endif
 
 } // namespace juce
@@ -66,6 +66,49 @@ public:
                                         unsigned int numberOfChannels, int bitsPerSample,
                                         const StringPairArray& metadataValues, int qualityOptionIndex) override;
     using AudioFormat::createWriterFor;
+
+    //==============================================================================
+    /** Controls whether readers share the indexes that they use for seeking.
+
+        MP3 streams don't contain a seek table, so the first time a reader needs to seek
+        beyond the frames it has already seen, it scans the headers of the remaining frames
+        to build an index of their positions. After that, a seek to any point only needs
+        to decode a couple of frames.
+
+        When shouldShareIndexes is true (the default), the index for a file is kept by this
+        format and reused by all the readers it creates for the same file, as long as the
+        file's size and modification time haven't changed, so each file is only scanned once.
+
+        When shouldPersistIndexes is also true, indexes are saved to the file returned by
+        getFrameIndexFile(), and loaded from there by readers that are created later, even
+        by other instances of this format.
+
+        The shared indexes are limited to about 8MB in total, and the least recently used
+        ones are dropped when that fills up.
+
+        @see clearFrameIndexCache
+    */
+    void setFrameIndexOptions (bool shouldShareIndexes, bool shouldPersistIndexes = false);
+
+    /** Frees all the shared indexes that this format is holding in memory.
+        Any indexes that have been saved to disk are left alone.
+
+        @see setFrameIndexOptions
+    */
+    void clearFrameIndexCache();
+
+    /** Returns the file that the index of an MP3 file is saved in when indexes are being
+        persisted. This sits next to the MP3 file, with ".frameindex" added to its name.
+
+        @see setFrameIndexOptions
+    */
+    static File getFrameIndexFile (const File& mp3File);
+
+    /** @internal */
+    struct FrameIndexCache;
+
+private:
+    std::shared_ptr<FrameIndexCache> frameIndexCache;
 };
 
 #endif
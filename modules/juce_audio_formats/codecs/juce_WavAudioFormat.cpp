@@ -1512,17 +1512,21 @@ public:
         return true;
     }
 
+    template <typename TargetType>
     static void copySampleData (unsigned int numBitsPerSample, const bool floatingPointData,
-                                int* const* destSamples, int startOffsetInDestBuffer, int numDestChannels,
+                                TargetType* const* destSamples, int startOffsetInDestBuffer, int numDestChannels,
                                 const void* sourceData, int numberOfChannels, int numSamples) noexcept
     {
+        // fixed-point data goes into int buffers as 32-bit values, or into float buffers as floats
+        using FixedDest = std::conditional_t<std::is_same_v<TargetType, float>, AudioData::Float32, AudioData::Int32>;
+
         switch (numBitsPerSample)
         {
-            case 8:     ReadHelper<AudioData::Int32, AudioData::UInt8, AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
-            case 16:    ReadHelper<AudioData::Int32, AudioData::Int16, AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
-            case 24:    ReadHelper<AudioData::Int32, AudioData::Int24, AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
+            case 8:     ReadHelper<FixedDest, AudioData::UInt8, AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
+            case 16:    ReadHelper<FixedDest, AudioData::Int16, AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
+            case 24:    ReadHelper<FixedDest, AudioData::Int24, AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples); break;
             case 32:    if (floatingPointData) ReadHelper<AudioData::Float32, AudioData::Float32, AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples);
-                        else                   ReadHelper<AudioData::Int32,   AudioData::Int32,   AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples);
+                        else                   ReadHelper<FixedDest,          AudioData::Int32,   AudioData::LittleEndian>::read (destSamples, startOffsetInDestBuffer, numDestChannels, sourceData, numberOfChannels, numSamples);
                         break;
             default:    jassertfalse; break;
         }
@@ -1855,22 +1859,13 @@ public:
     bool readSamples (int* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
                       int64 startSampleInFile, int numSamples) override
     {
-        clearSamplesBeyondAvailableLength (destSamples, numDestChannels, startOffsetInDestBuffer,
-                                           startSampleInFile, numSamples, lengthInSamples);
-
-        if (numSamples <= 0)
-            return true;
-
-        if (map == nullptr || ! mappedSection.contains (Range<int64> (startSampleInFile, startSampleInFile + numSamples)))
-        {
-            jassertfalse; // you must make sure that the window contains all the samples you're going to attempt to read.
-            return false;
-        }
+        return readMappedSamples (destSamples, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
+    }
 
-        WavAudioFormatReader::copySampleData (bitsPerSample, usesFloatingPointData,
-                                              destSamples, startOffsetInDestBuffer, numDestChannels,
-                                              sampleToPointer (startSampleInFile), (int) numChannels, numSamples);
-        return true;
+    bool readSamplesAsFloat (float* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
+                             int64 startSampleInFile, int numSamples) override
+    {
+        return readMappedSamples (destSamples, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
     }
 
     void getSample (int64 sample, float* result) const noexcept override
@@ -1929,11 +1924,32 @@ public:
     using AudioFormatReader::readMaxLevels;
 
 private:
+    template <typename TargetType>
+    bool readMappedSamples (TargetType* const* destSamples, int numDestChannels, int startOffsetInDestBuffer,
+                            int64 startSampleInFile, int numSamples)
+    {
+        clearSamplesBeyondAvailableLength (reinterpret_cast<int* const*> (destSamples), numDestChannels, startOffsetInDestBuffer,
+                                           startSampleInFile, numSamples, lengthInSamples);
+
+        if (numSamples <= 0)
+            return true;
+
+        if (map == nullptr || ! mappedSection.contains (Range<int64> (startSampleInFile, startSampleInFile + numSamples)))
+        {
+            jassertfalse; // you must make sure that the window contains all the samples you're going to attempt to read.
+            return false;
+        }
+
+        WavAudioFormatReader::copySampleData (bitsPerSample, usesFloatingPointData,
+                                              destSamples, startOffsetInDestBuffer, numDestChannels,
+                                              sampleToPointer (startSampleInFile), (int) numChannels, numSamples);
+        return true;
+    }
+
     template <typename SampleType>
-    void scanMinAndMax (int64 startSampleInFile, int64 numSamples, Range<float>* results, int numChannelsToRead) const noexcept
+    void scanMinAndMax (int64 startSampleInFile, int64 numSamples, Range<float>* results, int numChannelsToRead) const
     {
-        for (int i = 0; i < numChannelsToRead; ++i)
-            results[i] = scanMinAndMaxInterleaved<SampleType, AudioData::LittleEndian> (i, startSampleInFile, numSamples);
+        scanMinAndMaxOfChannels<SampleType, AudioData::LittleEndian> (startSampleInFile, numSamples, results, numChannelsToRead);
     }
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MemoryMappedWavReader)
@@ -2261,9 +2277,116 @@ struct WaveAudioFormatTests final : public UnitTest
                 expect (reader->metadataValues.getValue (WavAudioFormat::aswgVersion, "") == "3.01");
             }
         }
+
+        {
+            beginTest ("Memory-mapped readers produce the same samples and levels as stream readers");
+
+            // The writer always stores 32-bit data as floats, so the 32-bit integer file is built by hand
+            for (const auto& encoding : { SampleEncoding { 8, false },
+                                          SampleEncoding { 16, false },
+                                          SampleEncoding { 24, false },
+                                          SampleEncoding { 32, false },
+                                          SampleEncoding { 32, true } })
+            {
+                for (const auto numChannels : { 1, 3 })
+                {
+                    const TemporaryFile temp (".wav");
+
+                    if (encoding.bitsPerSample == 32 && ! encoding.isFloat)
+                        writeInt32Noise (temp.getFile(), numChannels);
+                    else
+                        writeNoise (format, temp.getFile(), numChannels, encoding.bitsPerSample);
+
+                    auto streamReader = rawToUniquePtr (format.createReaderFor (temp.getFile().createInputStream().release(), true));
+                    auto mappedReader = rawToUniquePtr (format.createMemoryMappedReader (temp.getFile()));
+                    expect (streamReader != nullptr && mappedReader != nullptr);
+                    expect (mappedReader->mapEntireFile());
+                    expect (mappedReader->bitsPerSample == (unsigned int) encoding.bitsPerSample);
+                    expect (mappedReader->usesFloatingPointData == encoding.isFloat);
+
+                    const auto length = mappedReader->lengthInSamples;
+
+                    for (const auto numDestChannels : { 2, numChannels + 1 })
+                    {
+                        for (const auto start : { (int64) -7, (int64) 13, length - 333 })
+                        {
+                            AudioBuffer<float> expected (numDestChannels, 1001), actual (numDestChannels, 1001);
+                            expect (streamReader->read (&expected, 0, 1001, start, true, true));
+                            expect (mappedReader->read (&actual, 0, 1001, start, true, true));
+                            expect (buffersAreIdentical (expected, actual));
+                        }
+                    }
+
+                    std::vector<Range<float>> expectedLevels ((size_t) numChannels), actualLevels ((size_t) numChannels);
+                    streamReader->readMaxLevels (5, length - 11, expectedLevels.data(), numChannels);
+                    mappedReader->readMaxLevels (5, length - 11, actualLevels.data(), numChannels);
+                    expect (expectedLevels == actualLevels);
+                }
+            }
+        }
     }
 
 private:
+    struct SampleEncoding
+    {
+        int bitsPerSample;
+        bool isFloat;
+    };
+
+    static void writeNoise (WavAudioFormat& format, const File& file, int numChannels, int bitsPerSample)
+    {
+        Random random (0x1234);
+        AudioBuffer<float> buffer (numChannels, 5003);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
+                buffer.setSample (channel, sample, random.nextFloat() * 2.0f - 1.0f);
+
+        auto writer = rawToUniquePtr (format.createWriterFor (new FileOutputStream (file), 44100.0,
+                                                              (unsigned int) numChannels, bitsPerSample, {}, 0));
+        writer->writeFromAudioSampleBuffer (buffer, 0, buffer.getNumSamples());
+    }
+
+    static void writeInt32Noise (const File& file, int numChannels)
+    {
+        constexpr int numSamples = 5003;
+        const auto dataSize = numSamples * numChannels * 4;
+
+        FileOutputStream out (file);
+        out.setPosition (0);
+        out.truncate();
+
+        out.write ("RIFF", 4);
+        out.writeInt (36 + dataSize);
+        out.write ("WAVE", 4);
+
+        out.write ("fmt ", 4);
+        out.writeInt (16);
+        out.writeShort (1); // WAVE_FORMAT_PCM
+        out.writeShort ((short) numChannels);
+        out.writeInt (44100);
+        out.writeInt (44100 * numChannels * 4);
+        out.writeShort ((short) (numChannels * 4));
+        out.writeShort (32);
+
+        out.write ("data", 4);
+        out.writeInt (dataSize);
+
+        Random random (0x1234);
+
+        for (int i = 0; i < numSamples * numChannels; ++i)
+            out.writeInt (random.nextInt());
+    }
+
+    static bool buffersAreIdentical (const AudioBuffer<float>& a, const AudioBuffer<float>& b)
+    {
+        for (int channel = 0; channel < a.getNumChannels(); ++channel)
+            if (memcmp (a.getReadPointer (channel), b.getReadPointer (channel), (size_t) a.getNumSamples() * sizeof (float)) != 0)
+                return false;
+
+        return true;
+    }
+
     MemoryBlock writeToBlock (WavAudioFormat& format, StringPairArray meta)
     {
         MemoryBlock mb;
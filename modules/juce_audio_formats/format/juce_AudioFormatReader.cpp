@@ -36,34 +36,14 @@ AudioFormatReader::~AudioFormatReader()
     delete input;
 }
 
-static void convertFixedToFloat (int* const* channels, int numChannels, int numSamples)
-{
-    constexpr auto scaleFactor = 1.0f / static_cast<float> (0x7fffffff);
-
-    for (int i = 0; i < numChannels; ++i)
-        if (auto d = channels[i])
-            FloatVectorOperations::convertFixedToFloat (reinterpret_cast<float*> (d), d, scaleFactor, numSamples);
-}
-
-bool AudioFormatReader::read (float* const* destChannels, int numDestChannels,
-                              int64 startSampleInSource, int numSamplesToRead)
-{
-    auto channelsAsInt = reinterpret_cast<int* const*> (destChannels);
-
-    if (! read (channelsAsInt, numDestChannels, startSampleInSource, numSamplesToRead, false))
-        return false;
-
-    if (! usesFloatingPointData)
-        convertFixedToFloat (channelsAsInt, numDestChannels, numSamplesToRead);
-
-    return true;
-}
-
-bool AudioFormatReader::read (int* const* destChannels,
-                              int numDestChannels,
-                              int64 startSampleInSource,
-                              int numSamplesToRead,
-                              bool fillLeftoverChannelsWithCopies)
+template <typename SampleType, typename ReadFn>
+static bool readWithPadding (SampleType* const* destChannels,
+                             int numDestChannels,
+                             int numSourceChannels,
+                             int64 startSampleInSource,
+                             int numSamplesToRead,
+                             bool fillLeftoverChannelsWithCopies,
+                             ReadFn&& readSamples)
 {
     jassert (numDestChannels > 0); // you have to actually give this some channels to work with!
 
@@ -76,7 +56,7 @@ bool AudioFormatReader::read (int* const* destChannels,
 
         for (int i = numDestChannels; --i >= 0;)
             if (auto d = destChannels[i])
-                zeromem (d, (size_t) silence * sizeof (int));
+                zeromem (d, (size_t) silence * sizeof (SampleType));
 
         startOffsetInDestBuffer += silence;
         numSamplesToRead -= silence;
@@ -87,17 +67,17 @@ bool AudioFormatReader::read (int* const* destChannels,
         return true;
 
     if (! readSamples (destChannels,
-                       jmin ((int) numChannels, numDestChannels), startOffsetInDestBuffer,
+                       jmin (numSourceChannels, numDestChannels), startOffsetInDestBuffer,
                        startSampleInSource, numSamplesToRead))
         return false;
 
-    if (numDestChannels > (int) numChannels)
+    if (numDestChannels > numSourceChannels)
     {
         if (fillLeftoverChannelsWithCopies)
         {
             auto lastFullChannel = destChannels[0];
 
-            for (int i = (int) numChannels; --i > 0;)
+            for (int i = numSourceChannels; --i > 0;)
             {
                 if (destChannels[i] != nullptr)
                 {
@@ -107,36 +87,77 @@ bool AudioFormatReader::read (int* const* destChannels,
             }
 
             if (lastFullChannel != nullptr)
-                for (int i = (int) numChannels; i < numDestChannels; ++i)
+                for (int i = numSourceChannels; i < numDestChannels; ++i)
                     if (auto d = destChannels[i])
-                        memcpy (d, lastFullChannel, sizeof (int) * originalNumSamplesToRead);
+                        memcpy (d, lastFullChannel, sizeof (SampleType) * originalNumSamplesToRead);
         }
         else
         {
-            for (int i = (int) numChannels; i < numDestChannels; ++i)
+            for (int i = numSourceChannels; i < numDestChannels; ++i)
                 if (auto d = destChannels[i])
-                    zeromem (d, sizeof (int) * originalNumSamplesToRead);
+                    zeromem (d, sizeof (SampleType) * originalNumSamplesToRead);
         }
     }
 
     return true;
 }
 
-static bool readChannels (AudioFormatReader& reader, int** chans, AudioBuffer<float>* buffer,
-                          int startSample, int numSamples, int64 readerStartSample, int numTargetChannels,
-                          bool convertToFloat)
+bool AudioFormatReader::read (float* const* destChannels, int numDestChannels,
+                              int64 startSampleInSource, int numSamplesToRead)
 {
-    for (int j = 0; j < numTargetChannels; ++j)
-        chans[j] = reinterpret_cast<int*> (buffer->getWritePointer (j, startSample));
+    return readFloatChannels (destChannels, numDestChannels, startSampleInSource, numSamplesToRead, false);
+}
 
-    chans[numTargetChannels] = nullptr;
+bool AudioFormatReader::read (int* const* destChannels,
+                              int numDestChannels,
+                              int64 startSampleInSource,
+                              int numSamplesToRead,
+                              bool fillLeftoverChannelsWithCopies)
+{
+    return readWithPadding (destChannels, numDestChannels, (int) numChannels,
+                            startSampleInSource, numSamplesToRead, fillLeftoverChannelsWithCopies,
+                            [this] (int* const* dest, int numDest, int offset, int64 start, int num)
+                            {
+                                return readSamples (dest, numDest, offset, start, num);
+                            });
+}
+
+bool AudioFormatReader::readFloatChannels (float* const* destChannels,
+                                           int numDestChannels,
+                                           int64 startSampleInSource,
+                                           int numSamplesToRead,
+                                           bool fillLeftoverChannelsWithCopies)
+{
+    return readWithPadding (destChannels, numDestChannels, (int) numChannels,
+                            startSampleInSource, numSamplesToRead, fillLeftoverChannelsWithCopies,
+                            [this] (float* const* dest, int numDest, int offset, int64 start, int num)
+                            {
+                                return readSamplesAsFloat (dest, numDest, offset, start, num);
+                            });
+}
+
+bool AudioFormatReader::readSamplesAsFloat (float* const* destChannels,
+                                            int numDestChannels,
+                                            int startOffsetInDestBuffer,
+                                            int64 startSampleInFile,
+                                            int numSamples)
+{
+    auto channelsAsInt = reinterpret_cast<int* const*> (destChannels);
 
-    const bool success = reader.read (chans, numTargetChannels, readerStartSample, numSamples, true);
+    if (! readSamples (channelsAsInt, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples))
+        return false;
+
+    if (! usesFloatingPointData)
+    {
+        constexpr auto scaleFactor = 1.0f / static_cast<float> (0x7fffffff);
 
-    if (convertToFloat)
-        convertFixedToFloat (chans, numTargetChannels, numSamples);
+        for (int i = 0; i < numDestChannels; ++i)
+            if (auto d = channelsAsInt[i])
+                FloatVectorOperations::convertFixedToFloat (destChannels[i] + startOffsetInDestBuffer,
+                                                            d + startOffsetInDestBuffer, scaleFactor, numSamples);
+    }
 
-    return success;
+    return true;
 }
 
 bool AudioFormatReader::read (AudioBuffer<float>* buffer,
@@ -156,9 +177,9 @@ bool AudioFormatReader::read (AudioBuffer<float>* buffer,
 
     if (numTargetChannels <= 2)
     {
-        int* dests[2] = { reinterpret_cast<int*> (buffer->getWritePointer (0, startSample)),
-                          reinterpret_cast<int*> (numTargetChannels > 1 ? buffer->getWritePointer (1, startSample) : nullptr) };
-        int* chans[3] = {};
+        float* dests[2] = { buffer->getWritePointer (0, startSample),
+                            numTargetChannels > 1 ? buffer->getWritePointer (1, startSample) : nullptr };
+        float* chans[3] = {};
 
         if (useReaderLeftChan == useReaderRightChan)
         {
@@ -176,7 +197,7 @@ bool AudioFormatReader::read (AudioBuffer<float>* buffer,
             chans[1] = dests[0];
         }
 
-        if (! read (chans, 2, readerStartSample, numSamples, true))
+        if (! readFloatChannels (chans, 2, readerStartSample, numSamples, true))
             return false;
 
         // if the target's stereo and the source is mono, dupe the first channel..
@@ -187,23 +208,27 @@ bool AudioFormatReader::read (AudioBuffer<float>* buffer,
             memcpy (dests[1], dests[0], (size_t) numSamples * sizeof (float));
         }
 
-        if (! usesFloatingPointData)
-            convertFixedToFloat (dests, 2, numSamples);
-
         return true;
     }
 
+    auto readChannels = [&] (float** chans)
+    {
+        for (int j = 0; j < numTargetChannels; ++j)
+            chans[j] = buffer->getWritePointer (j, startSample);
+
+        chans[numTargetChannels] = nullptr;
+
+        return readFloatChannels (chans, numTargetChannels, readerStartSample, numSamples, true);
+    };
+
     if (numTargetChannels <= 64)
     {
-        int* chans[65];
-        return readChannels (*this, chans, buffer, startSample, numSamples,
-                             readerStartSample, numTargetChannels, ! usesFloatingPointData);
+        float* chans[65];
+        return readChannels (chans);
     }
 
-    HeapBlock<int*> chans (numTargetChannels + 1);
-
-    return readChannels (*this, chans, buffer, startSample, numSamples,
-                         readerStartSample, numTargetChannels, ! usesFloatingPointData);
+    HeapBlock<float*> chans (numTargetChannels + 1);
+    return readChannels (chans);
 }
 
 void AudioFormatReader::readMaxLevels (int64 startSampleInFile, int64 numSamples,
@@ -273,6 +273,20 @@ public:
                               int64 startSampleInFile,
                               int numSamples) = 0;
 
+    /** Reads samples straight into floating-point buffers.
+
+        The read() methods that fill float buffers call this instead of readSamples().
+        The default version calls readSamples() and then converts any fixed-point data
+        to floats, but a subclass that can decode directly to floats may override it,
+        as long as it produces exactly the same values.
+
+        The parameters have the same meanings as those of readSamples().
+    */
+    virtual bool readSamplesAsFloat (float* const* destChannels,
+                                     int numDestChannels,
+                                     int startOffsetInDestBuffer,
+                                     int64 startSampleInFile,
+                                     int numSamples);
 
 protected:
     //==============================================================================
@@ -287,6 +301,29 @@ protected:
         static void read (TargetType* const* destData, int destOffset, int numDestChannels,
                           const void* sourceData, int numSourceChannels, int numSamples) noexcept
         {
+            if constexpr (std::is_same_v<DestSampleType, AudioData::Float32>)
+            {
+                // When every source channel is wanted, AudioData can deinterleave and
+                // convert whole blocks with vectorised code for the common formats
+                constexpr int maxChannelsToDeinterleave = 32;
+
+                if (numDestChannels == numSourceChannels && numDestChannels <= maxChannelsToDeinterleave)
+                {
+                    using Source = AudioData::InterleavedSource<AudioData::Format<SourceSampleType, SourceEndianness>>;
+                    using Dest   = AudioData::NonInterleavedDest<AudioData::Format<AudioData::Float32, AudioData::NativeEndian>>;
+
+                    float* channels[maxChannelsToDeinterleave];
+
+                    for (int i = 0; i < numDestChannels; ++i)
+                        channels[i] = destData[i] != nullptr ? reinterpret_cast<float*> (destData[i]) + destOffset : nullptr;
+
+                    AudioData::deinterleaveSamples (Source { static_cast<typename Source::DataType> (sourceData), numSourceChannels },
+                                                    Dest { channels, numDestChannels },
+                                                    numSamples);
+                    return;
+                }
+            }
+
             for (int i = 0; i < numDestChannels; ++i)
             {
                 if (void* targetChan = destData[i])
@@ -329,6 +366,10 @@ protected:
     }
 
 private:
+    bool readFloatChannels (float* const* destChannels, int numDestChannels,
+                            int64 startSampleInSource, int numSamplesToRead,
+                            bool fillLeftoverChannelsWithCopies);
+
     String formatName;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioFormatReader)
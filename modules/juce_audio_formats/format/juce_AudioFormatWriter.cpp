@@ -218,7 +218,8 @@ public:
         : fifo (numSamples),
           buffer (channels, numSamples),
           timeSliceThread (tst),
-          writer (w)
+          writer (w),
+          pollIntervalMs (getPollInterval (numSamples, w->getSampleRate()))
     {
         timeSliceThread.addTimeSliceClient (this);
     }
@@ -243,7 +244,12 @@ public:
         fifo.prepareToWrite (numSamples, start1, size1, start2, size2);
 
         if (size1 + size2 < numSamples)
+        {
+            numSamplesDropped += numSamples;
+            ++numFailedWrites;
+            timeSliceThread.notify();
             return false;
+        }
 
         for (int i = buffer.getNumChannels(); --i >= 0;)
         {
@@ -252,18 +258,32 @@ public:
         }
 
         fifo.finishedWrite (size1 + size2);
-        timeSliceThread.notify();
+
+        numSamplesPushed += numSamples;
+        recordPushTime (numSamplesPushed);
+
+        const auto numBuffered = fifo.getNumReady();
+
+        if (numBuffered > maxNumSamplesBuffered.load (std::memory_order_relaxed))
+            maxNumSamplesBuffered = numBuffered;
+
+        // Waking the thread involves a lock, so only do it if the buffer is filling up faster
+        // than the thread is polling it
+        if (numBuffered > fifo.getTotalSize() / 2)
+            timeSliceThread.notify();
+
         return true;
     }
 
     int useTimeSlice() override
     {
-        return writePendingData();
+        const auto result = writePendingData();
+        return result == 0 ? 0 : pollIntervalMs;
     }
 
     int writePendingData()
     {
-        auto numToDo = fifo.getTotalSize() / 4;
+        auto numToDo = fifo.getTotalSize() / 2;
 
         int start1, size1, start2, size2;
         fifo.prepareToRead (numToDo, start1, size1, start2, size2);
@@ -291,6 +311,9 @@ public:
         }
 
         fifo.finishedRead (size1 + size2);
+        numSamplesWritten += size1 + size2;
+        updateMaxLatency (numSamplesPopped);
+        numSamplesPopped += size1 + size2;
 
         if (samplesPerFlush > 0)
         {
@@ -321,7 +344,84 @@ public:
         samplesPerFlush = numSamples;
     }
 
+    Statistics getStatistics() const noexcept
+    {
+        Statistics s;
+        s.bufferSize            = fifo.getTotalSize();
+        s.numSamplesBuffered    = fifo.getNumReady();
+        s.maxNumSamplesBuffered = maxNumSamplesBuffered;
+        s.numSamplesWritten     = numSamplesWritten;
+        s.numSamplesDropped     = numSamplesDropped;
+        s.numFailedWrites       = numFailedWrites;
+        s.maxLatencySeconds     = Time::highResolutionTicksToSeconds (maxLatencyTicks);
+        return s;
+    }
+
+    void resetStatistics() noexcept
+    {
+        maxNumSamplesBuffered = 0;
+        numSamplesWritten = 0;
+        numSamplesDropped = 0;
+        numFailedWrites = 0;
+        maxLatencyTicks = 0;
+    }
+
 private:
+    /*  Records when the samples up to a given point arrived, so that the time they spend
+        waiting in the buffer can be measured when they're written.
+    */
+    struct PushTime
+    {
+        int64 endSample, ticks;
+    };
+
+    static constexpr int maxNumPushTimes = 256;
+
+    void recordPushTime (int64 endSample) noexcept
+    {
+        // If the background thread has fallen a long way behind, some blocks won't be timed,
+        // and their latency will be measured from the arrival of a later block instead
+        if (pushTimeFifo.getFreeSpace() > 0)
+        {
+            const auto scope = pushTimeFifo.write (1);
+            pushTimes[(size_t) scope.startIndex1] = { endSample, Time::getHighResolutionTicks() };
+        }
+    }
+
+    /*  Measures the time since the arrival of the oldest sample in a chunk that has just
+        been written.
+    */
+    void updateMaxLatency (int64 firstSampleWritten) noexcept
+    {
+        const auto now = Time::getHighResolutionTicks();
+
+        while (pushTimeFifo.getNumReady() > 0)
+        {
+            int start1, size1, start2, size2;
+            pushTimeFifo.prepareToRead (1, start1, size1, start2, size2);
+            const auto& pushTime = pushTimes[(size_t) start1];
+
+            if (pushTime.endSample > firstSampleWritten)
+            {
+                maxLatencyTicks = jmax (maxLatencyTicks.load (std::memory_order_relaxed), now - pushTime.ticks);
+                break;
+            }
+
+            pushTimeFifo.finishedRead (1);
+        }
+    }
+
+    /*  How long the thread sleeps when there's nothing to write: the time it takes to
+        fill a quarter of the buffer in real time, but never more than 10ms.
+    */
+    static int getPollInterval (int bufferSize, double sampleRate) noexcept
+    {
+        if (sampleRate <= 0)
+            return 10;
+
+        return jlimit (1, 10, (int) (250.0 * bufferSize / sampleRate));
+    }
+
     AbstractFifo fifo;
     AudioBuffer<float> buffer;
     TimeSliceThread& timeSliceThread;
@@ -330,8 +430,16 @@ private:
     IncomingDataReceiver* receiver = {};
     int64 samplesWritten = 0;
     int samplesPerFlush = 0, flushSampleCounter = 0;
+    const int pollIntervalMs;
     std::atomic<bool> isRunning { true };
 
+    AbstractFifo pushTimeFifo { maxNumPushTimes };
+    std::array<PushTime, (size_t) maxNumPushTimes> pushTimes;
+    int64 numSamplesPushed = 0, numSamplesPopped = 0;
+
+    std::atomic<int> maxNumSamplesBuffered { 0 }, numFailedWrites { 0 };
+    std::atomic<int64> numSamplesWritten { 0 }, numSamplesDropped { 0 }, maxLatencyTicks { 0 };
+
     JUCE_DECLARE_NON_COPYABLE (Buffer)
 };
 
@@ -359,4 +467,91 @@ void AudioFormatWriter::ThreadedWriter::setFlushInterval (int numSamplesPerFlush
     buffer->setFlushInterval (numSamplesPerFlush);
 }
 
+AudioFormatWriter::ThreadedWriter::Statistics AudioFormatWriter::ThreadedWriter::getStatistics() const noexcept
+{
+    return buffer->getStatistics();
+}
+
+void AudioFormatWriter::ThreadedWriter::resetStatistics() noexcept
+{
+    buffer->resetStatistics();
+}
+
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+struct ThreadedWriterTests final : public UnitTest
+{
+    ThreadedWriterTests()
+        : UnitTest ("ThreadedWriter", UnitTestCategories::audio)
+    {}
+
+    void runTest() override
+    {
+        constexpr int numChannels = 2, blockSize = 512, numBlocks = 40, bufferSize = 8192;
+
+        TimeSliceThread thread ("ThreadedWriter test");
+        thread.startThread();
+
+        MemoryBlock data;
+        AudioBuffer<float> block (numChannels, blockSize);
+        block.clear();
+
+        {
+            std::unique_ptr<AudioFormatWriter> writer (WavAudioFormat().createWriterFor (new MemoryOutputStream (data, false),
+                                                                                         44100.0, numChannels, 16, {}, 0));
+            AudioFormatWriter::ThreadedWriter threadedWriter (writer.release(), thread, bufferSize);
+
+            beginTest ("Blocks that won't fit in the buffer are counted as dropped");
+            {
+                AudioBuffer<float> hugeBlock (numChannels, bufferSize * 2);
+                hugeBlock.clear();
+
+                expect (! threadedWriter.write (hugeBlock.getArrayOfReadPointers(), hugeBlock.getNumSamples()));
+
+                const auto statistics = threadedWriter.getStatistics();
+                expectEquals (statistics.bufferSize, bufferSize);
+                expectEquals (statistics.numFailedWrites, 1);
+                expectEquals (statistics.numSamplesDropped, (int64) hugeBlock.getNumSamples());
+            }
+
+            beginTest ("Samples that are written are counted, and their latency is measured");
+            {
+                threadedWriter.resetStatistics();
+
+                for (int i = 0; i < numBlocks; ++i)
+                {
+                    // this is much quicker than real time, so wait for the buffer to have space
+                    while (threadedWriter.getStatistics().numSamplesBuffered > bufferSize - 2 * blockSize)
+                        Thread::sleep (1);
+
+                    expect (threadedWriter.write (block.getArrayOfReadPointers(), blockSize));
+                }
+
+                for (int i = 0; i < 500 && threadedWriter.getStatistics().numSamplesBuffered > 0; ++i)
+                    Thread::sleep (5);
+
+                const auto statistics = threadedWriter.getStatistics();
+                expectEquals (statistics.numSamplesBuffered, 0);
+                expectEquals (statistics.numSamplesWritten, (int64) (numBlocks * blockSize));
+                expectEquals (statistics.numSamplesDropped, (int64) 0);
+                expectEquals (statistics.numFailedWrites, 0);
+                expect (statistics.maxNumSamplesBuffered >= blockSize);
+                expect (statistics.maxLatencySeconds > 0.0);
+            }
+        }
+
+        beginTest ("All the samples reach the file");
+        {
+            std::unique_ptr<AudioFormatReader> reader (WavAudioFormat().createReaderFor (new MemoryInputStream (data, false), true));
+            expect (reader != nullptr);
+            expectEquals (reader->lengthInSamples, (int64) (numBlocks * blockSize));
+        }
+    }
+};
+
+static ThreadedWriterTests threadedWriterTests;
+
+#endif
+
 } // namespace juce
@@ -179,6 +179,14 @@ public:
     /**
         Provides a FIFO for an AudioFormatWriter, allowing you to push incoming
         data into a buffer which will be flushed to disk by a background thread.
+
+        The write() method is lock-free, so it's safe to call from the audio thread.
+        Rather than waking the background thread for every block, the thread polls the
+        buffer often enough that it can't overflow, and writes everything that has
+        arrived in one go. This keeps the writes large, and means that one thread can
+        serve a lot of ThreadedWriters at once.
+
+        Use getStatistics() to see how close the buffer has come to overflowing.
     */
     class ThreadedWriter
     {
@@ -237,6 +245,28 @@ public:
         */
         void setFlushInterval (int numSamplesPerFlush) noexcept;
 
+        //==============================================================================
+        /** Describes how well the background thread has been keeping up with write(). */
+        struct Statistics
+        {
+            int bufferSize = 0;                 /**< The number of samples that the buffer can hold. */
+            int numSamplesBuffered = 0;         /**< The number of samples waiting to be written at the moment. */
+            int maxNumSamplesBuffered = 0;      /**< The largest number of samples that have been waiting at once. */
+            int64 numSamplesWritten = 0;        /**< The number of samples passed to the AudioFormatWriter. */
+            int64 numSamplesDropped = 0;        /**< The number of samples that write() rejected because the buffer was too full. */
+            int numFailedWrites = 0;            /**< The number of calls to write() that returned false. */
+            double maxLatencySeconds = 0.0;     /**< The longest time between a block being passed to write(),
+                                                     and the AudioFormatWriter finishing writing it. */
+        };
+
+        /** Returns the statistics collected since this object was created, or since the last
+            call to resetStatistics(). This can be called from any thread.
+        */
+        Statistics getStatistics() const noexcept;
+
+        /** Resets the statistics returned by getStatistics(). */
+        void resetStatistics() noexcept;
+
     private:
         class Buffer;
         std::unique_ptr<Buffer> buffer;
@@ -107,6 +107,45 @@ protected:
                 .findMinAndMax ((size_t) numSamples);
     }
 
+    /** Used by AudioFormatReader subclasses to scan for min/max ranges in the first few channels
+        of interleaved data.
+
+        Native-endian formats wider than 8 bits are converted to floats a block at a time, so that
+        both the conversion and the search can use vectorised code. The results are identical to
+        those of scanMinAndMaxInterleaved().
+    */
+    template <typename SampleType, typename Endianness>
+    void scanMinAndMaxOfChannels (int64 startSampleInFile, int64 numSamples, Range<float>* results, int numChannelsToRead) const
+    {
+        if constexpr ((int) Endianness::isBigEndian == (int) AudioData::NativeEndian::isBigEndian
+                       && (int) SampleType::bytesPerSample > 1)
+        {
+            constexpr int maxBlockSize = 2048;
+            AudioBuffer<float> block ((int) numChannels, (int) jmin (numSamples, (int64) maxBlockSize));
+
+            for (int64 done = 0; done < numSamples;)
+            {
+                auto numToDo = (int) jmin (numSamples - done, (int64) block.getNumSamples());
+
+                ReadHelper<AudioData::Float32, SampleType, Endianness>::read (block.getArrayOfWritePointers(), 0, (int) numChannels,
+                                                                              sampleToPointer (startSampleInFile + done), (int) numChannels, numToDo);
+
+                for (int i = 0; i < numChannelsToRead; ++i)
+                {
+                    auto r = FloatVectorOperations::findMinAndMax (block.getReadPointer (i), numToDo);
+                    results[i] = done == 0 ? r : results[i].getUnionWith (r);
+                }
+
+                done += numToDo;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < numChannelsToRead; ++i)
+                results[i] = scanMinAndMaxInterleaved<SampleType, Endianness> (i, startSampleInFile, numSamples);
+        }
+    }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MemoryMappedAudioFormatReader)
 };
 
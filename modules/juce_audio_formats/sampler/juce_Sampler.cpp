@@ -26,6 +26,125 @@
 namespace juce
 {
 
+/*  Reads ahead for a set of voices' streams.
+
+    Voices ask for data from the audio thread, so unlike a TimeSliceThread, this can be
+    woken without taking a lock: it polls a flag while it's waiting. The streams use the
+    TimeSliceClient interface, and useTimeSlice() returns 0 while there's more to read.
+*/
+class SamplerDiskStreamer::ReaderThread final : public Thread
+{
+public:
+    ReaderThread() : Thread ("Sampler Disk Streamer") {}
+
+    ~ReaderThread() override
+    {
+        stopThread (-1);
+    }
+
+    void addStream (TimeSliceClient* stream)
+    {
+        const ScopedLock sl (streamsLock);
+        streams.add (stream);
+    }
+
+    void removeStream (TimeSliceClient* stream)
+    {
+        const ScopedLock sl (streamsLock);
+        streams.removeFirstMatchingValue (stream);
+    }
+
+    int getNumStreams() const
+    {
+        const ScopedLock sl (streamsLock);
+        return streams.size();
+    }
+
+    /*  Makes the thread check its streams as soon as possible. This never blocks. */
+    void wake() noexcept
+    {
+        wakeRequested = true;
+    }
+
+private:
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            auto msToWait = maxPollIntervalMs;
+
+            {
+                const ScopedLock sl (streamsLock);
+
+                for (auto* stream : streams)
+                    msToWait = jmin (msToWait, stream->useTimeSlice());
+            }
+
+            for (int i = 0; i < msToWait && ! wakeRequested.exchange (false) && ! threadShouldExit(); ++i)
+                sleep (1);
+        }
+    }
+
+    static constexpr int maxPollIntervalMs = 5;
+
+    CriticalSection streamsLock;
+    Array<TimeSliceClient*> streams;
+    std::atomic<bool> wakeRequested { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ReaderThread)
+};
+
+//==============================================================================
+SamplerDiskStreamer::SamplerDiskStreamer (int numReaderThreads, int samplesToBuffer)
+    : samplesToBufferPerVoice (nextPowerOfTwo (jmax (1024, samplesToBuffer)))
+{
+    jassert (numReaderThreads > 0);
+
+    for (int i = 0; i < jmax (1, numReaderThreads); ++i)
+        threads.add (new ReaderThread())->startThread (Thread::Priority::high);
+}
+
+SamplerDiskStreamer::~SamplerDiskStreamer()
+{
+    // All the voices that use this streamer must be deleted before it is!
+    for (auto* thread : threads)
+        jassertquiet (thread->getNumStreams() == 0);
+}
+
+void SamplerDiskStreamer::setReadTimeout (int timeoutMilliseconds) noexcept
+{
+    timeoutMs = timeoutMilliseconds;
+}
+
+SamplerDiskStreamer::ReaderThread& SamplerDiskStreamer::getNextThread() noexcept
+{
+    return *threads.getUnchecked (nextThread++ % threads.size());
+}
+
+void SamplerDiskStreamer::Counters::add (int64 streamed, int64 missed) noexcept
+{
+    numSamplesStreamed += streamed;
+
+    if (missed > 0)
+    {
+        numSamplesMissed += missed;
+        ++numUnderruns;
+    }
+}
+
+SamplerDiskStreamer::Statistics SamplerDiskStreamer::Counters::get() const noexcept
+{
+    return { numSamplesStreamed.load(), numSamplesMissed.load(), numUnderruns.load() };
+}
+
+void SamplerDiskStreamer::Counters::reset() noexcept
+{
+    numSamplesStreamed = 0;
+    numSamplesMissed = 0;
+    numUnderruns = 0;
+}
+
+//==============================================================================
 SamplerSound::SamplerSound (const String& soundName,
                             AudioFormatReader& source,
                             const BigInteger& notes,
@@ -37,25 +156,64 @@ SamplerSound::SamplerSound (const String& soundName,
       sourceSampleRate (source.sampleRate),
       midiNotes (notes),
       midiRootNote (midiNoteForNormalPitch)
+{
+    loadAudio (source, maxSampleLengthSeconds, std::numeric_limits<int>::max(),
+               attackTimeSecs, releaseTimeSecs);
+}
+
+SamplerSound::SamplerSound (const String& soundName,
+                            std::unique_ptr<AudioFormatReader> source,
+                            const BigInteger& notes,
+                            int midiNoteForNormalPitch,
+                            double attackTimeSecs,
+                            double releaseTimeSecs,
+                            double maxSampleLengthSeconds,
+                            int numSamplesToPreload)
+    : name (soundName),
+      sourceSampleRate (source != nullptr ? source->sampleRate : 0.0),
+      midiNotes (notes),
+      midiRootNote (midiNoteForNormalPitch)
+{
+    jassert (source != nullptr);
+    jassert (numSamplesToPreload > 0);
+
+    if (source == nullptr)
+        return;
+
+    loadAudio (*source, maxSampleLengthSeconds, jmax (1, numSamplesToPreload),
+               attackTimeSecs, releaseTimeSecs);
+
+    if (data != nullptr && data->getNumSamples() < length + 4)
+        reader = std::move (source);
+}
+
+SamplerSound::~SamplerSound()
+{
+}
+
+void SamplerSound::loadAudio (AudioFormatReader& source,
+                              double maxSampleLengthSeconds,
+                              int numSamplesToLoad,
+                              double attackTimeSecs,
+                              double releaseTimeSecs)
 {
     if (sourceSampleRate > 0 && source.lengthInSamples > 0)
     {
         length = jmin ((int) source.lengthInSamples,
                        (int) (maxSampleLengthSeconds * sourceSampleRate));
 
-        data.reset (new AudioBuffer<float> (jmin (2, (int) source.numChannels), length + 4));
+        // the 4 extra samples make sure the interpolation can read past the end
+        const auto numToRead = length <= numSamplesToLoad ? length + 4 : numSamplesToLoad;
+
+        data.reset (new AudioBuffer<float> (jmin (2, (int) source.numChannels), numToRead));
 
-        source.read (data.get(), 0, length + 4, 0, true, true);
+        source.read (data.get(), 0, numToRead, 0, true, true);
 
         params.attack  = static_cast<float> (attackTimeSecs);
         params.release = static_cast<float> (releaseTimeSecs);
     }
 }
 
-SamplerSound::~SamplerSound()
-{
-}
-
 bool SamplerSound::appliesToNote (int midiNoteNumber)
 {
     return midiNotes[midiNoteNumber];
@@ -66,18 +224,203 @@ bool SamplerSound::appliesToChannel (int /*midiChannel*/)
     return true;
 }
 
+//==============================================================================
+/*  Feeds the part of a streamed sound that follows its preloaded samples into a ring
+    buffer, reading ahead of the voice's play position on one of the streamer's threads.
+
+    The ring holds the samples from the end of the preloaded data up to validEnd. The
+    background thread only ever writes beyond validEnd, and never further ahead than one
+    buffer's length from the voice's play position, so the voice can read the valid part
+    of the ring without taking a lock.
+*/
+class SamplerVoice::DiskStream final : private TimeSliceClient
+{
+public:
+    explicit DiskStream (SamplerDiskStreamer& streamerToUse)
+        : streamer (streamerToUse),
+          thread (streamerToUse.getNextThread()),
+          buffer (2, streamerToUse.getNumSamplesToBufferPerVoice())
+    {
+        buffer.clear();
+        thread.addStream (this);
+    }
+
+    ~DiskStream() override
+    {
+        thread.removeStream (this);
+    }
+
+    /*  Called by the voice when it starts playing a sound. */
+    void start (SamplerSound& sound)
+    {
+        SynthesiserSound::Ptr previous (&sound);
+
+        {
+            const SpinLock::ScopedLockType sl (lock);
+            std::swap (currentSound, previous);
+            ++generation;
+            validEnd = sound.data->getNumSamples();
+            playPosition = 0;
+        }
+
+        thread.wake();
+    }
+
+    /*  Called by the voice when it stops playing a sound. */
+    void stop()
+    {
+        SynthesiserSound::Ptr previous;
+
+        const SpinLock::ScopedLockType sl (lock);
+        std::swap (currentSound, previous);
+        ++generation;
+    }
+
+    /*  Returns the end of the range of samples that the voice can read, waiting for up to
+        the streamer's timeout for it to reach the given position. The wait spins on the
+        calling thread, which is why a timeout is only meant for offline rendering.
+    */
+    int64 waitForSamples (int64 endNeeded)
+    {
+        auto end = validEnd.load();
+        const auto timeout = streamer.timeoutMs.load();
+
+        if (end >= endNeeded || timeout == 0)
+            return end;
+
+        // the background thread can't get further ahead than this
+        endNeeded = jmin (endNeeded, playPosition.load() + buffer.getNumSamples());
+
+        const auto startTime = Time::getMillisecondCounter();
+        thread.wake();
+
+        while ((end = validEnd.load()) < endNeeded
+                && (timeout < 0 || Time::getMillisecondCounter() < startTime + (uint32) timeout))
+            Thread::yield();
+
+        return end;
+    }
+
+    /*  Lets the background thread reuse the part of the ring before the given position,
+        and records any samples that the voice had to render as silence.
+    */
+    void finishedBlock (int64 newPlayPosition, int64 numSamplesMissed) noexcept
+    {
+        playPosition = newPlayPosition;
+        counters.add (0, numSamplesMissed);
+        streamer.counters.add (0, numSamplesMissed);
+    }
+
+    const float* getReadPointer (int channel) const noexcept    { return buffer.getReadPointer (channel); }
+    int getMask() const noexcept                                { return buffer.getNumSamples() - 1; }
+
+    /*  The end of the samples that the voice might try to read from the sound. */
+    static int64 getEndOfStream (const SamplerSound& sound) noexcept
+    {
+        return sound.length + 2;
+    }
+
+    SamplerDiskStreamer::Counters counters;
+
+private:
+    int useTimeSlice() override
+    {
+        SynthesiserSound::Ptr soundToRead;
+        uint32 generationToRead = 0;
+        int64 start = 0;
+
+        {
+            const SpinLock::ScopedLockType sl (lock);
+            soundToRead = currentSound;
+            generationToRead = generation;
+            start = validEnd;
+        }
+
+        auto* sound = static_cast<SamplerSound*> (soundToRead.get());
+
+        if (sound == nullptr)
+            return 100;
+
+        const auto bufferSize = buffer.getNumSamples();
+        const auto end = jmin (playPosition.load() + bufferSize, getEndOfStream (*sound));
+
+        if (end <= start)
+            return 5;
+
+        const auto numToRead = (int) jmin ((int64) samplesPerRead, end - start);
+        const auto offset = (int) (start & getMask());
+        const auto numBeforeWrap = jmin (numToRead, bufferSize - offset);
+
+        {
+            const ScopedLock sl (sound->readerLock);
+            sound->reader->read (&buffer, offset, numBeforeWrap, start, true, true);
+
+            if (numBeforeWrap < numToRead)
+                sound->reader->read (&buffer, 0, numToRead - numBeforeWrap, start + numBeforeWrap, true, true);
+        }
+
+        {
+            const SpinLock::ScopedLockType sl (lock);
+
+            // the voice has moved on to another note, so this data isn't needed any more
+            if (generation != generationToRead)
+                return 0;
+
+            validEnd = start + numToRead;
+        }
+
+        counters.add (numToRead, 0);
+        streamer.counters.add (numToRead, 0);
+
+        return start + numToRead < end ? 0 : 5;
+    }
+
+    static constexpr int samplesPerRead = 4096;
+
+    SamplerDiskStreamer& streamer;
+    SamplerDiskStreamer::ReaderThread& thread;
+    AudioBuffer<float> buffer;
+
+    SpinLock lock;
+    SynthesiserSound::Ptr currentSound;
+    uint32 generation = 0;
+    std::atomic<int64> validEnd { 0 }, playPosition { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DiskStream)
+};
+
 //==============================================================================
 SamplerVoice::SamplerVoice() {}
+
+SamplerVoice::SamplerVoice (SamplerDiskStreamer& streamer)
+    : stream (std::make_unique<DiskStream> (streamer))
+{
+}
+
 SamplerVoice::~SamplerVoice() {}
 
-bool SamplerVoice::canPlaySound (SynthesiserSound* sound)
+bool SamplerVoice::canPlaySound (SynthesiserSound* s)
+{
+    if (auto* sound = dynamic_cast<const SamplerSound*> (s))
+        return stream != nullptr || ! sound->isStreamedFromDisk();
+
+    return false;
+}
+
+SamplerDiskStreamer::Statistics SamplerVoice::getStreamingStatistics() const noexcept
 {
-    return dynamic_cast<const SamplerSound*> (sound) != nullptr;
+    return stream != nullptr ? stream->counters.get() : SamplerDiskStreamer::Statistics{};
+}
+
+void SamplerVoice::resetStreamingStatistics() noexcept
+{
+    if (stream != nullptr)
+        stream->counters.reset();
 }
 
 void SamplerVoice::startNote (int midiNoteNumber, float velocity, SynthesiserSound* s, int /*currentPitchWheelPosition*/)
 {
-    if (auto* sound = dynamic_cast<const SamplerSound*> (s))
+    if (auto* sound = dynamic_cast<SamplerSound*> (s))
     {
         pitchRatio = std::pow (2.0, (midiNoteNumber - sound->midiRootNote) / 12.0)
                         * sound->sourceSampleRate / getSampleRate();
@@ -90,6 +433,14 @@ void SamplerVoice::startNote (int midiNoteNumber, float velocity, SynthesiserSou
         adsr.setParameters (sound->params);
 
         adsr.noteOn();
+
+        if (stream != nullptr)
+        {
+            if (sound->isStreamedFromDisk())
+                stream->start (*sound);
+            else
+                stream->stop();
+        }
     }
     else
     {
@@ -107,6 +458,9 @@ void SamplerVoice::stopNote (float /*velocity*/, bool allowTailOff)
     {
         clearCurrentNote();
         adsr.reset();
+
+        if (stream != nullptr)
+            stream->stop();
     }
 }
 
@@ -121,45 +475,268 @@ void SamplerVoice::renderNextBlock (AudioBuffer<float>& outputBuffer, int startS
         auto& data = *playingSound->data;
         const float* const inL = data.getReadPointer (0);
         const float* const inR = data.getNumChannels() > 1 ? data.getReadPointer (1) : nullptr;
+        const float* const in[] = { inL, inR };
 
         float* outL = outputBuffer.getWritePointer (0, startSample);
         float* outR = outputBuffer.getNumChannels() > 1 ? outputBuffer.getWritePointer (1, startSample) : nullptr;
 
-        while (--numSamples >= 0)
+        // getSample returns a sample of the sound, and isAvailable checks whether a
+        // streamed sample has been read yet. Returns the number of samples missed.
+        const auto render = [&] (auto&& getSample, auto&& isAvailable)
         {
-            auto pos = (int) sourceSamplePosition;
-            auto alpha = (float) (sourceSamplePosition - pos);
-            auto invAlpha = 1.0f - alpha;
-
-            // just using a very simple linear interpolation here..
-            float l = (inL[pos] * invAlpha + inL[pos + 1] * alpha);
-            float r = (inR != nullptr) ? (inR[pos] * invAlpha + inR[pos + 1] * alpha)
-                                       : l;
-
-            auto envelopeValue = adsr.getNextSample();
-
-            l *= lgain * envelopeValue;
-            r *= rgain * envelopeValue;
+            int64 numMissed = 0;
 
-            if (outR != nullptr)
+            while (--numSamples >= 0)
             {
-                *outL++ += l;
-                *outR++ += r;
-            }
-            else
-            {
-                *outL++ += (l + r) * 0.5f;
+                auto pos = (int) sourceSamplePosition;
+                auto alpha = (float) (sourceSamplePosition - pos);
+                auto invAlpha = 1.0f - alpha;
+
+                float l = 0.0f, r = 0.0f;
+
+                if (isAvailable (pos + 1))
+                {
+                    // just using a very simple linear interpolation here..
+                    l = (getSample (0, pos) * invAlpha + getSample (0, pos + 1) * alpha);
+                    r = (inR != nullptr) ? (getSample (1, pos) * invAlpha + getSample (1, pos + 1) * alpha)
+                                         : l;
+                }
+                else
+                {
+                    ++numMissed;
+                }
+
+                auto envelopeValue = adsr.getNextSample();
+
+                l *= lgain * envelopeValue;
+                r *= rgain * envelopeValue;
+
+                if (outR != nullptr)
+                {
+                    *outL++ += l;
+                    *outR++ += r;
+                }
+                else
+                {
+                    *outL++ += (l + r) * 0.5f;
+                }
+
+                sourceSamplePosition += pitchRatio;
+
+                if (sourceSamplePosition > playingSound->length)
+                {
+                    stopNote (0.0f, false);
+                    break;
+                }
             }
 
-            sourceSamplePosition += pitchRatio;
+            return numMissed;
+        };
 
-            if (sourceSamplePosition > playingSound->length)
-            {
-                stopNote (0.0f, false);
-                break;
-            }
+        if (! playingSound->isStreamedFromDisk())
+        {
+            render ([&] (int channel, int pos) { return in[channel][pos]; },
+                    [] (int) { return true; });
+            return;
         }
+
+        jassert (stream != nullptr);
+
+        const auto numPreloaded = data.getNumSamples();
+        const auto endNeeded = jmin ((int64) (sourceSamplePosition + pitchRatio * numSamples) + 2,
+                                     DiskStream::getEndOfStream (*playingSound));
+        const auto validEnd = stream->waitForSamples (endNeeded);
+        const float* const ring[] = { stream->getReadPointer (0), stream->getReadPointer (1) };
+        const auto mask = stream->getMask();
+
+        const auto numMissed = render ([&] (int channel, int pos) { return pos < numPreloaded ? in[channel][pos]
+                                                                                             : ring[channel][pos & mask]; },
+                                       [&] (int pos) { return pos < validEnd; });
+
+        stream->finishedBlock ((int64) sourceSamplePosition, numMissed);
     }
 }
 
+//==============================================================================
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+class SamplerStreamingTests final : public UnitTest
+{
+public:
+    SamplerStreamingTests()  : UnitTest ("SamplerStreaming", UnitTestCategories::audio)  {}
+
+    void runTest() override
+    {
+        constexpr auto length = 20000;
+        constexpr auto numToPreload = 1000;
+
+        Random random { getRandom() };
+        AudioBuffer<float> source (2, length);
+
+        for (int channel = 0; channel < source.getNumChannels(); ++channel)
+            for (int sample = 0; sample < source.getNumSamples(); ++sample)
+                source.setSample (channel, sample, random.nextFloat() * 2.0f - 1.0f);
+
+        beginTest ("Short sounds are loaded into memory");
+        {
+            const SamplerSound sound ("short", std::make_unique<SourceReader> (source), {}, 60, 0.0, 0.0, 10.0, length);
+            expect (! sound.isStreamedFromDisk());
+            expectEquals (sound.getAudioData()->getNumSamples(), length + 4);
+        }
+
+        beginTest ("Streamed sounds render the same output as sounds loaded into memory");
+        {
+            SamplerDiskStreamer streamer (2, 2048);
+            streamer.setReadTimeout (-1);
+
+            SourceReader reader (source);
+            const auto inMemory = render (new SamplerSound ("memory", reader, allNotes(), 60, 0.0, 0.0, 10.0),
+                                          new SamplerVoice(),
+                                          new SamplerVoice());
+
+            auto* first  = new SamplerVoice (streamer);
+            auto* second = new SamplerVoice (streamer);
+            auto* sound = new SamplerSound ("streamed", std::make_unique<SourceReader> (source), allNotes(), 60, 0.0, 0.0, 10.0, numToPreload);
+            expect (sound->isStreamedFromDisk());
+            expectEquals (sound->getAudioData()->getNumSamples(), numToPreload);
+
+            const auto streamed = render (sound, first, second);
+            expect (streamed == inMemory);
+            expect (streamed.getMagnitude (numToPreload * 2, 1000) > 0.0f);
+
+            const auto statistics = streamer.getStatistics();
+            expectEquals (statistics.numUnderruns, 0);
+            expectEquals (statistics.numSamplesMissed, (int64) 0);
+            expect (statistics.numSamplesStreamed >= 2 * (length - numToPreload));
+        }
+
+        beginTest ("Voices report underruns when the disk can't keep up");
+        {
+            SamplerDiskStreamer streamer;
+
+            auto* blockingReader = new BlockingReader (source);
+            auto* voice = new SamplerVoice (streamer);
+            auto* sound = new SamplerSound ("blocked", std::unique_ptr<AudioFormatReader> (blockingReader), allNotes(), 60, 0.0, 0.0, 10.0, numToPreload);
+
+            Synthesiser synth;
+            synth.addVoice (voice);
+            synth.addSound (sound);
+            synth.setCurrentPlaybackSampleRate (44100.0);
+
+            AudioBuffer<float> output (2, 4 * numToPreload);
+            output.clear();
+            MidiBuffer midi;
+            midi.addEvent (MidiMessage::noteOn (1, 60, 1.0f), 0);
+            synth.renderNextBlock (output, midi, 0, output.getNumSamples());
+
+            expect (output.getMagnitude (0, numToPreload - 1) > 0.0f);
+            expectEquals (output.getMagnitude (numToPreload, output.getNumSamples() - numToPreload), 0.0f);
+
+            const auto statistics = voice->getStreamingStatistics();
+            expectEquals (statistics.numUnderruns, 1);
+            expectEquals (statistics.numSamplesMissed, (int64) (output.getNumSamples() - numToPreload + 1));
+            expectEquals (streamer.getStatistics().numUnderruns, 1);
+
+            voice->resetStreamingStatistics();
+            expectEquals (voice->getStreamingStatistics().numUnderruns, 0);
+
+            blockingReader->unblock.signal();
+        }
+    }
+
+private:
+    struct SourceReader : public AudioFormatReader
+    {
+        explicit SourceReader (const AudioBuffer<float>& b)
+            : AudioFormatReader (nullptr, {}),
+              buffer (b)
+        {
+            sampleRate            = 44100.0;
+            bitsPerSample         = 32;
+            usesFloatingPointData = true;
+            lengthInSamples       = buffer.getNumSamples();
+            numChannels           = (unsigned int) buffer.getNumChannels();
+        }
+
+        bool readSamples (int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer,
+                          int64 startSampleInFile, int numSamples) override
+        {
+            clearSamplesBeyondAvailableLength (destChannels, numDestChannels, startOffsetInDestBuffer,
+                                               startSampleInFile, numSamples, lengthInSamples);
+
+            for (int j = 0; j < numDestChannels; ++j)
+                if (auto* dest = reinterpret_cast<float*> (destChannels[j]))
+                    if (j < (int) numChannels && numSamples > 0)
+                        FloatVectorOperations::copy (dest + startOffsetInDestBuffer,
+                                                     buffer.getReadPointer (j, (int) startSampleInFile),
+                                                     numSamples);
+
+            return true;
+        }
+
+        const AudioBuffer<float>& buffer;
+    };
+
+    struct BlockingReader final : public SourceReader
+    {
+        using SourceReader::SourceReader;
+
+        bool readSamples (int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer,
+                          int64 startSampleInFile, int numSamples) override
+        {
+            // Only the preloaded samples can be read before the reader is unblocked
+            if (startSampleInFile > 0)
+                unblock.wait();
+
+            return SourceReader::readSamples (destChannels, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
+        }
+
+        WaitableEvent unblock { true };
+    };
+
+    static BigInteger allNotes()
+    {
+        BigInteger notes;
+        notes.setRange (0, 128, true);
+        return notes;
+    }
+
+    /*  Plays two overlapping notes at different pitches, and returns the output. */
+    static AudioBuffer<float> render (SamplerSound* sound, SamplerVoice* first, SamplerVoice* second)
+    {
+        constexpr auto blockSize = 512;
+        constexpr auto numBlocks = 48;
+
+        Synthesiser synth;
+        synth.addVoice (first);
+        synth.addVoice (second);
+        synth.addSound (sound);
+        synth.setCurrentPlaybackSampleRate (44100.0);
+
+        AudioBuffer<float> result (2, blockSize * numBlocks);
+        result.clear();
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            MidiBuffer midi;
+
+            if (block == 0)
+                midi.addEvent (MidiMessage::noteOn (1, 60, 1.0f), 0);
+
+            if (block == 3)
+                midi.addEvent (MidiMessage::noteOn (1, 67, 0.5f), 100);
+
+            AudioBuffer<float> output (result.getArrayOfWritePointers(), 2, block * blockSize, blockSize);
+            synth.renderNextBlock (output, midi, 0, blockSize);
+        }
+
+        return result;
+    }
+};
+
+static SamplerStreamingTests samplerStreamingTests;
+
+#endif
+
 } // namespace juce
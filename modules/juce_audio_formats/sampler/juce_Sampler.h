@@ -26,12 +26,101 @@
 namespace juce
 {
 
+//==============================================================================
+/**
+    A pool of background threads that stream audio from disk for SamplerVoice objects.
+
+    When a SamplerSound is created with a reader and a number of samples to preload,
+    only the start of the sample is kept in memory. The rest of it is read on demand
+    by the voices that play it, each of which is fed through its own ring buffer by
+    one of the threads in this pool.
+
+    The streamer must outlive all of the voices that were created with it.
+
+    @see SamplerSound, SamplerVoice
+
+    @tags{Audio}
+*/
+class JUCE_API  SamplerDiskStreamer
+{
+public:
+    //==============================================================================
+    /** Creates a streamer and starts its threads.
+
+        @param numReaderThreads         the number of background threads to read with. Voices
+                                        are shared between the threads, so more threads only
+                                        help when the storage can serve several reads at once
+        @param samplesToBufferPerVoice  the size of the ring buffer that each voice reads from.
+                                        This is rounded up to a power of two
+    */
+    explicit SamplerDiskStreamer (int numReaderThreads = 1,
+                                  int samplesToBufferPerVoice = 32768);
+
+    /** Destructor. */
+    ~SamplerDiskStreamer();
+
+    //==============================================================================
+    /** Sets a number of milliseconds that a voice can block for in its renderNextBlock()
+        method when the audio it needs hasn't been read yet, before giving up and
+        rendering silence instead.
+
+        A value of less than 0 means "wait forever". The voice spins on the audio thread
+        while it waits, so a non-zero timeout is only suitable for offline rendering. The
+        default timeout is 0, which never waits.
+    */
+    void setReadTimeout (int timeoutMilliseconds) noexcept;
+
+    /** Returns the size of the ring buffer that each voice reads from. */
+    int getNumSamplesToBufferPerVoice() const noexcept      { return samplesToBufferPerVoice; }
+
+    //==============================================================================
+    /** Counts how well the disk has kept up with the voices that play streamed sounds. */
+    struct Statistics
+    {
+        int64 numSamplesStreamed = 0;   /**< The number of samples read by the background threads. */
+        int64 numSamplesMissed = 0;     /**< The number of samples that were rendered as silence because they hadn't been read in time. */
+        int numUnderruns = 0;           /**< The number of blocks in which a voice missed some samples. */
+    };
+
+    /** Returns the combined statistics of all the voices that use this streamer. */
+    Statistics getStatistics() const noexcept               { return counters.get(); }
+
+    /** Resets the statistics returned by getStatistics(). */
+    void resetStatistics() noexcept                         { counters.reset(); }
+
+private:
+    //==============================================================================
+    friend class SamplerVoice;
+
+    struct Counters
+    {
+        void add (int64 streamed, int64 missed) noexcept;
+        Statistics get() const noexcept;
+        void reset() noexcept;
+
+        std::atomic<int64> numSamplesStreamed { 0 }, numSamplesMissed { 0 };
+        std::atomic<int> numUnderruns { 0 };
+    };
+
+    class ReaderThread;
+    ReaderThread& getNextThread() noexcept;
+
+    OwnedArray<ReaderThread> threads;
+    int nextThread = 0;
+    const int samplesToBufferPerVoice;
+    std::atomic<int> timeoutMs { 0 };
+    Counters counters;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SamplerDiskStreamer)
+};
+
 //==============================================================================
 /**
     A subclass of SynthesiserSound that represents a sampled audio clip.
 
-    This is a pretty basic sampler, and just attempts to load the whole audio stream
-    into memory.
+    This is a pretty basic sampler. It can either load the whole audio stream into
+    memory, or keep just the start of it in memory and stream the rest from disk
+    using a SamplerDiskStreamer.
 
     To use it, create a Synthesiser, add some SamplerVoice objects to it, then
     give it some SampledSound objects to play.
@@ -70,6 +159,40 @@ public:
                   double releaseTimeSecs,
                   double maxSampleLengthSeconds);
 
+    /** Creates a sampled sound that is streamed from disk.
+
+        Only the first numSamplesToPreload samples are read into memory by this constructor.
+        The rest of the sound is read from the source while it plays, so it can only be
+        played by SamplerVoice objects that were created with a SamplerDiskStreamer.
+
+        A MemoryMappedAudioFormatReader which has mapped the whole file is a good source
+        to use here, as reading from it is cheap once the operating system has paged the
+        file in. If the sound is no longer than numSamplesToPreload, the whole of it is
+        loaded and the source is deleted straight away.
+
+        @param name         a name for the sample
+        @param source       the audio to stream. This object takes ownership of the reader,
+                            which will only be used by the streamer's background threads
+        @param midiNotes    the set of midi keys that this sound should be played on
+        @param midiNoteForNormalPitch   the midi note at which the sample should be played
+                                        with its natural rate
+        @param attackTimeSecs   the attack (fade-in) time, in seconds
+        @param releaseTimeSecs  the decay (fade-out) time, in seconds
+        @param maxSampleLengthSeconds   a maximum length of audio to play from the audio
+                                        source, in seconds
+        @param numSamplesToPreload      the number of samples to keep in memory. This needs
+                                        to cover the time that it takes to fill a voice's
+                                        buffer when a note starts
+    */
+    SamplerSound (const String& name,
+                  std::unique_ptr<AudioFormatReader> source,
+                  const BigInteger& midiNotes,
+                  int midiNoteForNormalPitch,
+                  double attackTimeSecs,
+                  double releaseTimeSecs,
+                  double maxSampleLengthSeconds,
+                  int numSamplesToPreload);
+
     /** Destructor. */
     ~SamplerSound() override;
 
@@ -78,10 +201,15 @@ public:
     const String& getName() const noexcept                  { return name; }
 
     /** Returns the audio sample data.
-        This could return nullptr if there was a problem loading the data.
+
+        For a sound that is streamed from disk, this only contains the preloaded part of
+        the sample. This could return nullptr if there was a problem loading the data.
     */
     AudioBuffer<float>* getAudioData() const noexcept       { return data.get(); }
 
+    /** Returns true if this sound only keeps the start of the sample in memory. */
+    bool isStreamedFromDisk() const noexcept                { return reader != nullptr; }
+
     //==============================================================================
     /** Changes the parameters of the ADSR envelope which will be applied to the sample. */
     void setEnvelopeParameters (ADSR::Parameters parametersToUse)    { params = parametersToUse; }
@@ -94,8 +222,13 @@ private:
     //==============================================================================
     friend class SamplerVoice;
 
+    void loadAudio (AudioFormatReader&, double maxSampleLengthSeconds, int numSamplesToLoad,
+                    double attackTimeSecs, double releaseTimeSecs);
+
     String name;
     std::unique_ptr<AudioBuffer<float>> data;
+    std::unique_ptr<AudioFormatReader> reader;
+    CriticalSection readerLock;
     double sourceSampleRate;
     BigInteger midiNotes;
     int length = 0, midiRootNote = 0;
@@ -121,9 +254,19 @@ class JUCE_API  SamplerVoice    : public SynthesiserVoice
 {
 public:
     //==============================================================================
-    /** Creates a SamplerVoice. */
+    /** Creates a SamplerVoice.
+
+        A voice created like this can't play sounds that are streamed from disk.
+    */
     SamplerVoice();
 
+    /** Creates a SamplerVoice that can also play sounds that are streamed from disk.
+
+        This allocates the voice's ring buffer, and registers the voice with one of the
+        streamer's threads. The streamer must outlive the voice.
+    */
+    explicit SamplerVoice (SamplerDiskStreamer& streamer);
+
     /** Destructor. */
     ~SamplerVoice() override;
 
@@ -139,13 +282,25 @@ public:
     void renderNextBlock (AudioBuffer<float>&, int startSample, int numSamples) override;
     using SynthesiserVoice::renderNextBlock;
 
+    //==============================================================================
+    /** Returns the streaming statistics of this voice.
+        These will all be zero if the voice wasn't created with a SamplerDiskStreamer.
+    */
+    SamplerDiskStreamer::Statistics getStreamingStatistics() const noexcept;
+
+    /** Resets the statistics returned by getStreamingStatistics(). */
+    void resetStreamingStatistics() noexcept;
+
 private:
     //==============================================================================
+    class DiskStream;
+
     double pitchRatio = 0;
     double sourceSamplePosition = 0;
     float lgain = 0, rgain = 0;
 
     ADSR adsr;
+    std::unique_ptr<DiskStream> stream;
 
     JUCE_LEAK_DETECTOR (SamplerVoice)
 };
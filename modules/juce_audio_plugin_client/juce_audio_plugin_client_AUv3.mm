@@ -535,6 +535,11 @@ public:
         midiMessages.ensureSize (2048);
         midiMessages.clear();
 
+        recordParameterAutomation = processor.supportsSampleAccurateAutomation();
+
+        if (recordParameterAutomation)
+            parameterAutomation.prepare (processor.getParameters().size());
+
         hostMusicalContextCallback = [au musicalContextBlock];
         hostTransportStateCallback = [au transportStateBlock];
 
@@ -1458,6 +1463,19 @@ private:
                     if (auto* p = getJuceParameterForAUAddress (paramEvent.parameterAddress))
                     {
                         auto normalisedValue = paramEvent.value / getMaximumParameterValue (*p);
+
+                        if (recordParameterAutomation)
+                        {
+                            const auto rampLength = event->head.eventType == AURenderEventParameterRamp
+                                                  ? static_cast<int> (paramEvent.rampDurationSampleFrames)
+                                                  : 0;
+
+                            parameterAutomation.addPoint (p->getParameterIndex(),
+                                                          { static_cast<int> (paramEvent.eventSampleTime - startTime),
+                                                            rampLength,
+                                                            normalisedValue });
+                        }
+
                         setAudioProcessorParameter (p, normalisedValue);
                     }
                 }
@@ -1483,6 +1501,7 @@ private:
         {
             // process params and incoming midi (only once for a given timestamp)
             midiMessages.clear();
+            parameterAutomation.clear();
 
             const int numParams = juceParameters.getNumParameters();
             processEvents (realtimeEventListHead, numParams, static_cast<AUEventSampleTime> (timestamp->mSampleTime));
@@ -1602,11 +1621,19 @@ private:
         const ScopedLock sl (processor.getCallbackLock());
 
         if (processor.isSuspended())
+        {
             buffer.clear();
-        else if (bypassParam == nullptr && [au shouldBypassEffect])
+            return;
+        }
+
+        processor.setParameterAutomation (recordParameterAutomation ? &parameterAutomation : nullptr);
+
+        if (bypassParam == nullptr && [au shouldBypassEffect])
             processor.processBlockBypassed (buffer, midiBuffer);
         else
             processor.processBlock (buffer, midiBuffer);
+
+        processor.setParameterAutomation (nullptr);
     }
 
     //==============================================================================
@@ -1759,6 +1786,8 @@ private:
 
     OwnedArray<BusBuffer> inBusBuffers, outBusBuffers;
     MidiBuffer midiMessages;
+    ParameterAutomationBuffer parameterAutomation;
+    bool recordParameterAutomation = false;
     AUMIDIOutputEventBlock midiOutputEventBlock = nullptr;
 
    #if JUCE_APPLE_MIDI_EVENT_LIST_SUPPORTED
@@ -151,7 +151,13 @@ public:
         return ttlSanitised;
     }
 
-    void setValueFromHost (LV2_URID urid, float value) noexcept
+    /*  If an automation buffer is supplied, the change is also recorded there as a jump at
+        the given sample offset.
+    */
+    void setValueFromHost (LV2_URID urid,
+                           float value,
+                           ParameterAutomationBuffer* automation = nullptr,
+                           int sampleOffset = 0) noexcept
     {
         const auto it = uridToIndexMap.find (urid);
 
@@ -172,6 +178,9 @@ public:
                 return value;
             }();
 
+            if (automation != nullptr)
+                automation->addPoint (param->getParameterIndex(), { sampleOffset, 0, scaledValue });
+
             if (! approximatelyEqual (scaledValue, param->getValue()))
             {
                 ScopedValueSetter<bool> scope (ignoreCallbacks, true);
@@ -537,6 +546,7 @@ public:
         jassert (static_cast<int> (numSteps) <= processor->getBlockSize());
 
         midi.clear();
+        parameterAutomation.clear();
         playHead.invalidate();
         audio.setSize (audio.getNumChannels(), static_cast<int> (numSteps), true, false, true);
 
@@ -544,20 +554,24 @@ public:
         {
             struct Callback
             {
-                explicit Callback (LV2PluginInstance& s) : self (s) {}
+                Callback (LV2PluginInstance& s, int frame) : self (s), sampleOffset (frame) {}
 
                 void setParameter (LV2_URID property, float value) const noexcept
                 {
-                    self.parameters.setValueFromHost (property, value);
+                    self.parameters.setValueFromHost (property,
+                                                      value,
+                                                      self.recordParameterAutomation ? &self.parameterAutomation : nullptr,
+                                                      sampleOffset);
                 }
 
                 // The host probably shouldn't send us 'touched' messages.
                 void gesture (LV2_URID, bool) const noexcept {}
 
                 LV2PluginInstance& self;
+                int sampleOffset;
             };
 
-            patchSetHelper.processPatchSet (event, Callback { *this });
+            patchSetHelper.processPatchSet (event, Callback { *this, static_cast<int> (event->time.frames) });
 
             playHead.readNewInfo (event);
 
@@ -586,6 +600,7 @@ public:
             else
             {
                 const auto isEnabled = ports.isEnabled();
+                processor->setParameterAutomation (recordParameterAutomation ? &parameterAutomation : nullptr);
 
                 if (auto* param = processor->getBypassParameter())
                 {
@@ -600,6 +615,8 @@ public:
                 {
                     processor->processBlockBypassed (audio, midi);
                 }
+
+                processor->setParameterAutomation (nullptr);
             }
         }
 
@@ -785,6 +802,11 @@ private:
         midi.ensureSize (8192);
         audio.setSize (numChannels, maxBlockSize);
         audio.clear();
+
+        recordParameterAutomation = processor->supportsSampleAccurateAutomation();
+
+        if (recordParameterAutomation)
+            parameterAutomation.prepare (processor->getParameters().size());
     }
 
     LV2_URID map (StringRef uri) const { return mapFeature.map (mapFeature.handle, uri); }
@@ -805,6 +827,8 @@ private:
     PlayHead playHead;
     MidiBuffer midi;
     AudioBuffer<float> audio;
+    ParameterAutomationBuffer parameterAutomation;
+    bool recordParameterAutomation = false;
     std::atomic<bool> shouldSendStateChange { false };
 
    #define X(str) const LV2_URID m##str = map (str);
@@ -3502,9 +3502,27 @@ public:
                 }
                 else
                #endif
-                if (const auto change = getPointFromQueue (paramQueue, numPoints - 1))
+                if (auto* param = comPluginInstance->getParamForVSTParamID (vstParamID))
                 {
-                    if (auto* param = comPluginInstance->getParamForVSTParamID (vstParamID))
+                    if (recordParameterAutomation)
+                    {
+                        // Each VST3 point ramps linearly from the previous one, or from the start of the block
+                        Steinberg::int32 previousOffset = 0;
+
+                        for (Steinberg::int32 point = 0; point < numPoints; ++point)
+                        {
+                            if (const auto change = getPointFromQueue (paramQueue, point))
+                            {
+                                parameterAutomation.addPoint (param->getParameterIndex(),
+                                                              { (int) previousOffset,
+                                                                (int) (change->offsetSamples - previousOffset),
+                                                                (float) change->value });
+                                previousOffset = change->offsetSamples;
+                            }
+                        }
+                    }
+
+                    if (const auto change = getPointFromQueue (paramQueue, numPoints - 1))
                         setValueAndNotifyIfChanged (*param, (float) change->value);
                 }
             }
@@ -3557,6 +3575,7 @@ public:
         }
 
         midiBuffer.clear();
+        parameterAutomation.clear();
 
         if (data.inputParameterChanges != nullptr)
             processParameterChanges (*data.inputParameterChanges);
@@ -3696,12 +3715,16 @@ private:
             }
             else
             {
+                pluginInstance->setParameterAutomation (recordParameterAutomation ? &parameterAutomation : nullptr);
+
                 // processBlockBypassed should only ever be called if the AudioProcessor doesn't
                 // return a valid parameter from getBypassParameter
                 if (pluginInstance->getBypassParameter() == nullptr && comPluginInstance->getBypassParameter()->getValue() >= 0.5f)
                     pluginInstance->processBlockBypassed (buffer, midiBuffer);
                 else
                     pluginInstance->processBlock (buffer, midiBuffer);
+
+                pluginInstance->setParameterAutomation (nullptr);
             }
 
            #if JUCE_DEBUG && (! JucePlugin_ProducesMidiOutput)
@@ -3752,6 +3775,11 @@ private:
         midiBuffer.ensureSize (2048);
         midiBuffer.clear();
 
+        recordParameterAutomation = p.supportsSampleAccurateAutomation();
+
+        if (recordParameterAutomation)
+            parameterAutomation.prepare (p.getParameters().size());
+
         bufferMapper.updateFromProcessor (p);
         bufferMapper.prepare (bufferSize);
     }
@@ -3830,6 +3858,8 @@ private:
     Vst::ProcessSetup processSetup;
 
     MidiBuffer midiBuffer;
+    ParameterAutomationBuffer parameterAutomation;
+    bool recordParameterAutomation = false;
     ClientBufferMapper bufferMapper;
 
     bool active = false;
@@ -1099,70 +1099,87 @@ private:
 class HostBufferMapper
 {
 public:
-    /*  Builds a cached map of juce <-> vst3 channel mappings. */
+    /*  Builds a cached map of juce <-> vst3 channel mappings.
+
+        The JUCE channel for every VST3 channel on every bus is worked out here, so
+        that mapping a buffer on the audio thread is just a table lookup per channel.
+    */
     void prepare (std::vector<ChannelMapping> arrangements)
     {
         mappings = std::move (arrangements);
 
-        floatBusMap .resize (mappings.size());
-        doubleBusMap.resize (mappings.size());
-        busBuffers  .resize (mappings.size());
-    }
+        busBuffers.assign (mappings.size(), {});
+        busStarts.clear();
+        juceChannels.clear();
 
-    /*  Applies the mapping to an AudioBuffer using JUCE channel layout. */
-    template <typename FloatType>
-    Steinberg::Vst::AudioBusBuffers* getVst3LayoutForJuceBuffer (AudioBuffer<FloatType>& source)
-    {
         int channelIndexOffset = 0;
 
-        for (size_t i = 0; i < mappings.size(); ++i)
+        for (const auto& mapping : mappings)
         {
-            const auto& mapping = mappings[i];
-            associateBufferTo (busBuffers[i], get (detail::Tag<FloatType>{})[i], source, mapping, channelIndexOffset);
+            busStarts.push_back (juceChannels.size());
+
+            for (size_t i = 0; i < mapping.size(); ++i)
+                juceChannels.push_back (mapping.isActive() ? channelIndexOffset + mapping.getJuceChannelForVst3Channel ((int) i)
+                                                           : inactiveChannel);
+
             channelIndexOffset += mapping.isActive() ? (int) mapping.size() : 0;
         }
 
-        return busBuffers.data();
+        floatPointers .assign (juceChannels.size(), nullptr);
+        doublePointers.assign (juceChannels.size(), nullptr);
     }
 
-private:
-    template <typename FloatType>
-    using Bus = std::vector<FloatType*>;
+    /*  Applies the mapping to an AudioBuffer using JUCE channel layout.
 
+        No samples are copied: the plugin is given the AudioBuffer's own channel
+        pointers, reordered into VST3 channel order.
+    */
     template <typename FloatType>
-    using BusMap = std::vector<Bus<FloatType>>;
+    Steinberg::Vst::AudioBusBuffers* getVst3LayoutForJuceBuffer (AudioBuffer<FloatType>& source)
+    {
+        auto& pointers = get (detail::Tag<FloatType>{});
+        auto* const* channels = source.getArrayOfWritePointers();
+        const auto numSourceChannels = source.getNumChannels();
 
-    static void assignRawPointer (Steinberg::Vst::AudioBusBuffers& vstBuffers, float** raw)  { vstBuffers.channelBuffers32 = raw; }
-    static void assignRawPointer (Steinberg::Vst::AudioBusBuffers& vstBuffers, double** raw) { vstBuffers.channelBuffers64 = raw; }
+        for (size_t i = 0; i < juceChannels.size(); ++i)
+        {
+            const auto juceChannel = juceChannels[i];
 
-    template <typename FloatType>
-    void associateBufferTo (Steinberg::Vst::AudioBusBuffers& vstBuffers,
-                            Bus<FloatType>& bus,
-                            AudioBuffer<FloatType>& buffer,
-                            const ChannelMapping& busMap,
-                            int channelStartOffset) const
-    {
-        bus.clear();
+            // The buffer doesn't have enough channels for the layout that we were prepared with!
+            jassert (juceChannel < numSourceChannels);
+
+            pointers[i] = isPositiveAndBelow (juceChannel, numSourceChannels) ? channels[juceChannel] : nullptr;
+        }
 
-        for (size_t i = 0; i < busMap.size(); ++i)
+        for (size_t i = 0; i < mappings.size(); ++i)
         {
-            bus.push_back (busMap.isActive() ? buffer.getWritePointer (channelStartOffset + busMap.getJuceChannelForVst3Channel ((int) i))
-                                             : nullptr);
+            auto& vstBuffers = busBuffers[i];
+            assignRawPointer (vstBuffers, pointers.data() + busStarts[i]);
+
+            // The plugin may have changed these during the previous block
+            vstBuffers.numChannels  = (Steinberg::int32) mappings[i].size();
+            vstBuffers.silenceFlags = mappings[i].isActive() ? 0 : std::numeric_limits<Steinberg::uint64>::max();
         }
 
-        assignRawPointer (vstBuffers, bus.data());
-        vstBuffers.numChannels      = (Steinberg::int32) busMap.size();
-        vstBuffers.silenceFlags     = busMap.isActive() ? 0 : std::numeric_limits<Steinberg::uint64>::max();
+        return busBuffers.data();
     }
 
-    auto& get (detail::Tag<float>)    { return floatBusMap; }
-    auto& get (detail::Tag<double>)   { return doubleBusMap; }
+private:
+    static constexpr int inactiveChannel = -1;
 
-    BusMap<float>  floatBusMap;
-    BusMap<double> doubleBusMap;
+    static void assignRawPointer (Steinberg::Vst::AudioBusBuffers& vstBuffers, float** raw)  { vstBuffers.channelBuffers32 = raw; }
+    static void assignRawPointer (Steinberg::Vst::AudioBusBuffers& vstBuffers, double** raw) { vstBuffers.channelBuffers64 = raw; }
+
+    auto& get (detail::Tag<float>)    { return floatPointers; }
+    auto& get (detail::Tag<double>)   { return doublePointers; }
+
+    std::vector<float*>  floatPointers;
+    std::vector<double*> doublePointers;
 
     std::vector<Steinberg::Vst::AudioBusBuffers> busBuffers;
     std::vector<ChannelMapping> mappings;
+    std::vector<size_t> busStarts;
+    std::vector<int> juceChannels;
 };
 
 //==============================================================================
@@ -1319,6 +1336,14 @@ public:
         events.clearQuick();
     }
 
+    /*  Preallocates space for events, so that filling the list on the audio thread
+        doesn't need to allocate.
+    */
+    void ensureStorageAllocated (int numEvents)
+    {
+        events.ensureStorageAllocated (numEvents);
+    }
+
     Steinberg::int32 PLUGIN_API getEventCount() override
     {
         return (Steinberg::int32) events.size();
@@ -1453,7 +1478,8 @@ private:
         }
     }
 
-    Array<Steinberg::Vst::Event, CriticalSection> events;
+    // Only the thread that's calling process() touches the list, so it doesn't need a lock
+    Array<Steinberg::Vst::Event> events;
     Atomic<int> refCount;
 
     static Steinberg::int16 createSafeChannel (int channel) noexcept  { return (Steinberg::int16) jlimit (0, 15, channel - 1); }
@@ -2153,6 +2153,7 @@ private:
     - Lookup by index is O(1)
     - Lookup by paramID is also O(1)
     - addParameterData never allocates, as long you pass a paramID already passed to initialise
+    - setByIndex avoids hashing altogether, for hosts that already know the parameter index
 */
 class ParameterChanges final : public Vst::IParameterChanges
 {
@@ -2202,12 +2203,7 @@ public:
             return nullptr;
 
         auto& result = it->second;
-
-        if (result.index == notInVector)
-        {
-            result.index = (Steinberg::int32) queues.size();
-            queues.push_back (&result);
-        }
+        enqueue (result);
 
         index = result.index;
         return result.ptr.get();
@@ -2221,6 +2217,20 @@ public:
             queue->set (value);
     }
 
+    /*  Sets the value of the parameter at this position in the vector passed to initialise. */
+    void setByIndex (Steinberg::int32 parameterIndex, float value)
+    {
+        if (! isPositiveAndBelow (parameterIndex, entriesByIndex.size()))
+        {
+            jassertfalse;
+            return;
+        }
+
+        auto& entry = *entriesByIndex[(size_t) parameterIndex];
+        enqueue (entry);
+        entry.ptr->set (value);
+    }
+
     void clear()
     {
         for (auto* item : queues)
@@ -2234,6 +2244,12 @@ public:
         for (const auto [index, id] : enumerate (idsIn))
             map.emplace (id, Entry { std::make_unique<ParamValueQueue> (id, (Steinberg::int32) index) });
 
+        // Pointers to elements of an unordered_map stay valid when more elements are added
+        entriesByIndex.clear();
+
+        for (const auto& id : idsIn)
+            entriesByIndex.push_back (&map.at (id));
+
         queues.reserve (map.size());
         queues.clear();
     }
@@ -2249,8 +2265,18 @@ public:
     }
 
 private:
+    void enqueue (Entry& entry)
+    {
+        if (entry.index == notInVector)
+        {
+            entry.index = (Steinberg::int32) queues.size();
+            queues.push_back (&entry);
+        }
+    }
+
     Map map;
     Queues queues;
+    std::vector<Entry*> entriesByIndex;
     Atomic<int> refCount;
 };
 
@@ -2624,6 +2650,12 @@ public:
         inputBusMap .prepare (createChannelMappings (true));
         outputBusMap.prepare (createChannelMappings (false));
 
+        // The lists can still grow if there are more events than this in a block,
+        // but that should be rare enough that it's not worth keeping more memory around
+        constexpr auto numEventsToPreallocate = 256;
+        midiInputs ->ensureStorageAllocated (numEventsToPreallocate);
+        midiOutputs->ensureStorageAllocated (numEventsToPreallocate);
+
         setStateForAllMidiBuses (true);
 
         warnOnFailure (holder->component->setActive (true));
@@ -2748,7 +2780,7 @@ public:
 
         cachedParamValues.ifSet ([&] (Steinberg::int32 index, float value)
         {
-            inputParameterChanges->set (cachedParamValues.getParamID (index), value);
+            inputParameterChanges->setByIndex (index, value);
         });
 
         processor->process (data);
@@ -549,6 +549,47 @@ public:
                 expect (clientBuffers[2].channelBuffers64[0] == hostBuffer.getReadPointer (1));
                 expect (clientBuffers[3].channelBuffers64[0] == nullptr);
             }
+
+            {
+                mapper.prepare ({ ChannelMapping { AudioChannelSet::stereo() },
+                                  ChannelMapping { AudioChannelSet::stereo(), false } });
+                AudioBuffer<float> hostBuffer (2, blockSize);
+                auto* clientBuffers = mapper.getVst3LayoutForJuceBuffer (hostBuffer);
+
+                // Plugins report silent outputs by setting these
+                clientBuffers[0].silenceFlags = 3;
+                clientBuffers[1].silenceFlags = 0;
+
+                clientBuffers = mapper.getVst3LayoutForJuceBuffer (hostBuffer);
+
+                expect (clientBuffers[0].silenceFlags == 0);
+                expect (clientBuffers[1].silenceFlags == std::numeric_limits<Steinberg::uint64>::max());
+                expect (clientBuffers[0].channelBuffers32[1] == hostBuffer.getReadPointer (1));
+            }
+        }
+
+        beginTest ("ParameterChanges can be set by ID or by index");
+        {
+            ParameterChanges changes;
+            changes.initialise ({ 100, 200, 300 });
+
+            changes.setByIndex (2, 0.25f);
+            changes.set (100, 0.5f);
+            changes.setByIndex (2, 0.75f);
+
+            expectEquals ((int) changes.getParameterCount(), 2);
+
+            auto* first = changes.getParameterData (0);
+            expect (first->getParameterId() == 300);
+            expectEquals (first->getPointCount(), 1);
+            expectEquals (first->get(), 0.75f);
+
+            auto* second = changes.getParameterData (1);
+            expect (second->getParameterId() == 100);
+            expectEquals (second->get(), 0.5f);
+
+            changes.clear();
+            expectEquals ((int) changes.getParameterCount(), 0);
         }
 
         beginTest ("Speaker layout conversions");
@@ -208,9 +208,12 @@ private:
 #include "format_types/juce_AudioUnitPluginFormat.mm"
 #include "format_types/juce_ARAHosting.cpp"
 #include "scanning/juce_KnownPluginList.cpp"
+#include "scanning/juce_KnownPluginListCache.cpp"
 #include "scanning/juce_PluginDirectoryScanner.cpp"
+#include "scanning/juce_OutOfProcessPluginScanner.cpp"
 #include "scanning/juce_PluginListComponent.cpp"
 #include "processors/juce_AudioProcessorParameterGroup.cpp"
+#include "processors/juce_ParameterAutomationBuffer.cpp"
 #include "utilities/juce_AudioProcessorParameterWithID.cpp"
 #include "utilities/juce_RangedAudioParameter.cpp"
 #include "utilities/juce_AudioParameterFloat.cpp"
@@ -611,6 +611,11 @@ bool AudioProcessor::supportsDoublePrecisionProcessing() const
     return false;
 }
 
+bool AudioProcessor::supportsSampleAccurateAutomation() const
+{
+    return false;
+}
+
 void AudioProcessor::setProcessingPrecision (ProcessingPrecision precision) noexcept
 {
     // If you hit this assertion then you're trying to use double precision
@@ -727,6 +727,39 @@ public:
     */
     AudioPlayHead* getPlayHead() const noexcept                 { return playHead; }
 
+    //==============================================================================
+    /** Returns true if this processor wants to receive sample-accurate parameter
+        automation through getParameterAutomation().
+
+        The default implementation returns false. Override it to return true if you
+        want the plugin wrappers to collect every automation point that the host
+        sends, rather than only passing on the last value of each block.
+
+        @see getParameterAutomation, ParameterAutomationBuffer
+    */
+    virtual bool supportsSampleAccurateAutomation() const;
+
+    /** Returns the parameter automation that the host sent for the current block.
+
+        Like getPlayHead(), you can ONLY call this from your processBlock() method, and
+        must not keep the pointer after processBlock() returns.
+
+        This will return nullptr unless supportsSampleAccurateAutomation() returns true
+        and the wrapper that is running this processor is able to provide
+        sample-accurate automation.
+
+        @see supportsSampleAccurateAutomation, ParameterAutomationBuffer
+    */
+    const ParameterAutomationBuffer* getParameterAutomation() const noexcept    { return parameterAutomation; }
+
+    /** Provides the automation for the next block.
+
+        This is called by plugin wrappers and hosts before processBlock(), and the
+        buffer must stay valid until processBlock() returns. Pass nullptr once the
+        block has been processed.
+    */
+    void setParameterAutomation (const ParameterAutomationBuffer* newAutomation) noexcept    { parameterAutomation = newAutomation; }
+
     //==============================================================================
     /** Returns the total number of input channels.
 
@@ -1528,6 +1561,7 @@ private:
     bool suspended = false;
     std::atomic<bool> nonRealtime { false };
     ProcessingPrecision processingPrecision = singlePrecision;
+    const ParameterAutomationBuffer* parameterAutomation = nullptr;
     CriticalSection callbackLock, listenerLock, activeEditorLock;
 
     friend class Bus;
@@ -140,9 +140,12 @@ public:
     using NodeAndChannel = AudioProcessorGraph::NodeAndChannel;
 
 private:
-    static auto equalRange (const std::set<NodeAndChannel>& pins, const NodeID node)
+    // std::equal_range would walk the container linearly, as set and map iterators aren't random-access
+    template <typename Container>
+    static auto equalRange (const Container& pins, const NodeID node)
     {
-        return std::equal_range (pins.cbegin(), pins.cend(), node, ImplicitNode::compare);
+        return std::make_pair (pins.lower_bound ({ node, std::numeric_limits<int>::min() }),
+                               pins.upper_bound ({ node, std::numeric_limits<int>::max() }));
     }
 
     using Map = std::map<NodeAndChannel, std::set<NodeAndChannel>>;
@@ -362,12 +365,267 @@ private:
 
     std::pair<Map::const_iterator, Map::const_iterator> getMatchingDestinations (NodeID destID) const
     {
-        return std::equal_range (sourcesForDestination.cbegin(), sourcesForDestination.cend(), destID, ImplicitNode::compare);
+        return equalRange (sourcesForDestination, destID);
     }
 
     Map sourcesForDestination;
 };
 
+//==============================================================================
+/*  Keeps the nodes of a graph in an order where every node comes after all of its inputs.
+
+    Rather than sorting the whole graph after every edit, the order is updated locally as
+    connections are made: adding a connection only moves the nodes lying between its two ends
+    in the current order (this is the Pearce-Kelly dynamic topological sort), and removing
+    nodes or connections can never invalidate the order.
+
+    A graph with a feedback loop has no such order. If a connection closes a loop, the order is
+    marked as invalid, and recalculate() must be used to get it back once the loop is broken.
+*/
+class NodeOrdering
+{
+public:
+    using Node           = AudioProcessorGraph::Node;
+    using NodeID         = AudioProcessorGraph::NodeID;
+
+    void clear()
+    {
+        *this = NodeOrdering{};
+    }
+
+    void addNode (NodeID nodeID)
+    {
+        if (entries.emplace (nodeID, Entry { order.size(), {}, {} }).second)
+            order.push_back (nodeID);
+    }
+
+    void removeNode (NodeID nodeID)
+    {
+        const auto iter = entries.find (nodeID);
+
+        if (iter == entries.end())
+            return;
+
+        disconnectNode (nodeID);
+
+        const auto position = iter->second.position;
+        entries.erase (iter);
+        order.erase (order.begin() + (ptrdiff_t) position);
+
+        for (auto i = position; i < order.size(); ++i)
+            entries[order[i]].position = i;
+    }
+
+    /*  Call once for each connected pair of channels. */
+    void addConnection (NodeID source, NodeID dest)
+    {
+        auto& sourceEntry = entries[source];
+        auto& destEntry   = entries[dest];
+
+        const auto isNewEdge = sourceEntry.outputs[dest]++ == 0;
+        destEntry.inputs[source]++;
+
+        if (valid && isNewEdge && destEntry.position < sourceEntry.position)
+            reorder (source, dest);
+    }
+
+    /*  Call once for each disconnected pair of channels. */
+    void removeConnection (NodeID source, NodeID dest)
+    {
+        removeEdge (entries[source].outputs, dest);
+        removeEdge (entries[dest].inputs, source);
+    }
+
+    void disconnectNode (NodeID nodeID)
+    {
+        auto& entry = entries[nodeID];
+
+        for (const auto& input : entry.inputs)
+            entries[input.first].outputs.erase (nodeID);
+
+        for (const auto& output : entry.outputs)
+            entries[output.first].inputs.erase (nodeID);
+
+        entry.inputs.clear();
+        entry.outputs.clear();
+    }
+
+    /*  Throws away all the incremental state, and sorts the graph from scratch. */
+    void reset (const Nodes& n, const Connections& c)
+    {
+        clear();
+
+        for (const auto& node : n.getNodes())
+            addNode (node->nodeID);
+
+        for (const auto& connection : c.getConnections())
+            addConnection (connection.source.nodeID, connection.destination.nodeID);
+
+        if (! valid)
+            recalculate();
+    }
+
+    /*  Tries to sort the graph from scratch, which will only succeed if it has no feedback loops.
+        Ties are broken by NodeID, so nodes are otherwise rendered in the order they were added.
+    */
+    void recalculate()
+    {
+        std::map<NodeID, size_t> numInputs;
+        std::set<NodeID> ready;
+
+        for (const auto& [nodeID, entry] : entries)
+        {
+            numInputs[nodeID] = entry.inputs.size();
+
+            if (entry.inputs.empty())
+                ready.insert (nodeID);
+        }
+
+        std::vector<NodeID> newOrder;
+        newOrder.reserve (entries.size());
+
+        while (! ready.empty())
+        {
+            const auto nodeID = *ready.begin();
+            ready.erase (ready.begin());
+            newOrder.push_back (nodeID);
+
+            for (const auto& output : entries[nodeID].outputs)
+                if (--numInputs[output.first] == 0)
+                    ready.insert (output.first);
+        }
+
+        valid = newOrder.size() == entries.size();
+
+        if (! valid)
+            return;
+
+        order = std::move (newOrder);
+
+        for (size_t i = 0; i < order.size(); ++i)
+            entries[order[i]].position = i;
+    }
+
+    bool isValid() const noexcept { return valid; }
+
+    Array<Node*> getOrderedNodes (const Nodes& n) const
+    {
+        jassert (valid);
+
+        Array<Node*> result;
+        result.ensureStorageAllocated ((int) order.size());
+
+        for (const auto& nodeID : order)
+            if (auto node = n.getNodeForId (nodeID))
+                result.add (node.get());
+
+        return result;
+    }
+
+private:
+    struct Entry
+    {
+        size_t position = 0;
+
+        // Maps each connected node to the number of channel connections to or from it
+        std::map<NodeID, int> inputs, outputs;
+    };
+
+    static void removeEdge (std::map<NodeID, int>& edges, NodeID other)
+    {
+        const auto iter = edges.find (other);
+
+        if (iter != edges.end() && --iter->second <= 0)
+            edges.erase (iter);
+    }
+
+    /*  Called when a new connection from source to dest goes 'backwards' in the current order. */
+    void reorder (NodeID source, NodeID dest)
+    {
+        const auto lowerBound = entries[dest].position;
+        const auto upperBound = entries[source].position;
+
+        // Everything downstream of dest that currently comes no later than the source...
+        std::vector<NodeID> forward;
+
+        if (! search (dest, lowerBound, upperBound, &Entry::outputs, source, forward))
+        {
+            // ...includes the source, so the new connection closes a feedback loop
+            valid = false;
+            return;
+        }
+
+        // ...and everything upstream of the source that currently comes no earlier than dest
+        std::vector<NodeID> backward;
+        search (source, lowerBound, upperBound, &Entry::inputs, {}, backward);
+
+        const auto byPosition = [this] (NodeID a, NodeID b) { return entries[a].position < entries[b].position; };
+        std::sort (forward.begin(), forward.end(), byPosition);
+        std::sort (backward.begin(), backward.end(), byPosition);
+
+        // The affected nodes keep the same set of positions, but everything upstream of the
+        // source now comes before everything downstream of dest
+        std::vector<size_t> positions;
+
+        for (const auto& group : { &backward, &forward })
+            for (const auto& nodeID : *group)
+                positions.push_back (entries[nodeID].position);
+
+        std::sort (positions.begin(), positions.end());
+
+        auto position = positions.begin();
+
+        for (const auto& group : { &backward, &forward })
+        {
+            for (const auto& nodeID : *group)
+            {
+                entries[nodeID].position = *position++;
+                order[entries[nodeID].position] = nodeID;
+            }
+        }
+    }
+
+    /*  Collects all the nodes reachable from start without leaving the range of positions
+        between lowerBound and upperBound. Returns false if the target node is reached.
+    */
+    bool search (NodeID start,
+                 size_t lowerBound,
+                 size_t upperBound,
+                 std::map<NodeID, int> Entry::* edges,
+                 std::optional<NodeID> target,
+                 std::vector<NodeID>& visited)
+    {
+        std::set<NodeID> seen { start };
+        std::vector<NodeID> stack { start };
+
+        while (! stack.empty())
+        {
+            const auto nodeID = stack.back();
+            stack.pop_back();
+            visited.push_back (nodeID);
+
+            for (const auto& edge : entries[nodeID].*edges)
+            {
+                const auto next = edge.first;
+
+                if (next == target)
+                    return false;
+
+                const auto position = entries[next].position;
+
+                if (lowerBound <= position && position <= upperBound && seen.insert (next).second)
+                    stack.push_back (next);
+            }
+        }
+
+        return true;
+    }
+
+    std::map<NodeID, Entry> entries;
+    std::vector<NodeID> order;
+    bool valid = true;
+};
+
 //==============================================================================
 /*  Settings used to prepare a node for playback. */
 struct PrepareSettings
@@ -494,6 +752,332 @@ private:
     std::optional<PrepareSettings> current, next;
 };
 
+//==============================================================================
+/*  Collects the time taken by each node's processBlock call.
+
+    Timings are written by the audio thread (and any render threads) into a fixed-size ring
+    buffer, without locking or allocating. Each slot is guarded by a sequence number, so writers
+    never wait for each other or for the reader: if the reader falls too far behind, the oldest
+    timings are simply overwritten and skipped.
+
+    The statistics are aggregated on whichever thread calls collect(), which will normally be a
+    UI timer.
+*/
+class NodeProfiler
+{
+public:
+    using NodeID      = AudioProcessorGraph::NodeID;
+    using NodeTimings = AudioProcessorGraph::NodeTimings;
+
+    /*  Wait-free, may be called from any number of threads at once. */
+    void record (NodeID nodeID, int64 ticks) noexcept
+    {
+        const auto index = writeIndex.fetch_add (1, std::memory_order_relaxed);
+        auto& slot = slots[(size_t) (index & mask)];
+
+        slot.sequence.store (2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence (std::memory_order_release);
+        slot.nodeID.store (nodeID.uid, std::memory_order_relaxed);
+        slot.ticks.store (ticks, std::memory_order_relaxed);
+        slot.sequence.store (2 * index + 2, std::memory_order_release);
+    }
+
+    /*  Reads any new timings, and returns the statistics for every node that has been timed. */
+    std::vector<NodeTimings> collect()
+    {
+        const ScopedLock sl (readerLock);
+
+        const auto end = writeIndex.load (std::memory_order_acquire);
+        readIndex = jmax (readIndex, end - jmin (end, (uint64) numSlots));
+
+        for (; readIndex < end; ++readIndex)
+        {
+            const auto& slot = slots[(size_t) (readIndex & mask)];
+            const auto expected = 2 * readIndex + 2;
+            const auto before = slot.sequence.load (std::memory_order_acquire);
+
+            // This timing hasn't finished being written yet, so try again next time
+            if (before < expected)
+                break;
+
+            const auto nodeID = slot.nodeID.load (std::memory_order_relaxed);
+            const auto ticks  = slot.ticks .load (std::memory_order_relaxed);
+            std::atomic_thread_fence (std::memory_order_acquire);
+
+            // Otherwise, the slot has already been reused by a newer timing
+            if (before == expected && slot.sequence.load (std::memory_order_relaxed) == expected)
+                accumulators[nodeID].add (ticks);
+        }
+
+        std::vector<NodeTimings> result;
+        result.reserve (accumulators.size());
+
+        for (const auto& [uid, accumulator] : accumulators)
+            result.push_back (accumulator.getTimings (NodeID { uid }));
+
+        return result;
+    }
+
+    void reset()
+    {
+        const ScopedLock sl (readerLock);
+        accumulators.clear();
+        readIndex = writeIndex.load (std::memory_order_acquire);
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64> sequence { 0 };
+        std::atomic<uint32> nodeID { 0 };
+        std::atomic<int64> ticks { 0 };
+    };
+
+    struct Accumulator
+    {
+        // The percentile is calculated from this many of the most recent calls
+        static constexpr size_t historySize = 1024;
+
+        void add (int64 ticks)
+        {
+            minTicks = numCalls == 0 ? ticks : jmin (minTicks, ticks);
+            maxTicks = jmax (maxTicks, ticks);
+            totalTicks += (double) ticks;
+
+            if (recent.size() < historySize)
+                recent.push_back (ticks);
+            else
+                recent[(size_t) numCalls % historySize] = ticks;
+
+            ++numCalls;
+        }
+
+        NodeTimings getTimings (NodeID nodeID) const
+        {
+            NodeTimings result;
+            result.nodeID = nodeID;
+            result.numCalls = numCalls;
+
+            if (numCalls == 0)
+                return result;
+
+            auto sorted = recent;
+            const auto p99 = sorted.begin() + (ptrdiff_t) ((sorted.size() * 99) / 100);
+            std::nth_element (sorted.begin(), p99, sorted.end());
+
+            result.minSeconds  = Time::highResolutionTicksToSeconds (minTicks);
+            result.maxSeconds  = Time::highResolutionTicksToSeconds (maxTicks);
+            result.meanSeconds = Time::highResolutionTicksToSeconds (1) * totalTicks / (double) numCalls;
+            result.p99Seconds  = Time::highResolutionTicksToSeconds (*p99);
+            return result;
+        }
+
+        int64 numCalls = 0, minTicks = 0, maxTicks = 0;
+        double totalTicks = 0.0;
+        std::vector<int64> recent;
+    };
+
+    static constexpr size_t numSlots = 1 << 14;
+    static constexpr uint64 mask = numSlots - 1;
+
+    std::vector<Slot> slots = std::vector<Slot> (numSlots);
+    std::atomic<uint64> writeIndex { 0 };
+
+    CriticalSection readerLock;
+    uint64 readIndex = 0;
+    std::map<uint32, Accumulator> accumulators;
+};
+
+//==============================================================================
+/*  A set of realtime threads that help the audio thread to render independent parts of a graph.
+
+    The audio thread calls run() with a Job, and works on it alongside any workers that wake up
+    in time. run() only returns once the job is complete and no worker is touching it any more,
+    so the job can be reset for the next block without further synchronisation.
+*/
+class RenderThreadPool
+{
+public:
+    struct Job
+    {
+        virtual ~Job() = default;
+
+        /*  Called concurrently on the audio thread and on any workers that join in.
+            The audio thread's call must not return until the job is finished, but workers
+            may leave early if there's nothing left for them to do.
+        */
+        virtual void contribute (bool isAudioThread) = 0;
+    };
+
+    RenderThreadPool (int numThreads, const AudioWorkgroup& workgroupToJoin)
+    {
+        setWorkgroup (workgroupToJoin);
+
+        for (int i = 0; i < numThreads; ++i)
+            workers.push_back (std::make_unique<Worker> (*this, i));
+    }
+
+    ~RenderThreadPool()
+    {
+        for (auto& worker : workers)
+        {
+            worker->signalThreadShouldExit();
+            worker->notify();
+        }
+
+        for (auto& worker : workers)
+            worker->stopThread (-1);
+    }
+
+    int getNumThreads() const noexcept   { return (int) workers.size(); }
+
+    /*  May be called from any thread. Each worker rejoins the new workgroup before it next waits for work. */
+    void setWorkgroup (const AudioWorkgroup& newWorkgroup)
+    {
+        {
+            const SpinLock::ScopedLockType lock (workgroupLock);
+            workgroup = newWorkgroup;
+        }
+
+        workgroupGeneration.fetch_add (1, std::memory_order_release);
+    }
+
+    /*  Call from the audio thread only. Asks up to maxNumWorkers workers to help with the job.
+
+        Workers that have recently finished a job are still spinning, and will see the new one
+        without any locking. Waking a worker that has gone to sleep signals a WaitableEvent,
+        which may briefly take a lock.
+    */
+    void run (Job& job, int maxNumWorkers) noexcept
+    {
+        const auto numWorkers = jmin (maxNumWorkers, (int) workers.size());
+
+        currentJob.store (&job);
+        numWorkersWanted.store (numWorkers);
+        jobGeneration.fetch_add (1);
+
+        for (int i = 0; i < numWorkers; ++i)
+            if (workers[(size_t) i]->isSleeping.load())
+                workers[(size_t) i]->notify();
+
+        job.contribute (true);
+
+        // Workers check the job after announcing themselves, so once this store has happened and
+        // the active count drops to zero, nobody can still be looking at the job
+        currentJob.store (nullptr);
+
+        while (numActiveWorkers.load() != 0)
+        {}
+    }
+
+private:
+    class Worker final : public Thread
+    {
+    public:
+        Worker (RenderThreadPool& o, int indexIn)
+            : Thread ("Graph render thread " + String (indexIn + 1)), owner (o), index (indexIn)
+        {
+            if (! startRealtimeThread (RealtimeOptions{}.withPriority (9)))
+                startThread (Priority::highest);
+        }
+
+        void run() override
+        {
+            WorkgroupToken token;
+            int joinedGeneration = -1;
+            auto lastJobGeneration = owner.jobGeneration.load();
+
+            while (! threadShouldExit())
+            {
+                owner.joinWorkgroupIfChanged (token, joinedGeneration);
+
+                if (! waitForNextJob (lastJobGeneration))
+                    continue;
+
+                lastJobGeneration = owner.jobGeneration.load();
+
+                if (index < owner.numWorkersWanted.load())
+                    owner.contributeToCurrentJob();
+            }
+        }
+
+        std::atomic<bool> isSleeping { false };
+
+    private:
+        /*  Spins for a short while, so that the next block's job can be picked up without
+            the audio thread having to wake this thread, and then sleeps.
+            Returns true if there's a new job.
+        */
+        bool waitForNextJob (uint32 lastJobGeneration)
+        {
+            const auto hasNewJob = [&] { return owner.jobGeneration.load() != lastJobGeneration; };
+            const auto spinEnd = Time::getHighResolutionTicks() + Time::secondsToHighResolutionTicks (spinTimeSeconds);
+
+            while (Time::getHighResolutionTicks() < spinEnd)
+                if (hasNewJob() || threadShouldExit())
+                    return hasNewJob();
+
+            // The audio thread bumps the generation before checking this flag, and we set the
+            // flag before checking the generation, so one of us will always see the other
+            isSleeping.store (true);
+
+            if (! hasNewJob())
+                wait (-1);
+
+            isSleeping.store (false);
+            return hasNewJob();
+        }
+
+        static constexpr double spinTimeSeconds = 0.0002;
+
+        RenderThreadPool& owner;
+        const int index;
+    };
+
+    void joinWorkgroupIfChanged (WorkgroupToken& token, int& joinedGeneration)
+    {
+        const auto generation = workgroupGeneration.load (std::memory_order_acquire);
+
+        if (generation == joinedGeneration)
+            return;
+
+        joinedGeneration = generation;
+
+        const auto toJoin = [&]
+        {
+            const SpinLock::ScopedLockType lock (workgroupLock);
+            return workgroup;
+        }();
+
+        token.reset();
+
+        if (toJoin)
+            toJoin.join (token);
+    }
+
+    void contributeToCurrentJob()
+    {
+        numActiveWorkers.fetch_add (1);
+
+        if (auto* job = currentJob.load())
+            job->contribute (false);
+
+        numActiveWorkers.fetch_sub (1);
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<Job*> currentJob { nullptr };
+    std::atomic<int> numActiveWorkers { 0 }, numWorkersWanted { 0 };
+    std::atomic<uint32> jobGeneration { 0 };
+
+    SpinLock workgroupLock;
+    AudioWorkgroup workgroup;
+    std::atomic<int> workgroupGeneration { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (RenderThreadPool)
+    JUCE_DECLARE_NON_MOVEABLE (RenderThreadPool)
+};
+
 //==============================================================================
 template <typename FloatType>
 struct GraphRenderSequence
@@ -513,9 +1097,19 @@ struct GraphRenderSequence
         GlobalIO globalIO;
         AudioPlayHead* audioPlayHead;
         int numSamples;
+        NodeProfiler* profiler;
+    };
+
+    /*  A channel that is mixed into another, after being delayed by some number of samples. */
+    struct ChannelToSum
+    {
+        int index = 0, delay = 0;
     };
 
-    void perform (AudioBuffer<FloatType>& buffer, MidiBuffer& midiMessages, AudioPlayHead* audioPlayHead)
+    void perform (AudioBuffer<FloatType>& buffer,
+                  MidiBuffer& midiMessages,
+                  AudioPlayHead* audioPlayHead,
+                  NodeProfiler* profiler)
     {
         auto numSamples = buffer.getNumSamples();
         auto maxSamples = renderingBuffer.getNumSamples();
@@ -534,7 +1128,7 @@ struct GraphRenderSequence
 
                 // Splitting up the buffer like this will cause the play head and host time to be
                 // invalid for all but the first chunk...
-                perform (audioChunk, midiChunk, audioPlayHead);
+                perform (audioChunk, midiChunk, audioPlayHead, profiler);
 
                 chunkStartSample += maxSamples;
             }
@@ -552,10 +1146,18 @@ struct GraphRenderSequence
                                       midiMessages,
                                       currentMidiOutputBuffer },
                                     audioPlayHead,
-                                    numSamples };
+                                    numSamples,
+                                    profiler };
 
-            for (const auto& op : renderOps)
-                op->process (context);
+            if (threadPool != nullptr && scheduler != nullptr)
+            {
+                scheduler->perform (*threadPool, renderOps, context);
+            }
+            else
+            {
+                for (const auto& op : renderOps)
+                    op->process (context);
+            }
         }
 
         for (int i = 0; i < buffer.getNumChannels(); ++i)
@@ -573,7 +1175,7 @@ struct GraphRenderSequence
         {
             explicit ClearOp (int indexIn) : index (indexIn) {}
 
-            void prepare (FloatType* const* renderBuffer, MidiBuffer*) override
+            void prepare (FloatType* const* renderBuffer, MidiBuffer*, int) override
             {
                 channelBuffer = renderBuffer[index];
             }
@@ -587,7 +1189,7 @@ struct GraphRenderSequence
             int index = 0;
         };
 
-        renderOps.push_back (std::make_unique<ClearOp> (index));
+        addOp (std::make_unique<ClearOp> (index), {}, { audioResource (index) });
     }
 
     void addCopyChannelOp (int srcIndex, int dstIndex)
@@ -596,7 +1198,7 @@ struct GraphRenderSequence
         {
             explicit CopyOp (int fromIn, int toIn) : from (fromIn), to (toIn) {}
 
-            void prepare (FloatType* const* renderBuffer, MidiBuffer*) override
+            void prepare (FloatType* const* renderBuffer, MidiBuffer*, int) override
             {
                 fromBuffer = renderBuffer[from];
                 toBuffer = renderBuffer[to];
@@ -612,32 +1214,122 @@ struct GraphRenderSequence
             int from = 0, to = 0;
         };
 
-        renderOps.push_back (std::make_unique<CopyOp> (srcIndex, dstIndex));
+        addOp (std::make_unique<CopyOp> (srcIndex, dstIndex), { audioResource (srcIndex) }, { audioResource (dstIndex) });
     }
 
-    void addAddChannelOp (int srcIndex, int dstIndex)
+    /*  Mixes several channels into dstIndex, delaying each one by a different amount.
+
+        If dstIsInput is true, dstIndex already holds one of the channels to be mixed,
+        which needs to be delayed by dstDelay. Otherwise its contents are ignored.
+    */
+    void addSumChannelsOp (int dstIndex, bool dstIsInput, int dstDelay, std::vector<ChannelToSum> sources)
     {
-        struct AddOp final : public RenderOp
+        /*  Rather than each input having its own delay line, the inputs share a single
+            ring, which holds the sum of all the delayed samples that are still to be output.
+            Each input with a delay of d is added into the ring d samples ahead of the read
+            position, and then the block at the read position is added to the output and
+            cleared. Every step is a vector operation on (at most two) contiguous runs.
+        */
+        struct SumOp final : public RenderOp
         {
-            explicit AddOp (int fromIn, int toIn) : from (fromIn), to (toIn) {}
+            SumOp (int dstIndexIn, bool dstIsInputIn, int dstDelayIn, std::vector<ChannelToSum> sourcesIn)
+                : dstIndex (dstIndexIn),
+                  dstDelay (dstIsInputIn ? dstDelayIn : 0),
+                  dstIsInput (dstIsInputIn),
+                  sources (std::move (sourcesIn)),
+                  sourceBuffers (sources.size())
+            {
+            }
 
-            void prepare (FloatType* const* renderBuffer, MidiBuffer*) override
+            void prepare (FloatType* const* renderBuffer, MidiBuffer*, int maxNumSamples) override
             {
-                fromBuffer = renderBuffer[from];
-                toBuffer = renderBuffer[to];
+                dstBuffer = renderBuffer[dstIndex];
+
+                for (size_t i = 0; i < sources.size(); ++i)
+                    sourceBuffers[i] = renderBuffer[sources[i].index];
+
+                const auto maxDelay = std::accumulate (sources.begin(), sources.end(), dstDelay, [] (int acc, const ChannelToSum& s)
+                {
+                    return jmax (acc, s.delay);
+                });
+
+                ring.clear();
+
+                if (maxDelay > 0)
+                    ring.resize ((size_t) nextPowerOfTwo (maxDelay + maxNumSamples), (FloatType) 0);
+
+                maxBlockSize = maxNumSamples;
+                position = 0;
             }
 
             void process (const Context& c) override
             {
-                FloatVectorOperations::add (toBuffer, fromBuffer, c.numSamples);
+                const auto numSamples = (size_t) c.numSamples;
+
+                // The ring was sized for blocks of at most this length
+                jassert (c.numSamples <= maxBlockSize);
+
+                if (dstDelay > 0)
+                    addToRing (dstBuffer, dstDelay, numSamples);
+
+                for (size_t i = 0; i < sources.size(); ++i)
+                    if (sources[i].delay > 0)
+                        addToRing (sourceBuffers[i], sources[i].delay, numSamples);
+
+                if (! dstIsInput || dstDelay > 0)
+                    FloatVectorOperations::clear (dstBuffer, c.numSamples);
+
+                for (size_t i = 0; i < sources.size(); ++i)
+                    if (sources[i].delay <= 0)
+                        FloatVectorOperations::add (dstBuffer, sourceBuffers[i], c.numSamples);
+
+                if (! ring.empty())
+                    readFromRing (numSamples);
             }
 
-            FloatType* fromBuffer = nullptr;
-            FloatType* toBuffer = nullptr;
-            int from = 0, to = 0;
+            void addToRing (const FloatType* source, int delay, size_t numSamples)
+            {
+                const auto mask = ring.size() - 1;
+                const auto start = (position + (size_t) delay) & mask;
+                const auto firstRun = jmin (numSamples, ring.size() - start);
+
+                FloatVectorOperations::add (ring.data() + start, source, (int) firstRun);
+                FloatVectorOperations::add (ring.data(), source + firstRun, (int) (numSamples - firstRun));
+            }
+
+            void readFromRing (size_t numSamples)
+            {
+                const auto firstRun = jmin (numSamples, ring.size() - position);
+                const auto secondRun = numSamples - firstRun;
+
+                FloatVectorOperations::add (dstBuffer, ring.data() + position, (int) firstRun);
+                FloatVectorOperations::clear (ring.data() + position, (int) firstRun);
+                FloatVectorOperations::add (dstBuffer + firstRun, ring.data(), (int) secondRun);
+                FloatVectorOperations::clear (ring.data(), (int) secondRun);
+
+                position = (position + numSamples) & (ring.size() - 1);
+            }
+
+            const int dstIndex, dstDelay;
+            const bool dstIsInput;
+            const std::vector<ChannelToSum> sources;
+            std::vector<FloatType*> sourceBuffers;
+            FloatType* dstBuffer = nullptr;
+
+            std::vector<FloatType> ring;
+            size_t position = 0;
+            int maxBlockSize = 0;
         };
 
-        renderOps.push_back (std::make_unique<AddOp> (srcIndex, dstIndex));
+        std::vector<Resource> reads;
+
+        for (const auto& source : sources)
+            reads.push_back (audioResource (source.index));
+
+        if (dstIsInput)
+            reads.push_back (audioResource (dstIndex));
+
+        addOp (std::make_unique<SumOp> (dstIndex, dstIsInput, dstDelay, std::move (sources)), std::move (reads), { audioResource (dstIndex) });
     }
 
     JUCE_END_IGNORE_WARNINGS_MSVC
@@ -648,7 +1340,7 @@ struct GraphRenderSequence
         {
             explicit ClearOp (int indexIn) : index (indexIn) {}
 
-            void prepare (FloatType* const*, MidiBuffer* buffers) override
+            void prepare (FloatType* const*, MidiBuffer* buffers, int) override
             {
                 channelBuffer = buffers + index;
             }
@@ -662,7 +1354,7 @@ struct GraphRenderSequence
             int index = 0;
         };
 
-        renderOps.push_back (std::make_unique<ClearOp> (index));
+        addOp (std::make_unique<ClearOp> (index), {}, { midiResource (index) });
     }
 
     void addCopyMidiBufferOp (int srcIndex, int dstIndex)
@@ -671,7 +1363,7 @@ struct GraphRenderSequence
         {
             explicit CopyOp (int fromIn, int toIn) : from (fromIn), to (toIn) {}
 
-            void prepare (FloatType* const*, MidiBuffer* buffers) override
+            void prepare (FloatType* const*, MidiBuffer* buffers, int) override
             {
                 fromBuffer = buffers + from;
                 toBuffer = buffers + to;
@@ -687,7 +1379,7 @@ struct GraphRenderSequence
             int from = 0, to = 0;
         };
 
-        renderOps.push_back (std::make_unique<CopyOp> (srcIndex, dstIndex));
+        addOp (std::make_unique<CopyOp> (srcIndex, dstIndex), { midiResource (srcIndex) }, { midiResource (dstIndex) });
     }
 
     void addAddMidiBufferOp (int srcIndex, int dstIndex)
@@ -696,7 +1388,7 @@ struct GraphRenderSequence
         {
             explicit AddOp (int fromIn, int toIn) : from (fromIn), to (toIn) {}
 
-            void prepare (FloatType* const*, MidiBuffer* buffers) override
+            void prepare (FloatType* const*, MidiBuffer* buffers, int) override
             {
                 fromBuffer = buffers + from;
                 toBuffer = buffers + to;
@@ -712,21 +1404,24 @@ struct GraphRenderSequence
             int from = 0, to = 0;
         };
 
-        renderOps.push_back (std::make_unique<AddOp> (srcIndex, dstIndex));
+        addOp (std::make_unique<AddOp> (srcIndex, dstIndex), { midiResource (srcIndex) }, { midiResource (dstIndex) });
     }
 
     void addDelayChannelOp (int chan, int delaySize)
     {
+        /*  The delay line holds exactly delaySize samples. Swapping a run of incoming
+            samples with the oldest run in the line outputs those old samples and stores
+            the new ones in their place, which the compiler can vectorise.
+        */
         struct DelayChannelOp final : public RenderOp
         {
             DelayChannelOp (int chan, int delaySize)
-                : buffer ((size_t) (delaySize + 1), (FloatType) 0),
-                  channel (chan),
-                  writeIndex (delaySize)
+                : buffer ((size_t) delaySize, (FloatType) 0),
+                  channel (chan)
             {
             }
 
-            void prepare (FloatType* const* renderBuffer, MidiBuffer*) override
+            void prepare (FloatType* const* renderBuffer, MidiBuffer*, int) override
             {
                 channelBuffer = renderBuffer[channel];
             }
@@ -735,23 +1430,24 @@ struct GraphRenderSequence
             {
                 auto* data = channelBuffer;
 
-                for (int i = c.numSamples; --i >= 0;)
+                for (auto remaining = (size_t) c.numSamples; remaining > 0;)
                 {
-                    buffer[(size_t) writeIndex] = *data;
-                    *data++ = buffer[(size_t) readIndex];
+                    const auto num = jmin (remaining, buffer.size() - position);
+                    std::swap_ranges (data, data + num, buffer.data() + position);
 
-                    if (++readIndex  >= (int) buffer.size()) readIndex = 0;
-                    if (++writeIndex >= (int) buffer.size()) writeIndex = 0;
+                    data += num;
+                    remaining -= num;
+                    position = (position + num) % buffer.size();
                 }
             }
 
             std::vector<FloatType> buffer;
             FloatType* channelBuffer = nullptr;
             const int channel;
-            int readIndex = 0, writeIndex;
+            size_t position = 0;
         };
 
-        renderOps.push_back (std::make_unique<DelayChannelOp> (chan, delaySize));
+        addOp (std::make_unique<DelayChannelOp> (chan, delaySize), { audioResource (chan) }, { audioResource (chan) });
     }
 
     void addProcessOp (const Node::Ptr& node,
@@ -759,6 +1455,20 @@ struct GraphRenderSequence
                        int totalNumChans,
                        int midiBuffer)
     {
+        std::vector<Resource> reads, writes;
+
+        for (const auto index : audioChannelsUsed)
+        {
+            reads.push_back (audioResource (index));
+
+            // The first buffer is shared, read-only silence
+            if (index != 0)
+                writes.push_back (audioResource (index));
+        }
+
+        reads .push_back (midiResource (midiBuffer));
+        writes.push_back (midiResource (midiBuffer));
+
         auto op = [&]() -> std::unique_ptr<NodeOp>
         {
             if (auto* ioNode = dynamic_cast<const AudioProcessorGraph::AudioGraphIOProcessor*> (node->getProcessor()))
@@ -769,20 +1479,90 @@ struct GraphRenderSequence
                         return std::make_unique<AudioInOp> (node, audioChannelsUsed, totalNumChans, midiBuffer);
 
                     case AudioProcessorGraph::AudioGraphIOProcessor::audioOutputNode:
+                        writes.push_back ({ Resource::Kind::globalAudioOut, 0 });
                         return std::make_unique<AudioOutOp> (node, audioChannelsUsed, totalNumChans, midiBuffer);
 
                     case AudioProcessorGraph::AudioGraphIOProcessor::midiInputNode:
                         return std::make_unique<MidiInOp> (node, audioChannelsUsed, totalNumChans, midiBuffer);
 
-                    case AudioProcessorGraph::AudioGraphIOProcessor::midiOutputNode:
-                        return std::make_unique<MidiOutOp> (node, audioChannelsUsed, totalNumChans, midiBuffer);
-                }
-            }
+                    case AudioProcessorGraph::AudioGraphIOProcessor::midiOutputNode:
+                        writes.push_back ({ Resource::Kind::globalMidiOut, 0 });
+                        return std::make_unique<MidiOutOp> (node, audioChannelsUsed, totalNumChans, midiBuffer);
+                }
+            }
+
+            return std::make_unique<ProcessOp> (node, audioChannelsUsed, totalNumChans, midiBuffer);
+        }();
+
+        addOp (std::move (op), std::move (reads), std::move (writes));
+
+        // Each node's process op ends a task, which also contains the ops that gathered its inputs
+        tasks.push_back ({ firstOpInCurrentTask, renderOps.size(), std::move (currentTaskReads), std::move (currentTaskWrites), {}, 0 });
+        firstOpInCurrentTask = renderOps.size();
+        currentTaskReads.clear();
+        currentTaskWrites.clear();
+    }
+
+    /*  Works out which tasks must wait for which others, so that running them concurrently gives
+        exactly the same result as running the ops in order: a task depends on the last earlier
+        task that wrote any buffer it touches, and on any earlier readers of the buffers it writes.
+    */
+    void createTaskGraph()
+    {
+        jassert (firstOpInCurrentTask == renderOps.size());
+
+        std::map<Resource, size_t> lastWriters;
+        std::map<Resource, std::vector<size_t>> readersSinceLastWrite;
+
+        for (size_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex)
+        {
+            auto& task = tasks[taskIndex];
+            std::set<size_t> dependencies;
+
+            for (const auto& r : task.reads)
+            {
+                if (const auto writer = lastWriters.find (r); writer != lastWriters.end())
+                    dependencies.insert (writer->second);
+
+                readersSinceLastWrite[r].push_back (taskIndex);
+            }
+
+            for (const auto& w : task.writes)
+            {
+                if (const auto writer = lastWriters.find (w); writer != lastWriters.end())
+                    dependencies.insert (writer->second);
+
+                auto& readers = readersSinceLastWrite[w];
+                dependencies.insert (readers.begin(), readers.end());
+                readers.clear();
+
+                lastWriters[w] = taskIndex;
+            }
+
+            dependencies.erase (taskIndex);
+
+            for (const auto d : dependencies)
+                tasks[d].successors.push_back (taskIndex);
+
+            task.numDependencies = (int) dependencies.size();
+        }
+
+        for (auto& task : tasks)
+        {
+            task.reads  = {};
+            task.writes = {};
+        }
 
-            return std::make_unique<ProcessOp> (node, audioChannelsUsed, totalNumChans, midiBuffer);
-        }();
+        if (tasks.size() > 1)
+            scheduler = std::make_unique<TaskScheduler> (std::move (tasks));
 
-        renderOps.push_back (std::move (op));
+        tasks = {};
+    }
+
+    /*  If a thread pool is supplied, independent tasks will be run concurrently on it. */
+    void setThreadPool (RenderThreadPool* pool)
+    {
+        threadPool = pool;
     }
 
     void prepareBuffers (int blockSize)
@@ -805,7 +1585,7 @@ struct GraphRenderSequence
             m.ensureSize (defaultMIDIBufferSize);
 
         for (const auto& op : renderOps)
-            op->prepare (renderingBuffer.getArrayOfWritePointers(), midiBuffers.data());
+            op->prepare (renderingBuffer.getArrayOfWritePointers(), midiBuffers.data(), blockSize);
     }
 
     int numBuffersNeeded = 0, numMidiBuffersNeeded = 0;
@@ -822,7 +1602,10 @@ private:
     struct RenderOp
     {
         virtual ~RenderOp() = default;
-        virtual void prepare (FloatType* const*, MidiBuffer*) = 0;
+        /*  Called on the main thread before the sequence is used, with the largest number of
+            samples that will be passed to process().
+        */
+        virtual void prepare (FloatType* const*, MidiBuffer*, int maxNumSamples) = 0;
         virtual void process (const Context&) = 0;
     };
 
@@ -842,7 +1625,7 @@ private:
                 audioChannelsToUse.add (0);
         }
 
-        void prepare (FloatType* const* renderBuffer, MidiBuffer* buffers) final
+        void prepare (FloatType* const* renderBuffer, MidiBuffer* buffers, int) final
         {
             for (size_t i = 0; i < audioChannels.size(); ++i)
                 audioChannels[i] = renderBuffer[audioChannelsToUse.getUnchecked ((int) i)];
@@ -872,7 +1655,16 @@ private:
             else
             {
                 const auto bypass = node->isBypassed() && processor.getBypassParameter() == nullptr;
+
+                if (c.profiler == nullptr)
+                {
+                    processWithBuffer (c.globalIO, bypass, buffer, *midiBuffer);
+                    return;
+                }
+
+                const auto startTicks = Time::getHighResolutionTicks();
                 processWithBuffer (c.globalIO, bypass, buffer, *midiBuffer);
+                c.profiler->record (node->nodeID, Time::getHighResolutionTicks() - startTicks);
             }
         }
 
@@ -986,7 +1778,170 @@ private:
         }
     };
 
+    /*  Identifies something that a RenderOp reads or writes. */
+    struct Resource
+    {
+        enum class Kind { audio, midi, globalAudioOut, globalMidiOut };
+
+        Kind kind;
+        int index;
+
+        auto tie() const noexcept { return std::tie (kind, index); }
+        bool operator< (const Resource& other) const noexcept { return tie() < other.tie(); }
+    };
+
+    static Resource audioResource (int index) noexcept   { return { Resource::Kind::audio, index }; }
+    static Resource midiResource  (int index) noexcept   { return { Resource::Kind::midi,  index }; }
+
+    /*  A run of consecutive ops, ending with a node's process op. */
+    struct Task
+    {
+        size_t firstOp = 0, endOp = 0;
+        std::vector<Resource> reads, writes;
+        std::vector<size_t> successors;
+        int numDependencies = 0;
+    };
+
+    void addOp (std::unique_ptr<RenderOp> op, std::vector<Resource> reads, std::vector<Resource> writes)
+    {
+        renderOps.push_back (std::move (op));
+        currentTaskReads .insert (currentTaskReads .end(), reads .begin(), reads .end());
+        currentTaskWrites.insert (currentTaskWrites.end(), writes.begin(), writes.end());
+    }
+
+    //==============================================================================
+    /*  Runs the tasks of a sequence on a RenderThreadPool, starting each one as soon as all of
+        the tasks it depends on have finished.
+
+        Ready tasks go into a shared lock-free queue. Every task is queued exactly once per
+        block, so the queue is just an array with one slot per task and never wraps around.
+        A thread that finishes a task carries straight on with one of the tasks it unblocked,
+        and only queues the others for idle threads to pick up.
+    */
+    class TaskScheduler final : public RenderThreadPool::Job
+    {
+    public:
+        explicit TaskScheduler (std::vector<Task> t)
+            : tasks (std::move (t)),
+              pendingDependencies (tasks.size()),
+              readyTasks (tasks.size())
+        {
+        }
+
+        /*  Call from the audio thread only. */
+        void perform (RenderThreadPool& pool, const std::vector<std::unique_ptr<RenderOp>>& opsToRun, const Context& c)
+        {
+            ops = &opsToRun;
+            context = &c;
+
+            for (size_t i = 0; i < tasks.size(); ++i)
+            {
+                pendingDependencies[i].store (tasks[i].numDependencies, std::memory_order_relaxed);
+                readyTasks[i].store (-1, std::memory_order_relaxed);
+            }
+
+            numQueued.store (0, std::memory_order_relaxed);
+            nextToTake.store (0, std::memory_order_relaxed);
+            numTasksRemaining.store ((int) tasks.size(), std::memory_order_relaxed);
+
+            for (size_t i = 0; i < tasks.size(); ++i)
+                if (tasks[i].numDependencies == 0)
+                    queueTask (i);
+
+            pool.run (*this, (int) tasks.size() - 1);
+        }
+
+        void contribute (bool isAudioThread) override
+        {
+            // Workers give up after a while without finding anything to do, so that they
+            // don't compete for CPU with the threads that are still busy
+            constexpr auto maxIdleSpins = 20000;
+
+            for (auto idleSpins = 0; numTasksRemaining.load (std::memory_order_acquire) > 0;)
+            {
+                const auto task = takeReadyTask();
+
+                if (task >= 0)
+                {
+                    runTasksFrom ((size_t) task);
+                    idleSpins = 0;
+                }
+                else if (! isAudioThread && ++idleSpins > maxIdleSpins)
+                {
+                    return;
+                }
+            }
+        }
+
+    private:
+        void queueTask (size_t task) noexcept
+        {
+            const auto slot = numQueued.fetch_add (1, std::memory_order_acq_rel);
+            readyTasks[(size_t) slot].store ((int) task, std::memory_order_release);
+        }
+
+        int takeReadyTask() noexcept
+        {
+            auto slot = nextToTake.load (std::memory_order_acquire);
+
+            while (slot < numQueued.load (std::memory_order_acquire))
+            {
+                const auto task = readyTasks[(size_t) slot].load (std::memory_order_acquire);
+
+                // The slot has been claimed, but the task hasn't been written yet
+                if (task < 0)
+                    return -1;
+
+                if (nextToTake.compare_exchange_weak (slot, slot + 1, std::memory_order_acq_rel))
+                    return task;
+            }
+
+            return -1;
+        }
+
+        void runTasksFrom (size_t first) noexcept
+        {
+            for (auto current = (int) first; current >= 0;)
+            {
+                const auto& task = tasks[(size_t) current];
+
+                for (auto i = task.firstOp; i < task.endOp; ++i)
+                    (*ops)[i]->process (*context);
+
+                auto next = -1;
+
+                for (const auto successor : task.successors)
+                {
+                    if (pendingDependencies[successor].fetch_sub (1, std::memory_order_acq_rel) == 1)
+                    {
+                        if (next < 0)
+                            next = (int) successor;
+                        else
+                            queueTask (successor);
+                    }
+                }
+
+                numTasksRemaining.fetch_sub (1, std::memory_order_release);
+                current = next;
+            }
+        }
+
+        const std::vector<Task> tasks;
+        const std::vector<std::unique_ptr<RenderOp>>* ops = nullptr;
+        const Context* context = nullptr;
+
+        std::vector<std::atomic<int>> pendingDependencies, readyTasks;
+        std::atomic<int> numQueued { 0 }, nextToTake { 0 }, numTasksRemaining { 0 };
+    };
+
     std::vector<std::unique_ptr<RenderOp>> renderOps;
+
+    std::vector<Task> tasks;
+    size_t firstOpInCurrentTask = 0;
+    std::vector<Resource> currentTaskReads, currentTaskWrites;
+
+    std::unique_ptr<TaskScheduler> scheduler;
+    RenderThreadPool* threadPool = nullptr;
 };
 
 //==============================================================================
@@ -1010,17 +1965,24 @@ public:
 
     static constexpr auto midiChannelIndex = AudioProcessorGraph::midiChannelIndex;
 
+    /*  When rendering in parallel, buffers are never reused once they're free, so that the only
+        dependencies between the resulting tasks are the connections in the graph.
+    */
     template <typename FloatType>
-    static SequenceAndLatency build (const Nodes& n, const Connections& c)
+    static SequenceAndLatency build (const Nodes& n,
+                                     const Connections& c,
+                                     const NodeOrdering& ordering,
+                                     bool reuseFreedBuffers)
     {
         GraphRenderSequence<FloatType> sequence;
-        const RenderSequenceBuilder builder (n, c, sequence);
+        const RenderSequenceBuilder builder (n, c, ordering, sequence, reuseFreedBuffers);
         return { std::move (sequence), builder.totalLatency };
     }
 
 private:
     //==============================================================================
     const Array<Node*> orderedNodes;
+    const bool reuseFreedBuffers;
 
     struct AssignedBuffer
     {
@@ -1049,6 +2011,9 @@ private:
     std::unordered_map<uint32, int> delays;
     int totalLatency = 0;
 
+    // The last rendering step at which each output is read
+    std::map<NodeAndChannel, int> lastUses;
+
     int getNodeDelay (NodeID nodeID) const noexcept
     {
         const auto iter = delays.find (nodeID.uid);
@@ -1090,6 +2055,7 @@ private:
         }
     }
 
+    /*  Used when the graph contains a feedback loop, so the nodes can't be sorted topologically. */
     Array<Node*> createOrderedNodeList (const Nodes& n, const Connections& c)
     {
         Array<Node*> result;
@@ -1174,91 +2140,46 @@ private:
             return bufIndex;
         }
 
-        // Handle a mix of several outputs coming into this input..
-        int reusableInputIndex = -1;
-        int bufIndex = -1;
+        // Handle a mix of several outputs coming into this input. The sources are summed and
+        // delay-compensated in a single op, which only reads from them, so sources that are
+        // needed later don't have to be copied before being delayed..
+        std::vector<typename RenderSequence::ChannelToSum> channelsToSum;
+        int bufIndex = -1, bufDelay = 0;
 
+        for (const auto& src : sources)
         {
-            auto i = 0;
-            for (const auto& src : sources)
-            {
-                auto sourceBufIndex = getBufferContaining (src);
-
-                if (sourceBufIndex >= 0 && ! isBufferNeededLater (reversed, ourRenderingIndex, inputChan, src))
-                {
-                    // we've found one of our input chans that can be re-used..
-                    reusableInputIndex = i;
-                    bufIndex = sourceBufIndex;
+            const auto srcIndex = getBufferContaining (src);
 
-                    auto nodeDelay = getNodeDelay (src.nodeID);
-
-                    if (nodeDelay < maxLatency)
-                        sequence.addDelayChannelOp (bufIndex, maxLatency - nodeDelay);
+            // if not found, this is probably a feedback loop
+            if (srcIndex < 0)
+                continue;
 
-                    break;
-                }
+            const auto delay = jmax (0, maxLatency - getNodeDelay (src.nodeID));
 
-                ++i;
+            if (bufIndex < 0 && ! isBufferNeededLater (reversed, ourRenderingIndex, inputChan, src))
+            {
+                // we've found one of our input chans that can be re-used..
+                bufIndex = srcIndex;
+                bufDelay = delay;
+            }
+            else
+            {
+                channelsToSum.push_back ({ srcIndex, delay });
             }
         }
 
-        if (reusableInputIndex < 0)
+        const auto reusesInput = bufIndex >= 0;
+
+        if (! reusesInput)
         {
-            // can't re-use any of our input chans, so get a new one and copy everything into it..
+            // can't re-use any of our input chans, so get a new one to mix everything into..
             bufIndex = getFreeBuffer (audioBuffers);
             jassert (bufIndex != 0);
 
             audioBuffers.getReference (bufIndex).setAssignedToNonExistentNode();
-
-            auto srcIndex = getBufferContaining (*sources.begin());
-
-            if (srcIndex < 0)
-                sequence.addClearChannelOp (bufIndex);  // if not found, this is probably a feedback loop
-            else
-                sequence.addCopyChannelOp (srcIndex, bufIndex);
-
-            reusableInputIndex = 0;
-            auto nodeDelay = getNodeDelay (sources.begin()->nodeID);
-
-            if (nodeDelay < maxLatency)
-                sequence.addDelayChannelOp (bufIndex, maxLatency - nodeDelay);
-        }
-
-        {
-            auto i = 0;
-            for (const auto& src : sources)
-            {
-                if (i != reusableInputIndex)
-                {
-                    int srcIndex = getBufferContaining (src);
-
-                    if (srcIndex >= 0)
-                    {
-                        auto nodeDelay = getNodeDelay (src.nodeID);
-
-                        if (nodeDelay < maxLatency)
-                        {
-                            if (! isBufferNeededLater (reversed, ourRenderingIndex, inputChan, src))
-                            {
-                                sequence.addDelayChannelOp (srcIndex, maxLatency - nodeDelay);
-                            }
-                            else // buffer is reused elsewhere, can't be delayed
-                            {
-                                auto bufferToDelay = getFreeBuffer (audioBuffers);
-                                sequence.addCopyChannelOp (srcIndex, bufferToDelay);
-                                sequence.addDelayChannelOp (bufferToDelay, maxLatency - nodeDelay);
-                                srcIndex = bufferToDelay;
-                            }
-                        }
-
-                        sequence.addAddChannelOp (srcIndex, bufIndex);
-                    }
-                }
-
-                ++i;
-            }
         }
 
+        sequence.addSumChannelsOp (bufIndex, reusesInput, bufDelay, std::move (channelsToSum));
         return bufIndex;
     }
 
@@ -1424,11 +2345,12 @@ private:
     }
 
     //==============================================================================
-    static int getFreeBuffer (Array<AssignedBuffer>& buffers)
+    int getFreeBuffer (Array<AssignedBuffer>& buffers) const
     {
-        for (int i = 1; i < buffers.size(); ++i)
-            if (buffers.getReference (i).isFree())
-                return i;
+        if (reuseFreedBuffers)
+            for (int i = 1; i < buffers.size(); ++i)
+                if (buffers.getReference (i).isFree())
+                    return i;
 
         buffers.add (AssignedBuffer::createFree());
         return buffers.size() - 1;
@@ -1449,15 +2371,19 @@ private:
         return -1;
     }
 
-    void markAnyUnusedBuffersAsFree (const Connections::DestinationsForSources& c,
-                                     Array<AssignedBuffer>& buffers,
-                                     const int stepIndex)
+    void markAnyUnusedBuffersAsFree (Array<AssignedBuffer>& buffers, const int stepIndex)
     {
         for (auto& b : buffers)
-            if (b.isAssigned() && ! isBufferNeededLater (c, stepIndex, -1, b.channel))
+            if (b.isAssigned() && getLastUse (b.channel) < stepIndex)
                 b.setFree();
     }
 
+    int getLastUse (NodeAndChannel output) const
+    {
+        const auto iter = lastUses.find (output);
+        return iter != lastUses.end() ? iter->second : -1;
+    }
+
     bool isBufferNeededLater (const Connections::DestinationsForSources& c,
                               const int stepIndexToSearchFrom,
                               const int inputChannelOfIndexToIgnore,
@@ -1473,30 +2399,54 @@ private:
             return true;
         }
 
-        return std::any_of (orderedNodes.begin() + stepIndexToSearchFrom + 1, orderedNodes.end(), [&] (const auto* node)
+        return stepIndexToSearchFrom < getLastUse (output);
+    }
+
+    void findLastUses (const Connections& c)
+    {
+        std::unordered_map<uint32, int> steps;
+
+        for (int i = 0; i < orderedNodes.size(); ++i)
+            steps[orderedNodes.getUnchecked (i)->nodeID.uid] = i;
+
+        for (const auto& connection : c.getConnections())
         {
-            return c.isSourceConnectedToDestinationNodeIgnoringChannel (output, node->nodeID, -1);
-        });
+            const auto step = steps.find (connection.destination.nodeID.uid);
+
+            if (step == steps.end())
+                continue;
+
+            auto& lastUse = lastUses.emplace (connection.source, step->second).first->second;
+            lastUse = jmax (lastUse, step->second);
+        }
     }
 
     template <typename RenderSequence>
-    RenderSequenceBuilder (const Nodes& n, const Connections& c, RenderSequence& sequence)
-        : orderedNodes (createOrderedNodeList (n, c))
+    RenderSequenceBuilder (const Nodes& n,
+                           const Connections& c,
+                           const NodeOrdering& ordering,
+                           RenderSequence& sequence,
+                           bool reuseBuffers)
+        : orderedNodes (ordering.isValid() ? ordering.getOrderedNodes (n) : createOrderedNodeList (n, c)),
+          reuseFreedBuffers (reuseBuffers)
     {
         audioBuffers.add (AssignedBuffer::createReadOnlyEmpty()); // first buffer is read-only zeros
         midiBuffers .add (AssignedBuffer::createReadOnlyEmpty());
 
+        findLastUses (c);
+
         const auto reversed = c.getDestinationsForSources();
 
         for (int i = 0; i < orderedNodes.size(); ++i)
         {
             createRenderingOpsForNode (c, reversed, sequence, *orderedNodes.getUnchecked (i), i);
-            markAnyUnusedBuffersAsFree (reversed, audioBuffers, i);
-            markAnyUnusedBuffersAsFree (reversed, midiBuffers, i);
+            markAnyUnusedBuffersAsFree (audioBuffers, i);
+            markAnyUnusedBuffersAsFree (midiBuffers, i);
         }
 
         sequence.numBuffersNeeded = audioBuffers.size();
         sequence.numMidiBuffersNeeded = midiBuffers.size();
+        sequence.createTaskGraph();
     }
 };
 
@@ -1512,18 +2462,24 @@ class RenderSequence
 public:
     using AudioGraphIOProcessor = AudioProcessorGraph::AudioGraphIOProcessor;
 
-    RenderSequence (const PrepareSettings s, const Nodes& n, const Connections& c)
-        : RenderSequence (s, s.precision == AudioProcessor::ProcessingPrecision::singlePrecision
-                                ? RenderSequenceBuilder::build<float>  (n, c)
-                                : RenderSequenceBuilder::build<double> (n, c))
+    RenderSequence (const PrepareSettings s,
+                    const Nodes& n,
+                    const Connections& c,
+                    const NodeOrdering& ordering,
+                    std::shared_ptr<RenderThreadPool> pool)
+        : RenderSequence (s,
+                          s.precision == AudioProcessor::ProcessingPrecision::singlePrecision
+                              ? RenderSequenceBuilder::build<float>  (n, c, ordering, pool == nullptr)
+                              : RenderSequenceBuilder::build<double> (n, c, ordering, pool == nullptr),
+                          std::move (pool))
     {
     }
 
     template <typename FloatType>
-    void process (AudioBuffer<FloatType>& audio, MidiBuffer& midi, AudioPlayHead* playHead)
+    void process (AudioBuffer<FloatType>& audio, MidiBuffer& midi, AudioPlayHead* playHead, NodeProfiler* profiler)
     {
         if (auto* s = std::get_if<GraphRenderSequence<FloatType>> (&sequence.sequence))
-            s->perform (audio, midi, playHead);
+            s->perform (audio, midi, playHead, profiler);
         else
             jassertfalse; // Not prepared for this audio format!
     }
@@ -1531,6 +2487,12 @@ public:
     int getLatencySamples() const { return sequence.latencySamples; }
     PrepareSettings getSettings() const { return settings; }
 
+    void setWorkgroup (const AudioWorkgroup& workgroup)
+    {
+        if (threadPool != nullptr)
+            threadPool->setWorkgroup (workgroup);
+    }
+
 private:
     template <typename This, typename Callback>
     static void visitRenderSequence (This& t, Callback&& callback)
@@ -1540,14 +2502,19 @@ private:
         jassertfalse;
     }
 
-    RenderSequence (const PrepareSettings s, SequenceAndLatency&& built)
-        : settings (s), sequence (std::move (built))
+    RenderSequence (const PrepareSettings s, SequenceAndLatency&& built, std::shared_ptr<RenderThreadPool> pool)
+        : settings (s), sequence (std::move (built)), threadPool (std::move (pool))
     {
-        visitRenderSequence (*this, [&] (auto& seq) { seq.prepareBuffers (settings.blockSize); });
+        visitRenderSequence (*this, [&] (auto& seq)
+        {
+            seq.prepareBuffers (settings.blockSize);
+            seq.setThreadPool (threadPool.get());
+        });
     }
 
     PrepareSettings settings;
     SequenceAndLatency sequence;
+    std::shared_ptr<RenderThreadPool> threadPool;
 };
 
 //==============================================================================
@@ -1615,56 +2582,158 @@ private:
     Topology updates always happen on the main thread (or synchronised with the main thread).
     After updating the graph, the 'baked' graph is passed to RenderSequenceExchange::set.
     At the top of the audio callback, RenderSequenceExchange::updateAudioThreadState will
-    attempt to install the most-recently-baked graph, if there's one waiting.
+    install the most-recently-baked graph, if there's one waiting.
+
+    This works like a triple buffer: the audio thread owns the sequence it's rendering, the main
+    thread owns any sequence it's building, and the two threads trade sequences through a single
+    atomic slot. The low bit of the slot marks a sequence that the audio thread hasn't seen yet.
+    Neither thread ever waits for the other, and the audio thread never deletes anything: when it
+    installs a new sequence it leaves the old one in the slot, and it's deleted by the next call
+    to set() or collectGarbage(). At most one retired sequence is ever kept alive.
+
+    The retired sequence may be the last thing keeping removed nodes alive, so after each set()
+    a timer calls collectGarbage() until the slot is empty again. The timer gives up if the
+    audio thread stops processing before it picks up the new sequence, and the retired one is
+    then deleted by the next set() or collectGarbage() instead. All of these calls happen on
+    the message thread, so nodes are never deleted anywhere else. Without a message loop the
+    timer can't run, so headless hosts need to call collectGarbage() themselves, through
+    AudioProcessorGraph::releaseRetiredRenderSequence().
 */
 class RenderSequenceExchange final : private Timer
 {
 public:
-    RenderSequenceExchange()
-    {
-        startTimer (500);
-    }
+    using Statistics = AudioProcessorGraph::RenderSequenceStatistics;
+
+    RenderSequenceExchange() = default;
 
     ~RenderSequenceExchange() override
     {
         stopTimer();
+        delete getSequence (slot.exchange (0));
+        delete audioThreadState;
     }
 
     void set (std::unique_ptr<RenderSequence>&& next)
     {
-        const SpinLock::ScopedLockType lock (mutex);
-        mainThreadState = std::move (next);
-        isNew = true;
+        if (next != nullptr)
+            numBuilt.fetch_add (1, std::memory_order_relaxed);
+
+        publishTime.store (Time::getHighResolutionTicks(), std::memory_order_relaxed);
+        const auto previous = slot.exchange (pack (next.release(), true), std::memory_order_acq_rel);
+
+        // Whatever was in the slot is either a sequence that the audio thread never picked up,
+        // or one that it has finished with
+        dispose (previous);
+
+        if (MessageManager::getInstanceWithoutCreating() != nullptr && ! isTimerRunning())
+        {
+            lastNumAudioCallbacks = numAudioCallbacks.load (std::memory_order_relaxed);
+            startTimer (reclaimIntervalMs);
+        }
+    }
+
+    /*  Deletes the last sequence used by the audio thread, if it has been replaced. */
+    void collectGarbage()
+    {
+        auto current = slot.load (std::memory_order_acquire);
+
+        if (current != 0 && ! isNew (current) && slot.compare_exchange_strong (current, 0, std::memory_order_acq_rel))
+            dispose (current);
     }
 
     /*  Call from the audio thread only. */
     void updateAudioThreadState()
     {
-        const SpinLock::ScopedTryLockType lock (mutex);
+        numAudioCallbacks.fetch_add (1, std::memory_order_relaxed);
 
-        if (lock.isLocked() && isNew)
-        {
-            // Swap pointers rather than assigning to avoid calling delete here
-            std::swap (mainThreadState, audioThreadState);
-            isNew = false;
-        }
+        if (! isNew (slot.load (std::memory_order_acquire)))
+            return;
+
+        const auto publishedAt = publishTime.load (std::memory_order_relaxed);
+
+        // Only the main thread can change the slot now, and it will only ever store new sequences
+        const auto next = slot.exchange (pack (audioThreadState, false), std::memory_order_acq_rel);
+        jassert (isNew (next));
+
+        audioThreadState = getSequence (next);
+
+        if (audioThreadState == nullptr)
+            return;
+
+        const auto latency = jmax ((int64) 0, Time::getHighResolutionTicks() - publishedAt);
+        lastSwapLatency.store (latency, std::memory_order_relaxed);
+
+        if (maxSwapLatency.load (std::memory_order_relaxed) < latency)
+            maxSwapLatency.store (latency, std::memory_order_relaxed);
+
+        numInstalled.fetch_add (1, std::memory_order_relaxed);
     }
 
     /*  Call from the audio thread only. */
-    RenderSequence* getAudioThreadState() const { return audioThreadState.get(); }
+    RenderSequence* getAudioThreadState() const { return audioThreadState; }
+
+    Statistics getStatistics() const
+    {
+        const auto current = slot.load (std::memory_order_acquire);
+
+        Statistics result;
+        result.numBuilt               = numBuilt    .load (std::memory_order_relaxed);
+        result.numInstalled           = numInstalled.load (std::memory_order_relaxed);
+        result.numRetired             = numRetired  .load (std::memory_order_relaxed);
+        result.numDiscarded           = numDiscarded.load (std::memory_order_relaxed);
+        result.numAwaitingDeletion    = (current != 0 && ! isNew (current)) ? 1 : 0;
+        result.lastSwapLatencySeconds = Time::highResolutionTicksToSeconds (lastSwapLatency.load (std::memory_order_relaxed));
+        result.maxSwapLatencySeconds  = Time::highResolutionTicksToSeconds (maxSwapLatency .load (std::memory_order_relaxed));
+        return result;
+    }
 
 private:
+    static constexpr uintptr_t newFlag = 1;
+    static constexpr int reclaimIntervalMs = 100;
+
     void timerCallback() override
     {
-        const SpinLock::ScopedLockType lock (mutex);
+        collectGarbage();
+
+        // Otherwise the audio thread still has a new sequence to pick up, and the one it's
+        // using now will need deleting after that. If it isn't processing at the moment
+        // there's no point waiting for it.
+        const auto callbacks = numAudioCallbacks.load (std::memory_order_relaxed);
+
+        if (slot.load (std::memory_order_acquire) == 0 || std::exchange (lastNumAudioCallbacks, callbacks) == callbacks)
+            stopTimer();
+    }
+
+    static uintptr_t pack (RenderSequence* sequence, bool isNewSequence)
+    {
+        const auto bits = reinterpret_cast<uintptr_t> (sequence);
+        jassert ((bits & newFlag) == 0);
+        return bits | (isNewSequence ? newFlag : 0);
+    }
+
+    static RenderSequence* getSequence (uintptr_t bits)   { return reinterpret_cast<RenderSequence*> (bits & ~newFlag); }
+    static bool isNew (uintptr_t bits)                     { return (bits & newFlag) != 0; }
+
+    void dispose (uintptr_t bits)
+    {
+        if (getSequence (bits) == nullptr)
+            return;
 
-        if (! isNew)
-            mainThreadState.reset();
+        (isNew (bits) ? numDiscarded : numRetired).fetch_add (1, std::memory_order_relaxed);
+        delete getSequence (bits);
     }
 
-    SpinLock mutex;
-    std::unique_ptr<RenderSequence> mainThreadState, audioThreadState;
-    bool isNew = false;
+    std::atomic<uintptr_t> slot { 0 };
+    RenderSequence* audioThreadState = nullptr;
+
+    std::atomic<uint32> numAudioCallbacks { 0 };
+    uint32 lastNumAudioCallbacks = 0;
+
+    std::atomic<int64> publishTime { 0 }, lastSwapLatency { 0 }, maxSwapLatency { 0 };
+    std::atomic<int64> numBuilt { 0 }, numInstalled { 0 }, numRetired { 0 }, numDiscarded { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (RenderSequenceExchange)
+    JUCE_DECLARE_NON_MOVEABLE (RenderSequenceExchange)
 };
 
 //==============================================================================
@@ -1710,6 +2779,7 @@ public:
 
         nodes = Nodes{};
         connections = Connections{};
+        ordering.clear();
         nodeStates.clear();
         topologyChanged (updateKind);
     }
@@ -1739,6 +2809,8 @@ public:
         if (lastNodeID < idToUse)
             lastNodeID = idToUse;
 
+        ordering.addNode (idToUse);
+
         setParentGraph (added->getProcessor());
 
         topologyChanged (updateKind);
@@ -1748,6 +2820,7 @@ public:
     Node::Ptr removeNode (NodeID nodeID, UpdateKind updateKind)
     {
         connections.disconnectNode (nodeID);
+        ordering.removeNode (nodeID);
         auto result = nodes.removeNode (nodeID);
         nodeStates.removeNode (nodeID);
         topologyChanged (updateKind);
@@ -1789,6 +2862,7 @@ public:
         if (! connections.addConnection (nodes, c))
             return false;
 
+        ordering.addConnection (c.source.nodeID, c.destination.nodeID);
         jassert (isConnected (c));
         topologyChanged (updateKind);
         return true;
@@ -1799,6 +2873,7 @@ public:
         if (! connections.removeConnection (c))
             return false;
 
+        ordering.removeConnection (c.source.nodeID, c.destination.nodeID);
         topologyChanged (updateKind);
         return true;
     }
@@ -1808,6 +2883,7 @@ public:
         if (! connections.disconnectNode (nodeID))
             return false;
 
+        ordering.disconnectNode (nodeID);
         topologyChanged (updateKind);
         return true;
     }
@@ -1820,6 +2896,10 @@ public:
     bool removeIllegalConnections (UpdateKind updateKind)
     {
         const auto result = connections.removeIllegalConnections (nodes);
+
+        if (result)
+            ordering.reset (nodes, connections);
+
         topologyChanged (updateKind);
         return result;
     }
@@ -1868,6 +2948,96 @@ public:
             n->getProcessor()->setNonRealtime (isProcessingNonRealtime);
     }
 
+    void beginBatchedUpdate()
+    {
+        ++batchDepth;
+    }
+
+    void endBatchedUpdate()
+    {
+        jassert (batchDepth > 0);
+
+        if (--batchDepth == 0)
+            rebuild (std::exchange (batchedUpdateKind, UpdateKind::none));
+    }
+
+    void setNumRenderThreads (int numThreads)
+    {
+        numThreads = jmax (0, numThreads);
+
+        if (numThreads == getNumRenderThreads())
+            return;
+
+        renderThreadPool = numThreads > 0 ? std::make_shared<RenderThreadPool> (numThreads, getWorkgroup())
+                                          : nullptr;
+
+        // The sequence must be rebuilt even though the graph itself hasn't changed
+        lastBuiltSequence.reset();
+        rebuild (UpdateKind::sync);
+    }
+
+    void setNodeProfilingEnabled (bool shouldBeEnabled)
+    {
+        if (shouldBeEnabled && profiler == nullptr)
+            profiler = std::make_unique<NodeProfiler>();
+
+        profilingEnabled.store (shouldBeEnabled, std::memory_order_release);
+    }
+
+    bool isNodeProfilingEnabled() const noexcept
+    {
+        return profilingEnabled.load (std::memory_order_relaxed);
+    }
+
+    std::vector<NodeTimings> getNodeTimings()
+    {
+        if (profiler == nullptr)
+            return {};
+
+        auto result = profiler->collect();
+
+        // Skip any nodes that have been removed since they were timed
+        result.erase (std::remove_if (result.begin(), result.end(), [this] (const auto& t) { return nodes.getNodeForId (t.nodeID) == nullptr; }),
+                      result.end());
+        return result;
+    }
+
+    void resetNodeTimings()
+    {
+        if (profiler != nullptr)
+            profiler->reset();
+    }
+
+    auto getRenderSequenceStatistics() const
+    {
+        return renderSequenceExchange.getStatistics();
+    }
+
+    void releaseRetiredRenderSequence()
+    {
+        // Removed nodes may be deleted here, so this must happen on the message thread
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        renderSequenceExchange.collectGarbage();
+    }
+
+    int getNumRenderThreads() const
+    {
+        return renderThreadPool != nullptr ? renderThreadPool->getNumThreads() : 0;
+    }
+
+    /*  Call from the audio thread only. */
+    void audioWorkgroupContextChanged (const AudioWorkgroup& newWorkgroup)
+    {
+        {
+            const SpinLock::ScopedLockType lock (workgroupLock);
+            workgroup = newWorkgroup;
+        }
+
+        if (auto* state = renderSequenceExchange.getAudioThreadState())
+            state->setWorkgroup (newWorkgroup);
+    }
+
     template <typename Value>
     void processBlock (AudioBuffer<Value>& audio, MidiBuffer& midi, AudioPlayHead* playHead)
     {
@@ -1890,7 +3060,7 @@ public:
         // Only process if the graph has the correct blockSize, sampleRate etc.
         if (state != nullptr && state->getSettings() == nodeStates.getLastRequestedSettings())
         {
-            state->process (audio, midi, playHead);
+            state->process (audio, midi, playHead, profilingEnabled.load (std::memory_order_acquire) ? profiler.get() : nullptr);
         }
         else
         {
@@ -1909,14 +3079,30 @@ private:
             ioProc->setParentGraph (owner);
     }
 
-    void topologyChanged (UpdateKind updateKind)
+    void topologyChanged (UpdateKind updateKind)
+    {
+        owner->sendChangeMessage();
+
+        if (batchDepth > 0)
+        {
+            // The enum is ordered from most to least urgent
+            batchedUpdateKind = jmin (batchedUpdateKind, updateKind);
+            return;
+        }
+
+        rebuild (updateKind);
+    }
+
+    AudioWorkgroup getWorkgroup() const
     {
-        owner->sendChangeMessage();
-        rebuild (updateKind);
+        const SpinLock::ScopedLockType lock (workgroupLock);
+        return workgroup;
     }
 
     void handleAsyncUpdate()
     {
+        renderSequenceExchange.collectGarbage();
+
         if (const auto newSettings = nodeStates.applySettings (nodes))
         {
             for (const auto node : nodes.getNodes())
@@ -1926,7 +3112,10 @@ private:
 
             if (std::exchange (lastBuiltSequence, newSignature) != newSignature)
             {
-                auto sequence = std::make_unique<RenderSequence> (*newSettings, nodes, connections);
+                if (! ordering.isValid())
+                    ordering.recalculate();
+
+                auto sequence = std::make_unique<RenderSequence> (*newSettings, nodes, connections, ordering, renderThreadPool);
                 owner->setLatencySamples (sequence->getLatencySamples());
                 renderSequenceExchange.set (std::move (sequence));
             }
@@ -1941,7 +3130,15 @@ private:
     AudioProcessorGraph* owner = nullptr;
     Nodes nodes;
     Connections connections;
+    NodeOrdering ordering;
     NodeStates nodeStates;
+    int batchDepth = 0;
+    UpdateKind batchedUpdateKind = UpdateKind::none;
+    std::unique_ptr<NodeProfiler> profiler;
+    std::atomic<bool> profilingEnabled { false };
+    mutable SpinLock workgroupLock;
+    AudioWorkgroup workgroup;
+    std::shared_ptr<RenderThreadPool> renderThreadPool;
     RenderSequenceExchange renderSequenceExchange;
     NodeID lastNodeID;
     std::optional<RenderSequenceSignature> lastBuiltSequence;
@@ -1994,6 +3191,19 @@ void AudioProcessorGraph::setNonRealtime (bool isProcessingNonRealtime) noexcept
     pimpl->setNonRealtime (isProcessingNonRealtime);
 }
 
+AudioProcessorGraph::ScopedBatchedUpdate::ScopedBatchedUpdate (AudioProcessorGraph& g) : graph (g)  { graph.pimpl->beginBatchedUpdate(); }
+AudioProcessorGraph::ScopedBatchedUpdate::~ScopedBatchedUpdate()                                            { graph.pimpl->endBatchedUpdate(); }
+
+void AudioProcessorGraph::setNumRenderThreads (int numThreads)                                              { return pimpl->setNumRenderThreads (numThreads); }
+void AudioProcessorGraph::setNodeProfilingEnabled (bool shouldBeEnabled)                                      { return pimpl->setNodeProfilingEnabled (shouldBeEnabled); }
+bool AudioProcessorGraph::isNodeProfilingEnabled() const noexcept                                           { return pimpl->isNodeProfilingEnabled(); }
+std::vector<AudioProcessorGraph::NodeTimings> AudioProcessorGraph::getNodeTimings()                         { return pimpl->getNodeTimings(); }
+void AudioProcessorGraph::resetNodeTimings()                                                                { return pimpl->resetNodeTimings(); }
+AudioProcessorGraph::RenderSequenceStatistics AudioProcessorGraph::getRenderSequenceStatistics() const          { return pimpl->getRenderSequenceStatistics(); }
+void AudioProcessorGraph::releaseRetiredRenderSequence()                                                    { return pimpl->releaseRetiredRenderSequence(); }
+int AudioProcessorGraph::getNumRenderThreads() const                                                        { return pimpl->getNumRenderThreads(); }
+void AudioProcessorGraph::audioWorkgroupContextChanged (const AudioWorkgroup& workgroup)                    { return pimpl->audioWorkgroupContextChanged (workgroup); }
+
 AudioProcessorGraph::Node::Ptr AudioProcessorGraph::removeNode (NodeID nodeID, UpdateKind updateKind)
 {
     return pimpl->removeNode (nodeID, updateKind);
@@ -2294,12 +3504,461 @@ public:
             // this graph, so we just want to make sure that we finish the test without timing out.
             logMessage ("render sequence built in " + String (duration) + " ms");
         }
+
+        beginTest ("parallel rendering produces the same output as serial rendering");
+        {
+            const auto serial = renderParallelChains (0);
+
+            for (const auto numThreads : { 1, 3, 7 })
+            {
+                const auto parallel = renderParallelChains (numThreads);
+
+                expect (parallel.audio.getNumChannels() == serial.audio.getNumChannels());
+                expect (parallel.audio.getNumSamples()  == serial.audio.getNumSamples());
+
+                for (auto channel = 0; channel < serial.audio.getNumChannels(); ++channel)
+                    expect (std::memcmp (parallel.audio.getReadPointer (channel),
+                                         serial.audio.getReadPointer (channel),
+                                         sizeof (float) * (size_t) serial.audio.getNumSamples()) == 0);
+
+                expect (parallel.midi == serial.midi);
+            }
+        }
+
+        beginTest ("batched edits only rebuild the graph once the batch ends");
+        {
+            AudioProcessorGraph graph;
+
+            const auto nodeA = graph.addNode (BasicProcessor::make (BasicProcessor::getStereoProperties(), MidiIn::no, MidiOut::no))->nodeID;
+            const auto nodeB = graph.addNode (BasicProcessor::make (BasicProcessor::getStereoProperties(), MidiIn::no, MidiOut::no))->nodeID;
+            const auto final = graph.addNode (BasicProcessor::make (BasicProcessor::getInputOnlyProperties(), MidiIn::no, MidiOut::no))->nodeID;
+
+            const auto nodeALatency = 100;
+            graph.getNodeForId (nodeA)->getProcessor()->setLatencySamples (nodeALatency);
+            graph.prepareToPlay (44100, 512);
+
+            expect (graph.getLatencySamples() == 0);
+
+            {
+                const AudioProcessorGraph::ScopedBatchedUpdate batch (graph);
+
+                {
+                    const AudioProcessorGraph::ScopedBatchedUpdate nested (graph);
+
+                    expect (graph.addConnection ({ { nodeA, 0 }, { nodeB, 0 } }));
+                    expect (graph.addConnection ({ { nodeB, 0 }, { final, 0 } }));
+                }
+
+                expect (graph.getLatencySamples() == 0);
+                expect (graph.addConnection ({ { nodeA, 1 }, { nodeB, 1 } }));
+                expect (graph.removeConnection ({ { nodeA, 1 }, { nodeB, 1 } }));
+                expect (graph.getLatencySamples() == 0);
+            }
+
+            expect (graph.getLatencySamples() == nodeALatency);
+
+            graph.getNodeForId (nodeB)->getProcessor()->setLatencySamples (50);
+            graph.rebuild();
+            expect (graph.getLatencySamples() == nodeALatency + 50);
+        }
+
+        beginTest ("retired render sequences are deleted once the audio thread has moved on");
+        {
+            AudioProcessorGraph graph;
+            graph.setPlayConfigDetails (2, 2, 44100.0, 64);
+
+            const auto nodeA = graph.addNode (BasicProcessor::make (BasicProcessor::getStereoProperties(), MidiIn::no, MidiOut::no))->nodeID;
+            const auto nodeB = graph.addNode (BasicProcessor::make (BasicProcessor::getStereoProperties(), MidiIn::no, MidiOut::no))->nodeID;
+
+            graph.prepareToPlay (44100.0, 64);
+
+            AudioBuffer<float> audio (2, 64);
+            MidiBuffer midi;
+
+            const auto render = [&]
+            {
+                graph.processBlock (audio, midi);
+                return graph.getRenderSequenceStatistics();
+            };
+
+            auto stats = render();
+            expectEquals (stats.numBuilt, (int64) 1);
+            expectEquals (stats.numInstalled, (int64) 1);
+            expectEquals (stats.numAwaitingDeletion, 0);
+
+            // Two rebuilds without rendering in between, so the first is never installed
+            graph.addConnection ({ { nodeA, 0 }, { nodeB, 0 } });
+            graph.addConnection ({ { nodeA, 1 }, { nodeB, 1 } });
+
+            stats = render();
+            expectEquals (stats.numBuilt, (int64) 3);
+            expectEquals (stats.numInstalled, (int64) 2);
+            expectEquals (stats.numDiscarded, (int64) 1);
+            expectEquals (stats.numRetired, (int64) 0);
+            expectEquals (stats.numAwaitingDeletion, 1);
+            expect (stats.lastSwapLatencySeconds <= stats.maxSwapLatencySeconds);
+
+            graph.releaseRetiredRenderSequence();
+            stats = graph.getRenderSequenceStatistics();
+            expectEquals (stats.numAwaitingDeletion, 0);
+            expectEquals (stats.numRetired, (int64) 1);
+
+            // The sequence that the audio thread is rendering keeps a removed node alive,
+            // but only until the audio thread has switched to a newer one
+            const AudioProcessorGraph::Node::Ptr removed = graph.getNodeForId (nodeB);
+            graph.removeNode (nodeB);
+            expect (removed->getReferenceCount() > 1);
+
+            stats = render();
+            expectEquals (stats.numAwaitingDeletion, 1);
+
+            graph.releaseRetiredRenderSequence();
+            stats = graph.getRenderSequenceStatistics();
+            expectEquals (stats.numAwaitingDeletion, 0);
+            expectEquals (stats.numRetired, (int64) 2);
+            expectEquals (removed->getReferenceCount(), 1);
+
+            // Nothing is deleted before the audio thread has picked up the newest sequence
+            const auto nodeC = graph.addNode (BasicProcessor::make (BasicProcessor::getStereoProperties(), MidiIn::no, MidiOut::no))->nodeID;
+            graph.addConnection ({ { nodeA, 0 }, { nodeC, 0 } });
+            graph.releaseRetiredRenderSequence();
+            expectEquals (graph.getRenderSequenceStatistics().numRetired, (int64) 2);
+
+            stats = render();
+            expectEquals (stats.numInstalled, (int64) 4);
+        }
+
+       #if JUCE_MODAL_LOOPS_PERMITTED
+        beginTest ("retired render sequences are deleted without further changes while the message loop runs");
+        {
+            AudioProcessorGraph graph;
+            graph.setPlayConfigDetails (2, 2, 44100.0, 64);
+
+            const auto nodeA = graph.addNode (BasicProcessor::make (BasicProcessor::getStereoProperties(), MidiIn::no, MidiOut::no))->nodeID;
+            graph.prepareToPlay (44100.0, 64);
+
+            AudioBuffer<float> audio (2, 64);
+            MidiBuffer midi;
+            graph.processBlock (audio, midi);
+
+            const AudioProcessorGraph::Node::Ptr removed = graph.getNodeForId (nodeA);
+            graph.removeNode (nodeA);
+            graph.processBlock (audio, midi);
+            expect (removed->getReferenceCount() > 1);
+
+            for (auto i = 0; i < 100 && removed->getReferenceCount() > 1; ++i)
+                MessageManager::getInstance()->runDispatchLoopUntil (10);
+
+            expectEquals (removed->getReferenceCount(), 1);
+            expectEquals (graph.getRenderSequenceStatistics().numAwaitingDeletion, 0);
+        }
+
+        beginTest ("the render sequence timer stops while the audio thread isn't processing");
+        {
+            AudioProcessorGraph graph;
+            graph.setPlayConfigDetails (2, 2, 44100.0, 64);
+
+            const auto nodeA = graph.addNode (BasicProcessor::make (BasicProcessor::getStereoProperties(), MidiIn::no, MidiOut::no))->nodeID;
+            graph.prepareToPlay (44100.0, 64);
+
+            AudioBuffer<float> audio (2, 64);
+            MidiBuffer midi;
+            graph.processBlock (audio, midi);
+
+            // The new sequence is never picked up while the loop runs, so the timer gives up,
+            // and the sequence retired by the next block waits for an explicit release
+            graph.removeNode (nodeA);
+            MessageManager::getInstance()->runDispatchLoopUntil (300);
+
+            graph.processBlock (audio, midi);
+            MessageManager::getInstance()->runDispatchLoopUntil (300);
+            expectEquals (graph.getRenderSequenceStatistics().numAwaitingDeletion, 1);
+
+            graph.releaseRetiredRenderSequence();
+            expectEquals (graph.getRenderSequenceStatistics().numAwaitingDeletion, 0);
+        }
+       #endif
+
+        beginTest ("node profiling records the time taken by each node");
+        {
+            AudioProcessorGraph graph;
+            addFilterNodes (graph, true);
+
+            graph.prepareToPlay (44100.0, 64);
+
+            AudioBuffer<float> audio (2, 64);
+            MidiBuffer midi;
+
+            graph.processBlock (audio, midi);
+            expect (graph.getNodeTimings().empty());
+
+            graph.setNodeProfilingEnabled (true);
+            expect (graph.isNodeProfilingEnabled());
+
+            constexpr auto numBlocks = 50;
+
+            for (auto i = 0; i < numBlocks; ++i)
+                graph.processBlock (audio, midi);
+
+            graph.setNodeProfilingEnabled (false);
+            graph.processBlock (audio, midi);
+
+            const auto timings = graph.getNodeTimings();
+            expectEquals ((int) timings.size(), graph.getNodes().size());
+
+            for (const auto& t : timings)
+            {
+                expect (graph.getNodeForId (t.nodeID) != nullptr);
+                expectEquals (t.numCalls, (int64) numBlocks);
+                expect (0.0 <= t.minSeconds);
+                expect (t.minSeconds <= t.meanSeconds);
+                expect (t.meanSeconds <= t.maxSeconds);
+                expect (t.minSeconds <= t.p99Seconds && t.p99Seconds <= t.maxSeconds);
+            }
+
+            graph.resetNodeTimings();
+            expect (graph.getNodeTimings().empty());
+        }
+
+        beginTest ("render output doesn't depend on the order in which the graph was edited");
+        {
+            auto random = getRandom();
+
+            for (auto iteration = 0; iteration < 20; ++iteration)
+            {
+                AudioProcessorGraph edited, batched;
+                addFilterNodes (edited, true);
+                addFilterNodes (batched, false);
+
+                // Make lots of random connections, some of which will form feedback loops
+                // for a while, and remove some of them again
+                const auto numFilterNodes = edited.getNodes().size() - 2;
+
+                for (auto edit = 0; edit < 40; ++edit)
+                {
+                    const auto getRandomNode = [&] { return NodeID ((uint32) (random.nextInt (numFilterNodes) + 3)); };
+                    const auto channel = random.nextInt (2);
+                    const auto existing = edited.getConnections();
+
+                    if (! existing.empty() && random.nextInt (3) == 0)
+                        edited.removeConnection (existing[(size_t) random.nextInt ((int) existing.size())]);
+                    else
+                        edited.addConnection ({ { getRandomNode(), channel }, { getRandomNode(), channel } });
+                }
+
+                {
+                    const AudioProcessorGraph::ScopedBatchedUpdate batch (batched);
+
+                    for (const auto& connection : edited.getConnections())
+                        expect (batched.addConnection (connection));
+                }
+
+                expect (renderAll (edited) == renderAll (batched));
+            }
+        }
+
+        beginTest ("inputs with different latencies are summed with delay compensation");
+        {
+            using IOProcessor = AudioProcessorGraph::AudioGraphIOProcessor;
+
+            for (const auto blockSize : { 16, 64 })
+            {
+                AudioProcessorGraph graph;
+                graph.setPlayConfigDetails (2, 2, 44100.0, blockSize);
+
+                const auto input  = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioInputNode))->nodeID;
+                const auto output = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioOutputNode))->nodeID;
+
+                // The graph input feeds every delay node as well as the output, so its buffer
+                // is still needed after the first summing point has been reached
+                for (const auto latency : { 0, 5, 37 })
+                {
+                    const auto node = graph.addNode (std::make_unique<DelayProcessor> (latency))->nodeID;
+
+                    for (auto channel = 0; channel < 2; ++channel)
+                    {
+                        expect (graph.addConnection ({ { input, channel }, { node, channel } }));
+                        expect (graph.addConnection ({ { node, channel }, { output, channel } }));
+                    }
+                }
+
+                expect (graph.addConnection ({ { input, 0 }, { output, 0 } }));
+
+                graph.prepareToPlay (44100.0, blockSize);
+                expect (graph.getLatencySamples() == 37);
+
+                AudioBuffer<float> block (2, blockSize);
+                MidiBuffer midi;
+                std::vector<float> left, right;
+
+                for (auto blockIndex = 0; blockIndex < 8; ++blockIndex)
+                {
+                    block.clear();
+
+                    if (blockIndex == 0)
+                    {
+                        block.setSample (0, 1, 1.0f);
+                        block.setSample (1, 1, 1.0f);
+                    }
+
+                    graph.processBlock (block, midi);
+
+                    left .insert (left .end(), block.getReadPointer (0), block.getReadPointer (0) + blockSize);
+                    right.insert (right.end(), block.getReadPointer (1), block.getReadPointer (1) + blockSize);
+                }
+
+                for (size_t i = 0; i < left.size(); ++i)
+                {
+                    expectEquals (left[i],  i == 38 ? 4.0f : 0.0f);
+                    expectEquals (right[i], i == 38 ? 3.0f : 0.0f);
+                }
+            }
+        }
     }
 
 private:
     enum class MidiIn  { no, yes };
     enum class MidiOut { no, yes };
 
+    using NodeID = AudioProcessorGraph::NodeID;
+
+    /*  Adds an audio input and output at IDs 1 and 2, followed by a set of filters, which may all
+        read from the input and write to the output.
+    */
+    static void addFilterNodes (AudioProcessorGraph& graph, bool connectToIO)
+    {
+        using IOProcessor = AudioProcessorGraph::AudioGraphIOProcessor;
+
+        constexpr auto numFilters = 8;
+
+        graph.setPlayConfigDetails (2, 2, 44100.0, 64);
+
+        const auto input  = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioInputNode),  NodeID (1))->nodeID;
+        const auto output = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioOutputNode), NodeID (2))->nodeID;
+
+        for (auto i = 0; i < numFilters; ++i)
+        {
+            const auto node = graph.addNode (std::make_unique<FilterProcessor> (i), NodeID ((uint32) i + 3))->nodeID;
+
+            if (! connectToIO)
+                continue;
+
+            graph.addConnection ({ { input, i % 2 }, { node, i % 2 } });
+            graph.addConnection ({ { node, i % 2 }, { output, i % 2 } });
+        }
+    }
+
+    /*  Renders a few blocks of noise through the graph, and returns all of the output samples. */
+    static std::vector<float> renderAll (AudioProcessorGraph& graph)
+    {
+        constexpr auto blockSize = 64;
+
+        graph.prepareToPlay (44100.0, blockSize);
+
+        std::vector<float> result;
+        Random random (0x5678);
+        AudioBuffer<float> block (2, blockSize);
+        MidiBuffer midi;
+
+        for (auto blockIndex = 0; blockIndex < 4; ++blockIndex)
+        {
+            for (auto channel = 0; channel < block.getNumChannels(); ++channel)
+                for (auto i = 0; i < blockSize; ++i)
+                    block.setSample (channel, i, random.nextFloat() * 2.0f - 1.0f);
+
+            graph.processBlock (block, midi);
+
+            for (auto channel = 0; channel < block.getNumChannels(); ++channel)
+                result.insert (result.end(), block.getReadPointer (channel), block.getReadPointer (channel) + blockSize);
+        }
+
+        graph.releaseResources();
+        return result;
+    }
+
+    struct RenderedOutput
+    {
+        AudioBuffer<float> audio;
+        std::vector<std::pair<int, std::vector<uint8>>> midi;
+    };
+
+    /*  Renders a graph containing many independent chains of stateful processors, which
+        should all be processed concurrently when the graph has some render threads.
+    */
+    static RenderedOutput renderParallelChains (int numThreads)
+    {
+        using IOProcessor = AudioProcessorGraph::AudioGraphIOProcessor;
+
+        constexpr auto numChains = 8;
+        constexpr auto chainLength = 4;
+        constexpr auto numChannels = 2;
+        constexpr auto blockSize = 128;
+        constexpr auto numBlocks = 16;
+        const auto midiChannel = AudioProcessorGraph::midiChannelIndex;
+
+        AudioProcessorGraph graph;
+        graph.setPlayConfigDetails (numChannels, numChannels, 44100.0, blockSize);
+
+        const auto audioIn  = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioInputNode))->nodeID;
+        const auto audioOut = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::audioOutputNode))->nodeID;
+        const auto midiIn   = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::midiInputNode))->nodeID;
+        const auto midiOut  = graph.addNode (std::make_unique<IOProcessor> (IOProcessor::midiOutputNode))->nodeID;
+
+        for (auto chain = 0; chain < numChains; ++chain)
+        {
+            auto previous = audioIn;
+            auto previousMidi = midiIn;
+
+            for (auto i = 0; i < chainLength; ++i)
+            {
+                const auto node = graph.addNode (std::make_unique<FilterProcessor> (chain * chainLength + i))->nodeID;
+
+                for (auto channel = 0; channel < numChannels; ++channel)
+                    graph.addConnection ({ { previous, channel }, { node, channel } });
+
+                graph.addConnection ({ { previousMidi, midiChannel }, { node, midiChannel } });
+                previous = previousMidi = node;
+            }
+
+            for (auto channel = 0; channel < numChannels; ++channel)
+                graph.addConnection ({ { previous, channel }, { audioOut, channel } });
+
+            graph.addConnection ({ { previousMidi, midiChannel }, { midiOut, midiChannel } });
+        }
+
+        graph.prepareToPlay (44100.0, blockSize);
+        graph.setNumRenderThreads (numThreads);
+
+        RenderedOutput result;
+        result.audio.setSize (numChannels, blockSize * numBlocks);
+
+        Random random (0x1234);
+        AudioBuffer<float> block (numChannels, blockSize);
+        MidiBuffer midi;
+
+        for (auto blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+        {
+            for (auto channel = 0; channel < numChannels; ++channel)
+                for (auto i = 0; i < blockSize; ++i)
+                    block.setSample (channel, i, random.nextFloat() * 2.0f - 1.0f);
+
+            midi.clear();
+            midi.addEvent (MidiMessage::noteOn (1, blockIndex, 0.5f), blockIndex);
+
+            graph.processBlock (block, midi);
+
+            for (auto channel = 0; channel < numChannels; ++channel)
+                result.audio.copyFrom (channel, blockIndex * blockSize, block, channel, 0, blockSize);
+
+            for (const auto metadata : midi)
+                result.midi.emplace_back (blockIndex * blockSize + metadata.samplePosition,
+                                          std::vector<uint8> (metadata.data, metadata.data + metadata.numBytes));
+        }
+
+        graph.releaseResources();
+        return result;
+    }
+
     class BasicProcessor final : public AudioProcessor
     {
     public:
@@ -2357,6 +4016,110 @@ private:
         MidiIn midiIn;
         MidiOut midiOut;
     };
+
+    /*  A one-pole lowpass with a different coefficient for each instance, which also
+        adds a MIDI event so that the order in which MIDI buffers are merged is observable.
+    */
+    class FilterProcessor final : public AudioProcessor
+    {
+    public:
+        explicit FilterProcessor (int indexIn)
+            : AudioProcessor (BusesProperties().withInput  ("in",  AudioChannelSet::stereo())
+                                               .withOutput ("out", AudioChannelSet::stereo())),
+              index (indexIn),
+              coefficient (0.5f + 0.4f * std::sin ((float) indexIn)) {}
+
+        const String getName() const override                         { return "Filter Processor"; }
+        double getTailLengthSeconds() const override                  { return {}; }
+        bool acceptsMidi() const override                             { return true; }
+        bool producesMidi() const override                            { return true; }
+        AudioProcessorEditor* createEditor() override                 { return {}; }
+        bool hasEditor() const override                               { return {}; }
+        int getNumPrograms() override                                 { return 1; }
+        int getCurrentProgram() override                              { return {}; }
+        void setCurrentProgram (int) override                         {}
+        const String getProgramName (int) override                    { return {}; }
+        void changeProgramName (int, const String&) override          {}
+        void getStateInformation (juce::MemoryBlock&) override        {}
+        void setStateInformation (const void*, int) override          {}
+        void prepareToPlay (double, int) override                     { reset(); }
+        void releaseResources() override                              {}
+        void reset() override                                         { std::fill (std::begin (state), std::end (state), 0.0f); }
+
+        void processBlock (AudioBuffer<float>& buffer, MidiBuffer& midi) override
+        {
+            for (auto channel = 0; channel < jmin (buffer.getNumChannels(), (int) std::size (state)); ++channel)
+            {
+                auto* samples = buffer.getWritePointer (channel);
+
+                for (auto i = 0; i < buffer.getNumSamples(); ++i)
+                    samples[i] = state[channel] = samples[i] + coefficient * (state[channel] - samples[i]);
+            }
+
+            midi.addEvent (MidiMessage::controllerEvent (1, index % 128, (int) (state[0] * 63.0f) + 64),
+                           index % buffer.getNumSamples());
+        }
+
+        using AudioProcessor::processBlock;
+
+    private:
+        int index;
+        float coefficient;
+        float state[2]{};
+    };
+
+    /*  Delays its input by exactly the number of samples of latency that it reports. */
+    class DelayProcessor final : public AudioProcessor
+    {
+    public:
+        explicit DelayProcessor (int latency)
+            : AudioProcessor (BusesProperties().withInput  ("in",  AudioChannelSet::stereo())
+                                               .withOutput ("out", AudioChannelSet::stereo())),
+              delayLines (2, jmax (1, latency))
+        {
+            setLatencySamples (latency);
+        }
+
+        const String getName() const override                         { return "Delay Processor"; }
+        double getTailLengthSeconds() const override                  { return {}; }
+        bool acceptsMidi() const override                             { return false; }
+        bool producesMidi() const override                            { return false; }
+        AudioProcessorEditor* createEditor() override                 { return {}; }
+        bool hasEditor() const override                               { return {}; }
+        int getNumPrograms() override                                 { return 1; }
+        int getCurrentProgram() override                              { return {}; }
+        void setCurrentProgram (int) override                         {}
+        const String getProgramName (int) override                    { return {}; }
+        void changeProgramName (int, const String&) override          {}
+        void getStateInformation (juce::MemoryBlock&) override        {}
+        void setStateInformation (const void*, int) override          {}
+        void prepareToPlay (double, int) override                     { reset(); }
+        void releaseResources() override                              {}
+        void reset() override                                         { delayLines.clear(); position = 0; }
+
+        void processBlock (AudioBuffer<float>& buffer, MidiBuffer&) override
+        {
+            if (getLatencySamples() == 0)
+                return;
+
+            for (auto i = 0; i < buffer.getNumSamples(); ++i)
+            {
+                for (auto channel = 0; channel < delayLines.getNumChannels(); ++channel)
+                {
+                    auto& stored = delayLines.getWritePointer (channel)[position];
+                    std::swap (stored, buffer.getWritePointer (channel)[i]);
+                }
+
+                position = (position + 1) % delayLines.getNumSamples();
+            }
+        }
+
+        using AudioProcessor::processBlock;
+
+    private:
+        AudioBuffer<float> delayLines;
+        int position = 0;
+    };
 };
 
 static AudioProcessorGraphTests audioProcessorGraphTests;
@@ -323,6 +323,174 @@ public:
     */
     void rebuild();
 
+    /** Groups together a set of edits to the graph, so that it's only rebuilt once.
+
+        While an instance of this class exists, adding or removing nodes and connections won't
+        rebuild the graph, whatever UpdateKind is passed. When the last ScopedBatchedUpdate is
+        deleted, the graph is rebuilt once, using the most urgent UpdateKind that was requested
+        by any of the edits made during its lifetime. Instances can safely be nested.
+
+        This should only be used on the message thread.
+
+        e.g. @code
+        {
+            AudioProcessorGraph::ScopedBatchedUpdate batch (graph);
+
+            for (auto& connection : connectionsToAdd)
+                graph.addConnection (connection);
+        } // graph is rebuilt here
+        @endcode
+    */
+    class JUCE_API  ScopedBatchedUpdate
+    {
+    public:
+        explicit ScopedBatchedUpdate (AudioProcessorGraph&);
+        ~ScopedBatchedUpdate();
+
+    private:
+        AudioProcessorGraph& graph;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedBatchedUpdate)
+        JUCE_DECLARE_NON_MOVEABLE (ScopedBatchedUpdate)
+    };
+
+    //==============================================================================
+    /** Sets the number of extra threads that may be used to render the graph.
+
+        By default this is zero, and every node is processed in turn on the thread that
+        calls processBlock(). With one or more render threads, nodes that don't depend on
+        each other may be processed at the same time, by the calling thread and a pool of
+        realtime worker threads that is owned by the graph. The output is exactly the same
+        as when rendering on a single thread.
+
+        Be aware that in this mode, processors in separate branches of the graph may have their
+        processBlock() methods called concurrently, so they mustn't share any unsynchronised
+        state. The worker threads will join the workgroup passed to audioWorkgroupContextChanged().
+
+        Between blocks, the workers spin for a fraction of a millisecond before going to sleep.
+        If they're asleep by the time the next block starts, waking them may briefly take a lock
+        on the audio thread.
+
+        This should be called on the message thread, and will cause the graph to be rebuilt.
+
+        @see getNumRenderThreads
+    */
+    void setNumRenderThreads (int numThreads);
+
+    /** Returns the number of extra threads used to render the graph.
+        @see setNumRenderThreads
+    */
+    int getNumRenderThreads() const;
+
+    //==============================================================================
+    /** Describes how the graph's render sequences have been passed to the audio thread.
+
+        Each time the graph is rebuilt, it creates a new render sequence on the message thread,
+        which is picked up by the audio thread at the start of the next processBlock() call.
+        The sequence that the audio thread was using is then retired, and deleted shortly
+        afterwards on the message thread, or by releaseRetiredRenderSequence().
+
+        @see getRenderSequenceStatistics, releaseRetiredRenderSequence
+    */
+    struct RenderSequenceStatistics
+    {
+        /** The number of render sequences that have been built. */
+        int64 numBuilt = 0;
+
+        /** The number of render sequences that the audio thread has started using. */
+        int64 numInstalled = 0;
+
+        /** The number of render sequences that have been deleted after the audio thread
+            finished with them.
+        */
+        int64 numRetired = 0;
+
+        /** The number of render sequences that were replaced by a newer sequence before the
+            audio thread could pick them up.
+        */
+        int64 numDiscarded = 0;
+
+        /** The number of retired render sequences that are still waiting to be deleted.
+            This is never more than one.
+        */
+        int numAwaitingDeletion = 0;
+
+        /** The time between the most recently installed sequence being built, and the audio
+            thread starting to use it.
+        */
+        double lastSwapLatencySeconds = 0.0;
+
+        /** The longest time that the audio thread has taken to start using a new sequence. */
+        double maxSwapLatencySeconds = 0.0;
+    };
+
+    /** Returns statistics about how render sequences have been handed over to the audio thread.
+        This may be called from any thread.
+    */
+    RenderSequenceStatistics getRenderSequenceStatistics() const;
+
+    /** Deletes the render sequence that the audio thread has most recently stopped using,
+        along with any removed nodes that it was still keeping alive.
+
+        When a MessageManager exists, the graph does this by itself on a timer shortly after
+        each change, for as long as the audio thread keeps processing. Hosts that run without
+        a message loop should call this regularly instead. It must be called on the message
+        thread, because the processors of removed nodes may be deleted here. It never blocks,
+        and does nothing if the audio thread hasn't yet picked up the newest sequence.
+    */
+    void releaseRetiredRenderSequence();
+
+    //==============================================================================
+    /** Timing statistics for a single node, as measured when node profiling is enabled.
+        @see setNodeProfilingEnabled, getNodeTimings
+    */
+    struct NodeTimings
+    {
+        /** The node that was measured. */
+        NodeID nodeID;
+
+        /** The number of times the node has been processed since the timings were reset. */
+        int64 numCalls = 0;
+
+        /** The shortest, mean and longest times that the node has taken to process a block,
+            since the timings were reset.
+        */
+        double minSeconds = 0.0, meanSeconds = 0.0, maxSeconds = 0.0;
+
+        /** The 99th percentile of the time taken to process the most recent blocks. */
+        double p99Seconds = 0.0;
+    };
+
+    /** Enables or disables measuring the time taken by each node's processBlock() calls.
+
+        Profiling is disabled by default. When enabled, the time taken by each node is recorded
+        without locking or allocating, so it's safe to leave it enabled in a live session in
+        order to find out which processor is causing dropouts.
+
+        Call this on the message thread.
+
+        @see getNodeTimings
+    */
+    void setNodeProfilingEnabled (bool shouldBeEnabled);
+
+    /** Returns true if node profiling has been enabled.
+        @see setNodeProfilingEnabled
+    */
+    bool isNodeProfilingEnabled() const noexcept;
+
+    /** Returns the timing statistics for all the nodes that have been processed while
+        profiling was enabled.
+
+        This gathers up the latest measurements from the audio thread, so it should be called
+        regularly (e.g. from a timer) while profiling is enabled. Call it on the message thread.
+
+        @see setNodeProfilingEnabled, resetNodeTimings
+    */
+    std::vector<NodeTimings> getNodeTimings();
+
+    /** Discards all the timings collected so far. Call it on the message thread. */
+    void resetNodeTimings();
+
     //==============================================================================
     /** A special type of AudioProcessor that can live inside an AudioProcessorGraph
         in order to use the audio that comes into and out of the graph itself.
@@ -419,6 +587,7 @@ public:
 
     void reset() override;
     void setNonRealtime (bool) noexcept override;
+    void audioWorkgroupContextChanged (const AudioWorkgroup&) override;
 
     double getTailLengthSeconds() const override;
     bool acceptsMidi() const override;
@@ -0,0 +1,205 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+namespace juce
+{
+
+void ParameterAutomationBuffer::prepare (int numParameters, int maxPoints)
+{
+    jassert (numParameters >= 0 && maxPoints > 0);
+
+    maxPointsPerParameter = (size_t) jmax (1, maxPoints);
+    points.assign ((size_t) jmax (0, numParameters) * maxPointsPerParameter, {});
+    numPoints.assign ((size_t) jmax (0, numParameters), 0);
+    changedParameters.assign ((size_t) jmax (0, numParameters), 0);
+    numChanged = 0;
+}
+
+void ParameterAutomationBuffer::clear() noexcept
+{
+    for (size_t i = 0; i < numChanged; ++i)
+        numPoints[(size_t) changedParameters[i]] = 0;
+
+    numChanged = 0;
+}
+
+bool ParameterAutomationBuffer::addPoint (int parameterIndex, Point point) noexcept
+{
+    if (! isPositiveAndBelow (parameterIndex, getNumParameters()))
+        return false;
+
+    const auto index = (size_t) parameterIndex;
+    auto* slice = points.data() + index * maxPointsPerParameter;
+    auto& count = numPoints[index];
+
+    if (count == 0)
+    {
+        changedParameters[numChanged++] = parameterIndex;
+    }
+    else
+    {
+        // Points for each parameter must be added in time order!
+        jassert (point.sampleOffset >= slice[count - 1].sampleOffset);
+
+        if (count == maxPointsPerParameter)
+        {
+            slice[count - 1] = point;
+            return true;
+        }
+    }
+
+    slice[count++] = point;
+    return true;
+}
+
+Span<const ParameterAutomationBuffer::Point> ParameterAutomationBuffer::getPoints (int parameterIndex) const noexcept
+{
+    if (! isPositiveAndBelow (parameterIndex, getNumParameters()))
+        return {};
+
+    const auto index = (size_t) parameterIndex;
+    return { points.data() + index * maxPointsPerParameter, numPoints[index] };
+}
+
+void ParameterAutomationBuffer::renderRamp (int parameterIndex, float startValue, float* destination, int numSamples) const noexcept
+{
+    const auto blockPoints = getPoints (parameterIndex);
+    auto nextPoint = blockPoints.begin();
+
+    // The ramp that is currently in progress
+    auto from = startValue, to = startValue;
+    auto rampStart = 0, rampLength = 0;
+
+    const auto valueAt = [&] (int sample)
+    {
+        if (sample >= rampStart + rampLength)
+            return to;
+
+        return from + (to - from) * (float) (sample - rampStart) / (float) rampLength;
+    };
+
+    for (auto sample = 0; sample < numSamples;)
+    {
+        for (; nextPoint != blockPoints.end() && nextPoint->sampleOffset <= sample; ++nextPoint)
+        {
+            from = valueAt (sample);
+            to = nextPoint->value;
+            rampStart = nextPoint->sampleOffset;
+            rampLength = jmax (0, nextPoint->rampLength);
+        }
+
+        const auto segmentEnd = nextPoint != blockPoints.end() ? jmin (numSamples, nextPoint->sampleOffset)
+                                                               : numSamples;
+        const auto rampEnd = jlimit (sample, segmentEnd, rampStart + rampLength);
+
+        for (; sample < rampEnd; ++sample)
+            destination[sample] = valueAt (sample);
+
+        std::fill (destination + sample, destination + segmentEnd, to);
+        sample = segmentEnd;
+    }
+}
+
+//==============================================================================
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+class ParameterAutomationBufferTests final : public UnitTest
+{
+public:
+    ParameterAutomationBufferTests()
+        : UnitTest ("ParameterAutomationBuffer", UnitTestCategories::audioProcessorParameters)
+    {}
+
+    void runTest() override
+    {
+        beginTest ("Points are stored per parameter, and clear() removes them");
+        {
+            ParameterAutomationBuffer buffer;
+            buffer.prepare (4, 8);
+
+            expect (buffer.addPoint (2, { 0, 0, 0.5f }));
+            expect (buffer.addPoint (1, { 3, 0, 0.25f }));
+            expect (buffer.addPoint (2, { 10, 0, 0.75f }));
+            expect (! buffer.addPoint (4, { 0, 0, 1.0f }));
+
+            expect (std::vector<int> (buffer.getChangedParameters().begin(), buffer.getChangedParameters().end()) == std::vector<int> { 2, 1 });
+            expectEquals ((int) buffer.getPoints (2).size(), 2);
+            expectEquals (buffer.getPoints (2)[1].value, 0.75f);
+            expectEquals ((int) buffer.getPoints (0).size(), 0);
+
+            buffer.clear();
+            expectEquals ((int) buffer.getChangedParameters().size(), 0);
+            expectEquals ((int) buffer.getPoints (2).size(), 0);
+        }
+
+        beginTest ("When a parameter runs out of space, its last point is replaced");
+        {
+            ParameterAutomationBuffer buffer;
+            buffer.prepare (1, 2);
+
+            for (auto i = 0; i < 10; ++i)
+                buffer.addPoint (0, { i, 0, (float) i });
+
+            expectEquals ((int) buffer.getPoints (0).size(), 2);
+            expectEquals (buffer.getPoints (0)[0].value, 0.0f);
+            expectEquals (buffer.getPoints (0)[1].value, 9.0f);
+        }
+
+        beginTest ("Rendered ramps follow jumps and linear ramps");
+        {
+            ParameterAutomationBuffer buffer;
+            buffer.prepare (2);
+
+            std::array<float, 8> rendered{};
+
+            buffer.renderRamp (0, 0.5f, rendered.data(), (int) rendered.size());
+            expect (rendered == std::array<float, 8> { 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f });
+
+            buffer.addPoint (0, { 2, 0, 1.0f });
+            buffer.addPoint (0, { 4, 2, 0.0f });
+            buffer.renderRamp (0, 0.5f, rendered.data(), (int) rendered.size());
+            expect (rendered == std::array<float, 8> { 0.5f, 0.5f, 1.0f, 1.0f, 1.0f, 0.5f, 0.0f, 0.0f });
+
+            // A ramp that's interrupted starts the next one from wherever it got to
+            buffer.addPoint (1, { 0, 4, 1.0f });
+            buffer.addPoint (1, { 2, 2, 0.0f });
+            buffer.renderRamp (1, 0.0f, rendered.data(), (int) rendered.size());
+            expect (rendered == std::array<float, 8> { 0.0f, 0.25f, 0.5f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f });
+
+            // Ramps that continue past the end of the block are cut short
+            buffer.clear();
+            buffer.addPoint (0, { 4, 8, 1.0f });
+            buffer.renderRamp (0, 0.0f, rendered.data(), (int) rendered.size());
+            expect (rendered == std::array<float, 8> { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.25f, 0.375f });
+        }
+    }
+};
+
+static ParameterAutomationBufferTests parameterAutomationBufferTests;
+
+#endif
+
+} // namespace juce
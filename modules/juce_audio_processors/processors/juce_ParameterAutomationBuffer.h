@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+namespace juce
+{
+
+//==============================================================================
+/**
+    Holds the parameter automation that a host sent for a single processing block.
+
+    Hosts usually send parameter changes as a list of timestamped points, but
+    processBlock() only sees one value per parameter. If your processor returns
+    true from AudioProcessor::supportsSampleAccurateAutomation(), the plugin
+    wrappers will also fill one of these with the points they received, and you
+    can retrieve it with AudioProcessor::getParameterAutomation() during
+    processBlock(). This lets you follow dense automation exactly, without
+    having to split the block or add your own smoothing.
+
+    Each Point describes a change to a parameter's normalised value. The change
+    begins at sampleOffset and moves linearly from whatever value the parameter
+    had at that moment to the new value over rampLength samples. A rampLength of
+    zero is an instant jump. Points for a parameter are stored in time order.
+
+    Before processBlock() is called, each parameter will already have been set to
+    the final value it reaches in this block, so processors that ignore this
+    buffer behave exactly as they did before.
+
+    All storage is allocated in prepare(), so adding points never allocates. If a
+    parameter receives more points than were prepared for, its final point is
+    replaced, so the value at the end of the block is always correct.
+
+    @see AudioProcessor::getParameterAutomation, AudioProcessor::supportsSampleAccurateAutomation
+
+    @tags{Audio}
+*/
+class JUCE_API  ParameterAutomationBuffer
+{
+public:
+    //==============================================================================
+    /** A single change to a parameter's normalised value. */
+    struct Point
+    {
+        int sampleOffset = 0;
+        int rampLength = 0;
+        float value = 0.0f;
+    };
+
+    //==============================================================================
+    /** Creates an empty buffer. Call prepare() before adding any points. */
+    ParameterAutomationBuffer() = default;
+
+    /** Allocates space for the given number of parameters, with room for up to
+        maxPointsPerParameter points each. This also clears the buffer.
+    */
+    void prepare (int numParameters, int maxPointsPerParameter = 32);
+
+    /** Removes all points, ready for the next block. */
+    void clear() noexcept;
+
+    /** Adds a point for a parameter, using the parameter's index in
+        AudioProcessor::getParameters().
+
+        Points for a given parameter must be added in time order. Returns false if
+        the parameter index is out of range.
+    */
+    bool addPoint (int parameterIndex, Point point) noexcept;
+
+    /** Returns the number of parameters that the buffer was prepared for. */
+    int getNumParameters() const noexcept                   { return (int) numPoints.size(); }
+
+    /** Returns the indices of the parameters that have points in this block, in the
+        order that they first changed.
+    */
+    Span<const int> getChangedParameters() const noexcept   { return { changedParameters.data(), numChanged }; }
+
+    /** Returns the points that were added for a parameter during this block. */
+    Span<const Point> getPoints (int parameterIndex) const noexcept;
+
+    /** Fills the destination with the value of a parameter at each sample of the block.
+
+        startValue is the parameter's value at the start of the block, which will
+        usually be the last value that your processor used. The result has the same
+        shape as the sequence you'd get from calling SmoothedValue::getNextValue()
+        once per sample, so it can be used anywhere a smoothed per-sample value is
+        expected.
+
+        If a ramp continues past the end of the block, only the part that fits is
+        rendered.
+    */
+    void renderRamp (int parameterIndex, float startValue, float* destination, int numSamples) const noexcept;
+
+private:
+    //==============================================================================
+    std::vector<Point> points;
+    std::vector<size_t> numPoints;
+    std::vector<int> changedParameters;
+    size_t numChanged = 0, maxPointsPerParameter = 0;
+
+    JUCE_LEAK_DETECTOR (ParameterAutomationBuffer)
+};
+
+} // namespace juce
@@ -181,15 +181,8 @@ bool KnownPluginList::scanAndAddFile (const String& fileOrIdentifier,
     {
         const ScopedUnlock sl2 (scanLock);
 
-        if (scanner != nullptr)
-        {
-            if (! scanner->findPluginTypesFor (format, found, fileOrIdentifier))
-                addToBlacklist (fileOrIdentifier);
-        }
-        else
-        {
-            format.findAllTypesForFile (found, fileOrIdentifier);
-        }
+        if (! findTypesForFile (fileOrIdentifier, format, found))
+            addToBlacklist (fileOrIdentifier);
     }
 
     for (auto* desc : found)
@@ -207,6 +200,17 @@ bool KnownPluginList::scanAndAddFile (const String& fileOrIdentifier,
     return ! found.isEmpty();
 }
 
+bool KnownPluginList::findTypesForFile (const String& fileOrIdentifier,
+                                        AudioPluginFormat& format,
+                                        OwnedArray<PluginDescription>& typesFound)
+{
+    if (scanner != nullptr)
+        return scanner->findPluginTypesFor (format, typesFound, fileOrIdentifier);
+
+    format.findAllTypesForFile (typesFound, fileOrIdentifier);
+    return true;
+}
+
 void KnownPluginList::scanAndAddDragAndDroppedFiles (AudioPluginFormatManager& formatManager,
                                                      const StringArray& files,
                                                      OwnedArray<PluginDescription>& typesFound)
@@ -93,6 +93,19 @@ public:
                          OwnedArray<PluginDescription>& typesFound,
                          AudioPluginFormat& formatToUse);
 
+    /** Looks for all types that can be loaded from a given file, but doesn't add
+        them to the list.
+
+        This uses the custom scanner if one has been set, and may be called from
+        several threads at once if the custom scanner allows it.
+
+        Returns false if the scanner reported that the file crashed, in which case
+        you'll probably want to add it to the blacklist.
+    */
+    bool findTypesForFile (const String& possiblePluginFileOrIdentifier,
+                           AudioPluginFormat& formatToUse,
+                           OwnedArray<PluginDescription>& typesFound);
+
     /** Tells a custom scanner that a scan has finished, and it can release any resources. */
     void scanFinished();
 
@@ -234,6 +247,8 @@ private:
     std::unique_ptr<CustomScanner> scanner;
     CriticalSection scanLock, typesArrayLock;
 
+    friend class KnownPluginListCache;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (KnownPluginList)
 };
 
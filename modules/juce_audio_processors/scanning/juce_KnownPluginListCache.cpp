@@ -0,0 +1,725 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+namespace juce
+{
+
+/*  The cache file is laid out as follows, with all integers stored little-endian:
+
+    header          magic, version, number of types, files and blacklisted entries, and
+                    the offset of each of the sections below
+    file table      one fixed-size record per file or identifier, sorted by the hash of
+                    its path so that it can be binary-searched in place
+    blacklist       an (offset, length) pair for each blacklisted entry
+    strings         the paths, blacklisted entries and encoded plugin descriptions that
+                    the tables above refer to
+*/
+namespace KnownPluginListCacheHelpers
+{
+    constexpr uint32 magicNumber   = 0x43504b4a; // 'JKPC'
+    constexpr uint32 formatVersion = 1;
+
+    constexpr size_t headerSize = 40;
+    constexpr size_t fileRecordSize = 56;
+    constexpr size_t blacklistRecordSize = 8;
+
+    constexpr uint32 existedFlag = 1;
+
+    //==============================================================================
+    struct FileIdentity
+    {
+        bool exists = false;
+        int64 size = 0, modificationTime = 0;
+        uint64 fileIdentifier = 0;
+
+        static FileIdentity forFileOrIdentifier (const String& fileOrIdentifier)
+        {
+            if (! File::isAbsolutePath (fileOrIdentifier))
+                return {};
+
+            const File file (fileOrIdentifier);
+            const auto fileIdentifier = file.getFileIdentifier();
+
+            if (fileIdentifier == 0 && ! file.exists())
+                return {};
+
+            return { true, file.getSize(), file.getLastModificationTime().toMilliseconds(), fileIdentifier };
+        }
+
+        bool operator== (const FileIdentity& other) const noexcept
+        {
+            return std::tie (exists, size, modificationTime, fileIdentifier)
+                == std::tie (other.exists, other.size, other.modificationTime, other.fileIdentifier);
+        }
+
+        bool operator!= (const FileIdentity& other) const noexcept   { return ! operator== (other); }
+    };
+
+    //==============================================================================
+    /*  Calls fn (index) for every index in the range [0, numItems), sharing the work
+        between the calling thread and up to numThreads - 1 others.
+    */
+    template <typename Fn>
+    static void forEachInParallel (int numItems, int numThreads, Fn&& fn)
+    {
+        constexpr int minItemsPerThread = 64;
+
+        std::atomic<int> nextItem { 0 };
+
+        const auto work = [&]
+        {
+            for (auto i = nextItem++; i < numItems; i = nextItem++)
+                fn (i);
+        };
+
+        const auto numHelpers = jmin (numThreads, numItems / minItemsPerThread) - 1;
+
+        if (numHelpers <= 0)
+        {
+            work();
+            return;
+        }
+
+        ThreadPool pool (ThreadPoolOptions{}.withThreadName ("Plugin list cache")
+                                            .withNumberOfThreads (numHelpers));
+
+        for (int i = 0; i < numHelpers; ++i)
+            pool.addJob (work);
+
+        work();
+
+        // Any helpers that haven't started by now will find nothing left to do
+        pool.removeAllJobs (false, -1);
+    }
+
+    //==============================================================================
+    static void writeDescription (MemoryOutputStream& out, int listIndex, const PluginDescription& d)
+    {
+        out.writeInt (listIndex);
+        out.writeString (d.name);
+        out.writeString (d.descriptiveName);
+        out.writeString (d.pluginFormatName);
+        out.writeString (d.category);
+        out.writeString (d.manufacturerName);
+        out.writeString (d.version);
+        out.writeInt64 (d.lastFileModTime.toMilliseconds());
+        out.writeInt64 (d.lastInfoUpdateTime.toMilliseconds());
+        out.writeInt (d.deprecatedUid);
+        out.writeInt (d.uniqueId);
+        out.writeBool (d.isInstrument);
+        out.writeInt (d.numInputChannels);
+        out.writeInt (d.numOutputChannels);
+        out.writeBool (d.hasSharedContainer);
+        out.writeBool (d.hasARAExtension);
+    }
+
+    static bool readDescription (MemoryInputStream& in, int& listIndex, PluginDescription& d)
+    {
+        listIndex               = in.readInt();
+        d.name                  = in.readString();
+        d.descriptiveName       = in.readString();
+        d.pluginFormatName      = in.readString();
+        d.category              = in.readString();
+        d.manufacturerName      = in.readString();
+        d.version               = in.readString();
+        d.lastFileModTime       = Time (in.readInt64());
+        d.lastInfoUpdateTime    = Time (in.readInt64());
+        d.deprecatedUid         = in.readInt();
+        d.uniqueId              = in.readInt();
+        d.isInstrument          = in.readBool();
+        d.numInputChannels      = in.readInt();
+        d.numOutputChannels     = in.readInt();
+        d.hasSharedContainer    = in.readBool();
+
+        if (in.isExhausted())
+            return false;
+
+        d.hasARAExtension       = in.readBool();
+        return true;
+    }
+}
+
+//==============================================================================
+struct KnownPluginListCache::FileRecord
+{
+    uint64 pathHash = 0;
+    KnownPluginListCacheHelpers::FileIdentity identity;
+    uint32 pathOffset = 0, pathLength = 0;
+    uint32 typesOffset = 0, typesLength = 0, numTypes = 0;
+};
+
+KnownPluginListCache::KnownPluginListCache (const File& cacheFile)
+{
+    using namespace KnownPluginListCacheHelpers;
+
+    mappedFile = std::make_unique<MemoryMappedFile> (cacheFile, MemoryMappedFile::readOnly);
+
+    const auto* data = static_cast<const char*> (mappedFile->getData());
+    const auto dataSize = mappedFile->getSize();
+
+    if (data == nullptr || dataSize < headerSize)
+        return;
+
+    const auto readHeader = [data] (size_t offset) { return ByteOrder::littleEndianInt (data + offset); };
+
+    if (readHeader (0) != magicNumber || readHeader (4) != formatVersion || readHeader (32) != dataSize)
+        return;
+
+    const auto typeCount        = readHeader (8);
+    const auto fileCount        = readHeader (12);
+    const auto blacklistCount   = readHeader (16);
+    const auto fileTableStart   = (size_t) readHeader (20);
+    const auto blacklistStart   = (size_t) readHeader (24);
+    const auto stringsStart     = (size_t) readHeader (28);
+
+    const auto isSensible = typeCount <= (uint32) std::numeric_limits<int>::max()
+                         && fileTableStart == headerSize
+                         && blacklistStart == fileTableStart + fileCount * fileRecordSize
+                         && stringsStart == blacklistStart + blacklistCount * blacklistRecordSize
+                         && stringsStart <= dataSize;
+
+    if (! isSensible)
+        return;
+
+    fileTable       = data + fileTableStart;
+    blacklistTable  = data + blacklistStart;
+    strings         = data + stringsStart;
+    stringsSize     = dataSize - stringsStart;
+    numTypes        = (int) typeCount;
+    numBlacklisted  = (int) blacklistCount;
+    numFiles        = (int) fileCount;
+}
+
+KnownPluginListCache::~KnownPluginListCache() = default;
+
+//==============================================================================
+bool KnownPluginListCache::writeToFile (const KnownPluginList& list, const File& cacheFile, int numThreads)
+{
+    using namespace KnownPluginListCacheHelpers;
+
+    struct PendingFile
+    {
+        String path;
+        uint64 pathHash = 0;
+        std::vector<int> typeIndices;
+        FileIdentity identity;
+    };
+
+    const auto types = list.getTypes();
+    const auto blacklist = list.getBlacklistedFiles();
+
+    std::vector<PendingFile> files;
+
+    {
+        std::unordered_map<String, size_t> fileIndices;
+
+        for (int i = 0; i < types.size(); ++i)
+        {
+            const auto& path = types.getReference (i).fileOrIdentifier;
+            const auto insertion = fileIndices.emplace (path, files.size());
+
+            if (insertion.second)
+                files.push_back ({ path, (uint64) path.hashCode64(), {}, {} });
+
+            files[insertion.first->second].typeIndices.push_back (i);
+        }
+    }
+
+    forEachInParallel ((int) files.size(), numThreads, [&files] (int i)
+    {
+        files[(size_t) i].identity = FileIdentity::forFileOrIdentifier (files[(size_t) i].path);
+    });
+
+    std::sort (files.begin(), files.end(), [] (const PendingFile& a, const PendingFile& b)
+    {
+        return std::tie (a.pathHash, a.path) < std::tie (b.pathHash, b.path);
+    });
+
+    MemoryOutputStream tables, stringData;
+
+    const auto writeString = [&stringData] (const String& s, MemoryOutputStream& table)
+    {
+        const auto offset = (uint32) stringData.getPosition();
+        stringData.write (s.toRawUTF8(), s.getNumBytesAsUTF8());
+        table.writeInt ((int) offset);
+        table.writeInt ((int) (stringData.getPosition() - offset));
+    };
+
+    for (const auto& file : files)
+    {
+        tables.writeInt64 ((int64) file.pathHash);
+        tables.writeInt64 (file.identity.size);
+        tables.writeInt64 (file.identity.modificationTime);
+        tables.writeInt64 ((int64) file.identity.fileIdentifier);
+        writeString (file.path, tables);
+
+        const auto typesOffset = (uint32) stringData.getPosition();
+
+        for (const auto index : file.typeIndices)
+            writeDescription (stringData, index, types.getReference (index));
+
+        tables.writeInt ((int) typesOffset);
+        tables.writeInt ((int) (stringData.getPosition() - typesOffset));
+        tables.writeInt ((int) file.typeIndices.size());
+        tables.writeInt ((int) (file.identity.exists ? existedFlag : 0));
+    }
+
+    for (const auto& entry : blacklist)
+        writeString (entry, tables);
+
+    const auto stringsStart = headerSize + tables.getDataSize();
+    const auto totalSize = stringsStart + stringData.getDataSize();
+
+    if (totalSize > std::numeric_limits<uint32>::max())
+    {
+        jassertfalse;
+        return false;
+    }
+
+    TemporaryFile temp (cacheFile);
+
+    {
+        FileOutputStream out (temp.getFile());
+
+        if (! out.openedOk())
+            return false;
+
+        out.writeInt ((int) magicNumber);
+        out.writeInt ((int) formatVersion);
+        out.writeInt (types.size());
+        out.writeInt ((int) files.size());
+        out.writeInt (blacklist.size());
+        out.writeInt ((int) headerSize);
+        out.writeInt ((int) (headerSize + files.size() * fileRecordSize));
+        out.writeInt ((int) stringsStart);
+        out.writeInt ((int) totalSize);
+        out.writeInt (0);
+
+        out << tables << stringData;
+        out.flush();
+
+        if (out.getStatus().failed())
+            return false;
+    }
+
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+//==============================================================================
+String KnownPluginListCache::readString (uint32 offset, uint32 length) const
+{
+    if ((size_t) offset + length > stringsSize)
+    {
+        jassertfalse; // corrupt cache file?
+        return {};
+    }
+
+    return String::fromUTF8 (strings + offset, (int) length);
+}
+
+KnownPluginListCache::FileRecord KnownPluginListCache::getFileRecord (int index) const
+{
+    jassert (isPositiveAndBelow (index, numFiles));
+
+    const auto* r = fileTable + (size_t) index * KnownPluginListCacheHelpers::fileRecordSize;
+
+    FileRecord record;
+    record.pathHash                     = ByteOrder::littleEndianInt64 (r);
+    record.identity.size                = (int64) ByteOrder::littleEndianInt64 (r + 8);
+    record.identity.modificationTime    = (int64) ByteOrder::littleEndianInt64 (r + 16);
+    record.identity.fileIdentifier      = ByteOrder::littleEndianInt64 (r + 24);
+    record.pathOffset                   = ByteOrder::littleEndianInt (r + 32);
+    record.pathLength                   = ByteOrder::littleEndianInt (r + 36);
+    record.typesOffset                  = ByteOrder::littleEndianInt (r + 40);
+    record.typesLength                  = ByteOrder::littleEndianInt (r + 44);
+    record.numTypes                     = ByteOrder::littleEndianInt (r + 48);
+    record.identity.exists              = (ByteOrder::littleEndianInt (r + 52) & KnownPluginListCacheHelpers::existedFlag) != 0;
+    return record;
+}
+
+String KnownPluginListCache::getFileOrIdentifier (int index) const
+{
+    if (! isPositiveAndBelow (index, numFiles))
+        return {};
+
+    const auto record = getFileRecord (index);
+    return readString (record.pathOffset, record.pathLength);
+}
+
+StringArray KnownPluginListCache::getBlacklistedFiles() const
+{
+    StringArray result;
+
+    for (int i = 0; i < numBlacklisted; ++i)
+    {
+        const auto* r = blacklistTable + (size_t) i * KnownPluginListCacheHelpers::blacklistRecordSize;
+        result.add (readString (ByteOrder::littleEndianInt (r), ByteOrder::littleEndianInt (r + 4)));
+    }
+
+    return result;
+}
+
+int KnownPluginListCache::indexOfFile (const String& fileOrIdentifier) const
+{
+    const auto hash = (uint64) fileOrIdentifier.hashCode64();
+
+    int start = 0, end = getNumFiles();
+
+    while (start < end)
+    {
+        const auto mid = start + (end - start) / 2;
+
+        if (getFileRecord (mid).pathHash < hash)
+            start = mid + 1;
+        else
+            end = mid;
+    }
+
+    for (int i = start; i < getNumFiles(); ++i)
+    {
+        const auto record = getFileRecord (i);
+
+        if (record.pathHash != hash)
+            break;
+
+        if (readString (record.pathOffset, record.pathLength) == fileOrIdentifier)
+            return i;
+    }
+
+    return -1;
+}
+
+bool KnownPluginListCache::decodeTypes (const FileRecord& record,
+                                        const std::function<void (int, PluginDescription&&)>& callback) const
+{
+    if ((size_t) record.typesOffset + record.typesLength > stringsSize)
+    {
+        jassertfalse; // corrupt cache file?
+        return false;
+    }
+
+    const auto path = readString (record.pathOffset, record.pathLength);
+    MemoryInputStream in (strings + record.typesOffset, record.typesLength, false);
+
+    for (uint32 i = 0; i < record.numTypes; ++i)
+    {
+        int listIndex = 0;
+        PluginDescription desc;
+
+        if (! KnownPluginListCacheHelpers::readDescription (in, listIndex, desc)
+             || ! isPositiveAndBelow (listIndex, numTypes))
+        {
+            jassertfalse; // corrupt cache file?
+            return false;
+        }
+
+        desc.fileOrIdentifier = path;
+        callback (listIndex, std::move (desc));
+    }
+
+    return true;
+}
+
+bool KnownPluginListCache::getTypesForFile (const String& fileOrIdentifier,
+                                            OwnedArray<PluginDescription>& typesFound) const
+{
+    const auto index = indexOfFile (fileOrIdentifier);
+
+    if (index < 0)
+        return false;
+
+    return decodeTypes (getFileRecord (index), [&typesFound] (int, PluginDescription&& desc)
+    {
+        typesFound.add (new PluginDescription (std::move (desc)));
+    });
+}
+
+//==============================================================================
+bool KnownPluginListCache::hasChanged (const FileRecord& record) const
+{
+    using namespace KnownPluginListCacheHelpers;
+
+    const auto path = readString (record.pathOffset, record.pathLength);
+
+    if (! File::isAbsolutePath (path))
+        return false;
+
+    return FileIdentity::forFileOrIdentifier (path) != record.identity;
+}
+
+StringArray KnownPluginListCache::findChangedFiles (int numThreads) const
+{
+    std::vector<uint8> changed ((size_t) getNumFiles());
+
+    KnownPluginListCacheHelpers::forEachInParallel (getNumFiles(), numThreads, [&] (int i)
+    {
+        changed[(size_t) i] = hasChanged (getFileRecord (i)) ? 1 : 0;
+    });
+
+    StringArray result;
+
+    for (int i = 0; i < getNumFiles(); ++i)
+        if (changed[(size_t) i] != 0)
+            result.add (getFileOrIdentifier (i));
+
+    return result;
+}
+
+StringArray KnownPluginListCache::restoreInto (KnownPluginList& list, int numThreads) const
+{
+    if (! isValid())
+    {
+        jassertfalse; // check isValid() before trying to use the cache!
+        return {};
+    }
+
+    Array<PluginDescription> cachedTypes;
+    cachedTypes.resize (numTypes);
+
+    std::vector<uint8> typeWasRestored ((size_t) numTypes), fileHasChanged ((size_t) numFiles);
+
+    KnownPluginListCacheHelpers::forEachInParallel (numFiles, numThreads, [&] (int i)
+    {
+        const auto record = getFileRecord (i);
+
+        if (hasChanged (record))
+        {
+            fileHasChanged[(size_t) i] = 1;
+            return;
+        }
+
+        decodeTypes (record, [&] (int listIndex, PluginDescription&& desc)
+        {
+            cachedTypes.getReference (listIndex) = std::move (desc);
+            typeWasRestored[(size_t) listIndex] = 1;
+        });
+    });
+
+    Array<PluginDescription> restoredTypes;
+    restoredTypes.ensureStorageAllocated (numTypes);
+
+    for (int i = 0; i < numTypes; ++i)
+        if (typeWasRestored[(size_t) i] != 0)
+            restoredTypes.add (std::move (cachedTypes.getReference (i)));
+
+    {
+        const ScopedLock sl (list.typesArrayLock);
+        list.types.swapWith (restoredTypes);
+    }
+
+    list.blacklist = getBlacklistedFiles();
+    list.sendChangeMessage();
+
+    StringArray filesToRescan;
+
+    for (int i = 0; i < numFiles; ++i)
+    {
+        if (fileHasChanged[(size_t) i] != 0)
+        {
+            const auto path = getFileOrIdentifier (i);
+
+            if (File (path).exists())
+                filesToRescan.add (path);
+        }
+    }
+
+    return filesToRescan;
+}
+
+//==============================================================================
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+class KnownPluginListCacheTests final : public UnitTest
+{
+public:
+    KnownPluginListCacheTests()
+        : UnitTest ("KnownPluginListCache", UnitTestCategories::audioProcessors)
+    {}
+
+    void runTest() override
+    {
+        ScopedJuceInitialiser_GUI scopedJuceInitialiser;
+
+        const TemporaryFile pluginFolder;
+        pluginFolder.getFile().createDirectory();
+
+        const TemporaryFile cacheFile;
+
+        Array<File> pluginFiles;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            pluginFiles.add (pluginFolder.getFile().getChildFile ("plugin" + String (i) + ".vst3"));
+            pluginFiles.getLast().replaceWithText ("plugin " + String (i));
+        }
+
+        KnownPluginList list;
+        list.addType (makeDescription ("AudioUnit:Synths/aumu,abcd,efgh", 1));
+        list.addType (makeDescription (pluginFiles[2].getFullPathName(), 2));
+        list.addType (makeDescription (pluginFiles[1].getFullPathName(), 3));
+        list.addType (makeDescription (pluginFiles[0].getFullPathName(), 4));
+        list.addType (makeDescription (pluginFiles[0].getFullPathName(), 5));
+        list.addToBlacklist ("crashy.vst3");
+        list.addToBlacklist ("hangs.vst3");
+
+        beginTest ("Missing and corrupt cache files are rejected");
+        {
+            expect (! KnownPluginListCache (cacheFile.getFile()).isValid());
+
+            cacheFile.getFile().replaceWithText ("This is not a plugin list cache");
+            expect (! KnownPluginListCache (cacheFile.getFile()).isValid());
+        }
+
+        beginTest ("A list can be written and read back");
+        {
+            expect (KnownPluginListCache::writeToFile (list, cacheFile.getFile()));
+
+            KnownPluginListCache cache (cacheFile.getFile());
+            expect (cache.isValid());
+            expectEquals (cache.getNumTypes(), 5);
+            expectEquals (cache.getNumFiles(), 4);
+            expect (cache.getBlacklistedFiles() == list.getBlacklistedFiles());
+            expect (cache.findChangedFiles().isEmpty());
+
+            KnownPluginList restored;
+            restored.addType (makeDescription ("somethingElse", 6));
+
+            expect (cache.restoreInto (restored).isEmpty());
+            expect (haveSameTypes (restored, list));
+            expect (restored.getBlacklistedFiles() == list.getBlacklistedFiles());
+        }
+
+        beginTest ("Types for a single file can be looked up");
+        {
+            KnownPluginListCache cache (cacheFile.getFile());
+
+            OwnedArray<PluginDescription> found;
+            expect (cache.getTypesForFile (pluginFiles[0].getFullPathName(), found));
+            expectEquals (found.size(), 2);
+
+            for (auto* desc : found)
+                expectEquals (desc->fileOrIdentifier, pluginFiles[0].getFullPathName());
+
+            found.clear();
+            expect (cache.getTypesForFile ("AudioUnit:Synths/aumu,abcd,efgh", found));
+            expectEquals (found.size(), 1);
+            expectEquals (found[0]->uniqueId, 1);
+
+            expect (! cache.getTypesForFile (pluginFolder.getFile().getChildFile ("unknown.vst3").getFullPathName(), found));
+        }
+
+        beginTest ("Types from modified or deleted files aren't restored");
+        {
+            pluginFiles[0].appendText ("updated");
+            pluginFiles[2].deleteFile();
+
+            KnownPluginListCache cache (cacheFile.getFile());
+
+            const auto changed = cache.findChangedFiles();
+            expectEquals (changed.size(), 2);
+            expect (changed.contains (pluginFiles[0].getFullPathName()));
+            expect (changed.contains (pluginFiles[2].getFullPathName()));
+
+            KnownPluginList restored;
+            const auto toRescan = cache.restoreInto (restored);
+
+            expect (toRescan == StringArray { pluginFiles[0].getFullPathName() });
+
+            const auto types = restored.getTypes();
+            expectEquals (types.size(), 2);
+            expectEquals (types[0].uniqueId, 3);
+            expectEquals (types[1].uniqueId, 1);
+        }
+
+        beginTest ("Restoring on several threads preserves the order of the list");
+        {
+            KnownPluginList bigList;
+
+            for (int i = 0; i < 1000; ++i)
+                bigList.addType (makeDescription ("AudioUnit:Effects/aufx,plg" + String (i % 300) + ",juce", i));
+
+            expect (KnownPluginListCache::writeToFile (bigList, cacheFile.getFile(), 4));
+
+            KnownPluginListCache cache (cacheFile.getFile());
+            expectEquals (cache.getNumFiles(), 300);
+
+            KnownPluginList restored;
+            expect (cache.restoreInto (restored, 4).isEmpty());
+            expect (haveSameTypes (restored, bigList));
+        }
+
+        beginTest ("A truncated cache file is rejected");
+        {
+            MemoryBlock block;
+            cacheFile.getFile().loadFileAsData (block);
+            cacheFile.getFile().replaceWithData (block.getData(), block.getSize() - 1);
+
+            expect (! KnownPluginListCache (cacheFile.getFile()).isValid());
+        }
+    }
+
+private:
+    static PluginDescription makeDescription (const String& fileOrIdentifier, int uid)
+    {
+        PluginDescription desc;
+        desc.name = "Plugin " + String (uid);
+        desc.descriptiveName = CharPointer_UTF8 ("Caf\xc3\xa9 Reverb");
+        desc.pluginFormatName = "VST3";
+        desc.category = "Fx";
+        desc.manufacturerName = "JUCE";
+        desc.version = "1.0." + String (uid);
+        desc.fileOrIdentifier = fileOrIdentifier;
+        desc.lastFileModTime = Time (1000 * (int64) uid);
+        desc.lastInfoUpdateTime = Time (2000 * (int64) uid);
+        desc.deprecatedUid = uid;
+        desc.uniqueId = uid;
+        desc.isInstrument = (uid % 2) == 0;
+        desc.numInputChannels = uid;
+        desc.numOutputChannels = uid + 1;
+        desc.hasSharedContainer = true;
+        return desc;
+    }
+
+    static bool haveSameTypes (const KnownPluginList& a, const KnownPluginList& b)
+    {
+        const auto typesA = a.getTypes(), typesB = b.getTypes();
+
+        if (typesA.size() != typesB.size())
+            return false;
+
+        for (int i = 0; i < typesA.size(); ++i)
+            if (! typesA[i].createXml()->isEquivalentTo (typesB[i].createXml().get(), false))
+                return false;
+
+        return true;
+    }
+};
+
+static KnownPluginListCacheTests knownPluginListCacheTests;
+
+#endif
+
+} // namespace juce
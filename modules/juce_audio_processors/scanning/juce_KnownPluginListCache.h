@@ -0,0 +1,152 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+namespace juce
+{
+
+//==============================================================================
+/**
+    A compact binary snapshot of a KnownPluginList, which can be used to restore
+    the list quickly at startup.
+
+    As well as the plugin types and the blacklist, the cache records the size,
+    modification time and file identifier (i.e. the inode) of every plugin file
+    that the list refers to. When the list is restored, each file is checked
+    against its record, and only the types belonging to files that haven't
+    changed are added back to the list. Anything that was modified, replaced or
+    deleted is left out, so a PluginDirectoryScanner that's told not to rescan
+    known files will only rescan the plugins that have actually changed.
+
+    The cache file is memory-mapped rather than parsed, so opening one is cheap,
+    and plugin descriptions are only decoded when they're needed. Checking the
+    files is done on several threads, because for a large collection of plugins
+    that's where most of the time goes.
+
+    @code
+    // On shutdown:
+    KnownPluginListCache::writeToFile (knownPluginList, cacheFile);
+
+    // On startup:
+    KnownPluginListCache cache (cacheFile);
+
+    if (cache.isValid())
+        filesToRescan = cache.restoreInto (knownPluginList);
+    else
+        knownPluginList.recreateFromXml (*savedXml);
+    @endcode
+
+    A cache is only useful on the machine where it was written, and it doesn't
+    replace KnownPluginList::createXml(), which remains the portable format.
+
+    @see KnownPluginList, PluginDirectoryScanner
+
+    @tags{Audio}
+*/
+class JUCE_API  KnownPluginListCache
+{
+public:
+    //==============================================================================
+    /** Opens a cache file that was created by writeToFile().
+
+        The file is memory-mapped, and only its header is checked here. If the file
+        is missing or isn't a cache in the current format, isValid() will return false.
+    */
+    explicit KnownPluginListCache (const File& cacheFile);
+
+    /** Destructor. */
+    ~KnownPluginListCache();
+
+    /** Writes the types and blacklist in a list to a cache file, replacing any
+        existing file.
+
+        Returns false if the file couldn't be written.
+    */
+    static bool writeToFile (const KnownPluginList& list,
+                             const File& cacheFile,
+                             int numThreads = SystemStats::getNumCpus());
+
+    //==============================================================================
+    /** Returns true if the cache file was opened and looks sensible. */
+    bool isValid() const noexcept                       { return numFiles >= 0; }
+
+    /** Returns the number of plugin types in the cache. */
+    int getNumTypes() const noexcept                    { return jmax (0, numTypes); }
+
+    /** Returns the number of distinct files or identifiers in the cache. */
+    int getNumFiles() const noexcept                    { return jmax (0, numFiles); }
+
+    /** Returns the file or identifier of one of the entries in the cache. */
+    String getFileOrIdentifier (int index) const;
+
+    /** Returns the blacklist that was stored in the cache. */
+    StringArray getBlacklistedFiles() const;
+
+    /** Adds the cached types for a file or identifier to an array, without checking
+        whether the file has changed.
+
+        Returns false if the file isn't in the cache.
+    */
+    bool getTypesForFile (const String& fileOrIdentifier,
+                          OwnedArray<PluginDescription>& typesFound) const;
+
+    //==============================================================================
+    /** Checks every file in the cache against the file system, and returns the
+        files that have been modified, replaced or deleted since the cache was written.
+
+        Identifiers which aren't absolute paths (e.g. AudioUnit or LV2 identifiers)
+        can't be checked, and are always treated as unchanged.
+    */
+    StringArray findChangedFiles (int numThreads = SystemStats::getNumCpus()) const;
+
+    /** Replaces the contents of a list with the cached blacklist and the cached types
+        of all the files that haven't changed, in their original order.
+
+        Returns the files that have changed and still exist, which will need to be
+        rescanned.
+    */
+    StringArray restoreInto (KnownPluginList& list,
+                             int numThreads = SystemStats::getNumCpus()) const;
+
+private:
+    //==============================================================================
+    struct FileRecord;
+
+    FileRecord getFileRecord (int index) const;
+    int indexOfFile (const String& fileOrIdentifier) const;
+    bool hasChanged (const FileRecord&) const;
+    bool decodeTypes (const FileRecord&, const std::function<void (int, PluginDescription&&)>&) const;
+    String readString (uint32 offset, uint32 length) const;
+
+    std::unique_ptr<MemoryMappedFile> mappedFile;
+    const char* fileTable = nullptr;
+    const char* blacklistTable = nullptr;
+    const char* strings = nullptr;
+    size_t stringsSize = 0;
+    int numTypes = -1, numFiles = -1, numBlacklisted = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (KnownPluginListCache)
+};
+
+} // namespace juce
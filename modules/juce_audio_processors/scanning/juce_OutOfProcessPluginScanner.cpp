@@ -0,0 +1,343 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+namespace juce
+{
+
+//==============================================================================
+/*  A single worker process, which scans one plugin at a time.
+
+    Requests are a format name and a file or identifier, written as two strings.
+    Responses are a LIST element containing the XML for each description found.
+*/
+class OutOfProcessPluginScanner::Worker final : private ChildProcessCoordinator
+{
+public:
+    enum class Outcome
+    {
+        succeeded,
+        failed,
+        cancelled,
+        couldNotLaunch
+    };
+
+    Worker (OutOfProcessPluginScanner& o) : owner (o) {}
+
+    ~Worker() override
+    {
+        killWorkerProcess();
+    }
+
+    Outcome scan (const String& formatName,
+                  const String& fileOrIdentifier,
+                  OwnedArray<PluginDescription>& result,
+                  const std::function<bool()>& shouldExit)
+    {
+        const auto needsLaunch = [&]
+        {
+            const std::lock_guard<std::mutex> lock { mutex };
+            response.reset();
+            gotResponse = false;
+
+            // The process may have died while it was idle
+            return ! isRunning || connectionLost;
+        }();
+
+        if (needsLaunch && ! launch())
+            return Outcome::couldNotLaunch;
+
+        MemoryBlock block;
+
+        {
+            MemoryOutputStream stream { block, false };
+            stream.writeString (formatName);
+            stream.writeString (fileOrIdentifier);
+        }
+
+        if (! sendMessageToWorker (block))
+            return stop (Outcome::failed);
+
+        const auto deadline = Time::getMillisecondCounter() + (uint32) owner.timeoutMs;
+
+        for (;;)
+        {
+            if (shouldExit())
+                return stop (Outcome::cancelled);
+
+            std::unique_lock<std::mutex> lock { mutex };
+
+            if (! condvar.wait_for (lock, std::chrono::milliseconds { 50 }, [&] { return gotResponse || connectionLost; }))
+            {
+                lock.unlock();
+
+                if (Time::getMillisecondCounter() >= deadline)
+                    return stop (Outcome::failed);
+
+                continue;
+            }
+
+            if (connectionLost)
+            {
+                lock.unlock();
+                return stop (Outcome::failed);
+            }
+
+            if (response != nullptr)
+            {
+                for (const auto* item : response->getChildIterator())
+                {
+                    auto desc = std::make_unique<PluginDescription>();
+
+                    if (desc->loadFromXml (*item))
+                        result.add (std::move (desc));
+                }
+            }
+
+            return Outcome::succeeded;
+        }
+    }
+
+    void stop()
+    {
+        killWorkerProcess();
+        isRunning = false;
+    }
+
+private:
+    bool launch()
+    {
+        stop();
+
+        {
+            const std::lock_guard<std::mutex> lock { mutex };
+            connectionLost = false;
+        }
+
+        ++owner.numLaunches;
+        isRunning = launchWorkerProcess (owner.executable, owner.commandLineID, 0, 0);
+        return isRunning;
+    }
+
+    Outcome stop (Outcome outcome)
+    {
+        stop();
+        return outcome;
+    }
+
+    void handleMessageFromWorker (const MemoryBlock& mb) override
+    {
+        const std::lock_guard<std::mutex> lock { mutex };
+        response = parseXML (mb.toString());
+        gotResponse = true;
+        condvar.notify_one();
+    }
+
+    void handleConnectionLost() override
+    {
+        const std::lock_guard<std::mutex> lock { mutex };
+        connectionLost = true;
+        condvar.notify_one();
+    }
+
+    OutOfProcessPluginScanner& owner;
+    bool isRunning = false;
+
+    std::mutex mutex;
+    std::condition_variable condvar;
+    std::unique_ptr<XmlElement> response;
+    bool gotResponse = false, connectionLost = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Worker)
+};
+
+//==============================================================================
+OutOfProcessPluginScanner::OutOfProcessPluginScanner (const File& workerExecutable,
+                                                      const String& commandLineUniqueID,
+                                                      int numWorkers,
+                                                      int timeoutMsPerPlugin)
+    : executable (workerExecutable),
+      commandLineID (commandLineUniqueID),
+      timeoutMs (jmax (1, timeoutMsPerPlugin))
+{
+    for (int i = 0; i < jmax (1, numWorkers); ++i)
+        workers.push_back (std::make_unique<Worker> (*this));
+
+    for (auto& w : workers)
+        idleWorkers.push_back (w.get());
+}
+
+OutOfProcessPluginScanner::~OutOfProcessPluginScanner()
+{
+    // Make sure that all scans have finished before deleting the scanner!
+    jassert (idleWorkers.size() == workers.size());
+}
+
+OutOfProcessPluginScanner::Worker* OutOfProcessPluginScanner::acquireWorker()
+{
+    std::unique_lock<std::mutex> lock { mutex };
+
+    while (idleWorkers.empty())
+    {
+        workerReleased.wait_for (lock, std::chrono::milliseconds { 50 });
+
+        if (shouldExit())
+            return nullptr;
+    }
+
+    auto* worker = idleWorkers.back();
+    idleWorkers.pop_back();
+    return worker;
+}
+
+void OutOfProcessPluginScanner::releaseWorker (Worker& worker)
+{
+    {
+        const std::lock_guard<std::mutex> lock { mutex };
+        idleWorkers.push_back (&worker);
+    }
+
+    workerReleased.notify_one();
+}
+
+bool OutOfProcessPluginScanner::findPluginTypesFor (AudioPluginFormat& format,
+                                                    OwnedArray<PluginDescription>& result,
+                                                    const String& fileOrIdentifier)
+{
+    auto* worker = acquireWorker();
+
+    if (worker == nullptr)
+        return true;
+
+    const auto outcome = worker->scan (format.getName(), fileOrIdentifier, result, [this] { return shouldExit(); });
+    releaseWorker (*worker);
+
+    // If you hit this, the worker executable couldn't be launched, or didn't create a
+    // PluginScannerWorkerProcess with a matching command-line ID.
+    jassert (outcome != Worker::Outcome::couldNotLaunch);
+
+    // Only a crash or a timeout is the plugin's fault, so nothing else should blacklist it
+    return outcome != Worker::Outcome::failed;
+}
+
+void OutOfProcessPluginScanner::scanFinished()
+{
+    const std::lock_guard<std::mutex> lock { mutex };
+
+    for (auto* worker : idleWorkers)
+        worker->stop();
+}
+
+//==============================================================================
+PluginScannerWorkerProcess::PluginScannerWorkerProcess()
+{
+    formatManager.addDefaultFormats();
+}
+
+PluginScannerWorkerProcess::~PluginScannerWorkerProcess()
+{
+    cancelPendingUpdate();
+}
+
+void PluginScannerWorkerProcess::handleMessageFromCoordinator (const MemoryBlock& mb)
+{
+    if (mb.isEmpty())
+        return;
+
+    const std::lock_guard<std::mutex> lock (mutex);
+
+    if (const auto results = doScan (mb); ! results.isEmpty())
+    {
+        sendResults (results);
+    }
+    else
+    {
+        // Some formats can only be scanned on the message thread
+        pendingBlocks.emplace (mb);
+        triggerAsyncUpdate();
+    }
+}
+
+void PluginScannerWorkerProcess::handleConnectionLost()
+{
+    JUCEApplicationBase::quit();
+}
+
+void PluginScannerWorkerProcess::handleAsyncUpdate()
+{
+    for (;;)
+    {
+        const std::lock_guard<std::mutex> lock (mutex);
+
+        if (pendingBlocks.empty())
+            return;
+
+        sendResults (doScan (pendingBlocks.front()));
+        pendingBlocks.pop();
+    }
+}
+
+OwnedArray<PluginDescription> PluginScannerWorkerProcess::doScan (const MemoryBlock& block)
+{
+    MemoryInputStream stream { block, false };
+    const auto formatName = stream.readString();
+    const auto identifier = stream.readString();
+
+    PluginDescription pd;
+    pd.fileOrIdentifier = identifier;
+    pd.uniqueId = pd.deprecatedUid = 0;
+
+    const auto matchingFormat = [&]() -> AudioPluginFormat*
+    {
+        for (auto* format : formatManager.getFormats())
+            if (format->getName() == formatName)
+                return format;
+
+        return nullptr;
+    }();
+
+    OwnedArray<PluginDescription> results;
+
+    if (matchingFormat != nullptr
+        && (MessageManager::getInstance()->isThisTheMessageThread()
+            || matchingFormat->requiresUnblockedMessageThreadDuringCreation (pd)))
+    {
+        matchingFormat->findAllTypesForFile (results, identifier);
+    }
+
+    return results;
+}
+
+void PluginScannerWorkerProcess::sendResults (const OwnedArray<PluginDescription>& results)
+{
+    XmlElement xml ("LIST");
+
+    for (const auto& desc : results)
+        xml.addChildElement (desc->createXml().release());
+
+    const auto str = xml.toString();
+    sendMessageToCoordinator ({ str.toRawUTF8(), str.getNumBytesAsUTF8() });
+}
+
+} // namespace juce
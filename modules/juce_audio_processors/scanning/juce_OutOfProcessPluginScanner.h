@@ -0,0 +1,173 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library.
+   Copyright (c) 2022 - Raw Material Software Limited
+
+   JUCE is an open source library subject to commercial or open-source
+   licensing.
+
+   By using JUCE, you agree to the terms of both the JUCE 7 End-User License
+   Agreement and JUCE Privacy Policy.
+
+   End User License Agreement: www.juce.com/juce-7-licence
+   Privacy Policy: www.juce.com/juce-privacy-policy
+
+   Or: You may also use this code under the terms of the GPL v3 (see
+   www.gnu.org/licenses).
+
+   JUCE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER
+   EXPRESSED OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE
+   DISCLAIMED.
+
+  ==============================================================================
+*/
+
+namespace juce
+{
+
+//==============================================================================
+/**
+    A KnownPluginList::CustomScanner that scans plugins in a pool of child
+    processes.
+
+    Each scan is sent to a worker process, so a plugin that crashes or hangs
+    while it's being scanned can't take down your app. It just gets blacklisted,
+    and the worker that was scanning it is restarted the next time it is needed.
+
+    findPluginTypesFor() may be called from several threads at once, and each
+    call will use a different worker. To scan several plugins in parallel, give
+    the scanner to KnownPluginList::setCustomScanner(), then use the same number
+    of threads as there are workers, e.g. by calling
+    PluginListComponent::setNumberOfThreadsForScanning(). PluginDirectoryScanner
+    adds the results to the list in a fixed order, however many threads are used.
+
+    The worker processes are launched from the executable that you specify, which
+    must create a PluginScannerWorkerProcess at startup and pass it the same
+    command-line ID.
+
+    @see PluginScannerWorkerProcess, PluginDirectoryScanner, ChildProcessCoordinator
+
+    @tags{Audio}
+*/
+class JUCE_API  OutOfProcessPluginScanner  : public KnownPluginList::CustomScanner
+{
+public:
+    //==============================================================================
+    /** Creates a scanner.
+
+        @param workerExecutable         the executable to launch for each worker, which
+                                        will usually be your app's own executable
+        @param commandLineUniqueID      the ID that the workers will pass to
+                                        PluginScannerWorkerProcess::initialiseFromCommandLine()
+        @param numWorkers               the maximum number of worker processes that will be
+                                        running at once. Workers are only launched when needed.
+        @param timeoutMsPerPlugin       if a worker takes longer than this to scan a plugin, it
+                                        is killed, and the plugin is treated as if it had crashed
+    */
+    OutOfProcessPluginScanner (const File& workerExecutable,
+                               const String& commandLineUniqueID,
+                               int numWorkers = SystemStats::getNumCpus(),
+                               int timeoutMsPerPlugin = 60000);
+
+    /** Destructor. Any worker processes that are still running will be killed. */
+    ~OutOfProcessPluginScanner() override;
+
+    //==============================================================================
+    /** Returns the maximum number of workers that will be used at once. */
+    int getNumWorkers() const noexcept          { return (int) workers.size(); }
+
+    /** Returns the number of times a worker process has been launched, including restarts
+        after a crash or timeout.
+    */
+    int getNumWorkerLaunches() const noexcept   { return numLaunches; }
+
+    //==============================================================================
+    /** @internal */
+    bool findPluginTypesFor (AudioPluginFormat&, OwnedArray<PluginDescription>&, const String&) override;
+    /** @internal */
+    void scanFinished() override;
+
+private:
+    //==============================================================================
+    class Worker;
+
+    Worker* acquireWorker();
+    void releaseWorker (Worker&);
+
+    const File executable;
+    const String commandLineID;
+    const int timeoutMs;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<Worker*> idleWorkers;
+    std::mutex mutex;
+    std::condition_variable workerReleased;
+    std::atomic<int> numLaunches { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OutOfProcessPluginScanner)
+};
+
+//==============================================================================
+/**
+    The worker end of an OutOfProcessPluginScanner.
+
+    Create one of these in your main() or JUCEApplication::initialise() function,
+    and call initialiseFromCommandLine(). If that returns true, the process was
+    launched as a scanner worker, and you should keep this object alive instead of
+    starting your app normally. The process will quit when its coordinator goes away.
+
+    @code
+    void initialise (const String& commandLine) override
+    {
+        auto worker = std::make_unique<PluginScannerWorkerProcess>();
+
+        if (worker->initialiseFromCommandLine (commandLine, "myappscanner"))
+        {
+            scannerWorker = std::move (worker);
+            return;
+        }
+
+        // ...carry on starting the app as usual
+    }
+    @endcode
+
+    @see OutOfProcessPluginScanner
+
+    @tags{Audio}
+*/
+class JUCE_API  PluginScannerWorkerProcess  : private ChildProcessWorker,
+                                              private AsyncUpdater
+{
+public:
+    /** Creates a worker that can scan any of the default plugin formats. */
+    PluginScannerWorkerProcess();
+
+    /** Destructor. */
+    ~PluginScannerWorkerProcess() override;
+
+    using ChildProcessWorker::initialiseFromCommandLine;
+
+    /** Returns the format manager that is used to scan plugins. You can add any
+        custom formats to this, as long as they have the same names as the formats
+        that the coordinator is scanning.
+    */
+    AudioPluginFormatManager& getFormatManager() noexcept    { return formatManager; }
+
+private:
+    //==============================================================================
+    void handleMessageFromCoordinator (const MemoryBlock&) override;
+    void handleConnectionLost() override;
+    void handleAsyncUpdate() override;
+
+    OwnedArray<PluginDescription> doScan (const MemoryBlock&);
+    void sendResults (const OwnedArray<PluginDescription>&);
+
+    std::mutex mutex;
+    std::queue<MemoryBlock> pendingBlocks;
+    AudioPluginFormatManager formatManager;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginScannerWorkerProcess)
+};
+
+} // namespace juce
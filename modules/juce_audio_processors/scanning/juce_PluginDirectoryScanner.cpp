@@ -66,8 +66,12 @@ void PluginDirectoryScanner::setFilesOrIdentifiersToScan (const StringArray& fil
             if (crashed == filesOrIdentifiersToScan[j])
                 filesOrIdentifiersToScan.move (j, -1);
 
-    applyBlacklistingsFromDeadMansPedal (list, deadMansPedalFile);
     nextIndex.set (filesOrIdentifiersToScan.size());
+
+    const ScopedLock sl (resultsLock);
+    applyBlacklistingsFromDeadMansPedal (list, deadMansPedalFile);
+    pendingResults.clear();
+    nextIndexToCommit = filesOrIdentifiersToScan.size() - 1;
 }
 
 String PluginDirectoryScanner::getNextPluginFileThatWillBeScanned() const
@@ -88,28 +92,25 @@ bool PluginDirectoryScanner::scanNextFile (bool dontRescanIfAlreadyInList,
     if (index >= 0)
     {
         auto file = filesOrIdentifiersToScan [index];
+        ScanResult result;
 
-        if (file.isNotEmpty() && ! (dontRescanIfAlreadyInList && list.isListingUpToDate (file, format)))
+        if (file.isNotEmpty()
+             && ! (dontRescanIfAlreadyInList && list.isListingUpToDate (file, format))
+             && ! isBlacklisted (file))
         {
             nameOfPluginBeingScanned = format.getNameOfPluginFromIdentifier (file);
 
-            OwnedArray<PluginDescription> typesFound;
-
             // Add this plugin to the end of the dead-man's pedal list in case it crashes...
-            auto crashedPlugins = readDeadMansPedalFile (deadMansPedalFile);
-            crashedPlugins.removeString (file);
-            crashedPlugins.add (file);
-            setDeadMansPedalFile (crashedPlugins);
+            updateDeadMansPedalFile (file, true);
 
-            list.scanAndAddFile (file, dontRescanIfAlreadyInList, typesFound, format);
+            result.wasScanned = true;
+            result.loadedWithoutCrashing = list.findTypesForFile (file, format, result.typesFound);
 
             // Managed to load without crashing, so remove it from the dead-man's-pedal..
-            crashedPlugins.removeString (file);
-            setDeadMansPedalFile (crashedPlugins);
-
-            if (typesFound.size() == 0 && ! list.getBlacklistedFiles().contains (file))
-                failedFiles.add (file);
+            updateDeadMansPedalFile (file, false);
         }
+
+        commitResult (index, std::move (result));
     }
 
     updateProgress();
@@ -118,8 +119,71 @@ bool PluginDirectoryScanner::scanNextFile (bool dontRescanIfAlreadyInList,
 
 bool PluginDirectoryScanner::skipNextFile()
 {
+    const int index = --nextIndex;
+
+    if (index >= 0)
+        commitResult (index, {});
+
     updateProgress();
-    return --nextIndex > 0;
+    return index > 0;
+}
+
+bool PluginDirectoryScanner::isBlacklisted (const String& file) const
+{
+    // Other scanning threads may be adding to the blacklist in commitResult()
+    const ScopedLock sl (resultsLock);
+    return list.getBlacklistedFiles().contains (file);
+}
+
+void PluginDirectoryScanner::commitResult (int index, ScanResult result)
+{
+    const ScopedLock sl (resultsLock);
+
+    pendingResults.emplace (index, std::move (result));
+
+    // Files are scanned from the end of the list to the start, so results are only added
+    // once every file after them has been dealt with. This keeps the contents of the list
+    // the same no matter how many threads are scanning, or which scans finish first.
+    for (auto it = pendingResults.find (nextIndexToCommit); it != pendingResults.end(); it = pendingResults.find (nextIndexToCommit))
+    {
+        const auto& file = filesOrIdentifiersToScan[it->first];
+        auto& pending = it->second;
+
+        if (! pending.loadedWithoutCrashing)
+            list.addToBlacklist (file);
+
+        for (auto* desc : pending.typesFound)
+        {
+            if (desc == nullptr)
+            {
+                jassertfalse;
+                continue;
+            }
+
+            list.addType (*desc);
+        }
+
+        if (pending.wasScanned && pending.typesFound.isEmpty() && ! list.getBlacklistedFiles().contains (file))
+            failedFiles.add (file);
+
+        pendingResults.erase (it);
+        --nextIndexToCommit;
+    }
+}
+
+void PluginDirectoryScanner::updateDeadMansPedalFile (const String& file, bool isBeingScanned)
+{
+    // Several threads may be scanning at once, so each read-modify-write of the file has to
+    // finish before the next one starts, or one thread could drop another thread's entry
+    const ScopedLock sl (deadMansPedalLock);
+
+    auto crashedPlugins = readDeadMansPedalFile (deadMansPedalFile);
+    crashedPlugins.removeString (file);
+
+    if (isBeingScanned)
+        crashedPlugins.add (file);
+
+    setDeadMansPedalFile (crashedPlugins);
 }
 
 void PluginDirectoryScanner::setDeadMansPedalFile (const StringArray& newContents)
@@ -136,4 +200,164 @@ void PluginDirectoryScanner::applyBlacklistingsFromDeadMansPedal (KnownPluginLis
         list.addToBlacklist (crashedPlugin);
 }
 
+//==============================================================================
+//==============================================================================
+#if JUCE_UNIT_TESTS
+
+class PluginDirectoryScannerTests final : public UnitTest
+{
+public:
+    PluginDirectoryScannerTests()
+        : UnitTest ("PluginDirectoryScanner", UnitTestCategories::audioProcessors)
+    {}
+
+    void runTest() override
+    {
+        ScopedJuceInitialiser_GUI scopedJuceInitialiser;
+
+        beginTest ("Results are added in the same order however many threads are scanning");
+        {
+            const auto sequential = scanWithThreads (1);
+
+            expectEquals (sequential.types.size(), 40);
+            expect (sequential.blacklisted == StringArray { "file40", "file30", "file20", "file10", "file0" });
+            expectEquals (sequential.failed.size(), 5);
+
+            for (const auto numThreads : { 2, 4, 8 })
+            {
+                const auto parallel = scanWithThreads (numThreads);
+
+                expect (parallel.types == sequential.types);
+                expect (parallel.blacklisted == sequential.blacklisted);
+                expect (parallel.failed == sequential.failed);
+            }
+        }
+
+        beginTest ("The dead-man's pedal lists every plugin that's being scanned");
+        {
+            const TemporaryFile deadMansPedal;
+            const auto results = scanWithThreads (8, deadMansPedal.getFile());
+
+            expectEquals (results.numMissingFromDeadMansPedal, 0);
+            expect (readDeadMansPedalFile (deadMansPedal.getFile()).isEmpty());
+        }
+    }
+
+private:
+    /*  Files ending in 5 contain no plugins, and files ending in 0 crash the scanner. */
+    struct FakeFormat final : public AudioPluginFormat
+    {
+        String getName() const override { return "Fake"; }
+
+        void findAllTypesForFile (OwnedArray<PluginDescription>& results, const String& file) override
+        {
+            if (file.endsWith ("5"))
+                return;
+
+            auto desc = std::make_unique<PluginDescription>();
+            desc->name = desc->fileOrIdentifier = file;
+            desc->pluginFormatName = getName();
+            desc->uniqueId = file.hashCode();
+            results.add (std::move (desc));
+        }
+
+        bool fileMightContainThisPluginType (const String&) override                       { return true; }
+        String getNameOfPluginFromIdentifier (const String& file) override                 { return file; }
+        bool pluginNeedsRescanning (const PluginDescription&) override                     { return false; }
+        bool doesPluginStillExist (const PluginDescription&) override                      { return true; }
+        bool canScanForPlugins() const override                                            { return true; }
+        bool isTrivialToScan() const override                                              { return true; }
+        StringArray searchPathsForPlugins (const FileSearchPath&, bool, bool) override     { return {}; }
+        FileSearchPath getDefaultLocationsToSearch() override                              { return {}; }
+        bool requiresUnblockedMessageThreadDuringCreation (const PluginDescription&) const override { return false; }
+
+        void createPluginInstance (const PluginDescription&, double, int, PluginCreationCallback callback) override
+        {
+            callback (nullptr, "not supported");
+        }
+    };
+
+    /*  Finishes scans in an unpredictable order, to check that this doesn't affect the results.
+        If there's a dead-man's pedal file, it also checks that each file is listed in it while
+        it's being scanned.
+    */
+    struct SlowScanner final : public KnownPluginList::CustomScanner
+    {
+        SlowScanner (const File& pedal, std::atomic<int>& numMissing)
+            : deadMansPedal (pedal), numMissingFromDeadMansPedal (numMissing) {}
+
+        bool findPluginTypesFor (AudioPluginFormat& format, OwnedArray<PluginDescription>& result, const String& file) override
+        {
+            if (deadMansPedal != File() && ! readDeadMansPedalFile (deadMansPedal).contains (file))
+                ++numMissingFromDeadMansPedal;
+
+            Thread::sleep (Random::getSystemRandom().nextInt (3));
+
+            if (file.endsWith ("0"))
+                return false;
+
+            format.findAllTypesForFile (result, file);
+            return true;
+        }
+
+        const File deadMansPedal;
+        std::atomic<int>& numMissingFromDeadMansPedal;
+    };
+
+    struct Results
+    {
+        StringArray types, blacklisted, failed;
+        int numMissingFromDeadMansPedal = 0;
+    };
+
+    static Results scanWithThreads (int numThreads, const File& deadMansPedal = {})
+    {
+        FakeFormat format;
+        KnownPluginList list;
+        std::atomic<int> numMissingFromDeadMansPedal { 0 };
+        list.setCustomScanner (std::make_unique<SlowScanner> (deadMansPedal, numMissingFromDeadMansPedal));
+
+        StringArray files;
+
+        for (int i = 0; i < 50; ++i)
+            files.add ("file" + String (i));
+
+        Results results;
+
+        {
+            PluginDirectoryScanner scanner (list, format, {}, false, deadMansPedal);
+            scanner.setFilesOrIdentifiersToScan (files);
+
+            std::vector<std::thread> threads;
+
+            for (int i = 0; i < numThreads; ++i)
+            {
+                threads.emplace_back ([&scanner]
+                {
+                    String name;
+
+                    while (scanner.scanNextFile (true, name))
+                    {}
+                });
+            }
+
+            for (auto& t : threads)
+                t.join();
+
+            results.failed = scanner.getFailedFiles();
+        }
+
+        for (const auto& desc : list.getTypes())
+            results.types.add (desc.name);
+
+        results.blacklisted = list.getBlacklistedFiles();
+        results.numMissingFromDeadMansPedal = numMissingFromDeadMansPedal;
+        return results;
+    }
+};
+
+static PluginDirectoryScannerTests pluginDirectoryScannerTests;
+
+#endif
+
 } // namespace juce
@@ -33,6 +33,13 @@ namespace juce
     To use one of these, create it and call scanNextFile() repeatedly, until
     it returns false.
 
+    scanNextFile() may be called from several threads at once, which is most
+    useful in combination with a KnownPluginList::CustomScanner that scans
+    plugins in other processes, such as OutOfProcessPluginScanner. However many
+    threads are used, the results are added to the KnownPluginList in the same
+    order as they would be by a single thread. The list's blacklist must not be
+    changed by anything else while a scan is in progress.
+
     @tags{Audio}
 */
 class JUCE_API  PluginDirectoryScanner
@@ -81,6 +88,8 @@ public:
 
     /** Tries the next likely-looking file.
 
+        This may be called from several threads at once.
+
         If dontRescanIfAlreadyInList is true, then the file will only be loaded and
         re-tested if it's not already in the list, or if the file's modification
         time has changed since the list was created. If dontRescanIfAlreadyInList is
@@ -120,6 +129,12 @@ public:
 
 private:
     //==============================================================================
+    struct ScanResult
+    {
+        OwnedArray<PluginDescription> typesFound;
+        bool wasScanned = false, loadedWithoutCrashing = true;
+    };
+
     KnownPluginList& list;
     AudioPluginFormat& format;
     StringArray filesOrIdentifiersToScan;
@@ -129,8 +144,15 @@ private:
     std::atomic<float> progress { 0.0f };
     const bool allowAsync;
 
+    CriticalSection resultsLock, deadMansPedalLock;
+    std::map<int, ScanResult> pendingResults;
+    int nextIndexToCommit = -1;
+
     void updateProgress();
     void setDeadMansPedalFile (const StringArray& newContents);
+    void updateDeadMansPedalFile (const String& file, bool isBeingScanned);
+    bool isBlacklisted (const String& file) const;
+    void commitResult (int index, ScanResult result);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginDirectoryScanner)
 };
@@ -59,6 +59,87 @@ void AudioProcessorValueTreeState::Parameter::valueChanged (float newValue)
     NullCheckedInvocation::invoke (onValueChanged);
 }
 
+//==============================================================================
+/*  Keeps one flag per parameter adapter, which is raised whenever that parameter's
+    value changes. Raising a flag is lock-free, so it can happen on the audio thread,
+    and lets the flush visit only the parameters that have actually changed rather
+    than walking every adapter.
+
+    Adapters must all be added before any of the flags can be raised concurrently,
+    which is the same restriction that applies to adding parameters in general.
+*/
+class AudioProcessorValueTreeState::DirtyParameterSet
+{
+public:
+    size_t add (ParameterAdapter& adapter)
+    {
+        const auto index = adapters.size();
+        adapters.push_back (&adapter);
+
+        const auto numWordsNeeded = (adapters.size() + bitsPerWord - 1) / bitsPerWord;
+
+        if (numWordsNeeded > numWords)
+        {
+            auto newFlags = std::make_unique<std::atomic<uint64>[]> (numWordsNeeded);
+
+            for (size_t i = 0; i < numWords; ++i)
+                newFlags[i] = flags[i].load();
+
+            for (auto i = numWords; i < numWordsNeeded; ++i)
+                newFlags[i] = 0;
+
+            flags = std::move (newFlags);
+            numWords = numWordsNeeded;
+        }
+
+        // New adapters always need to be written to the tree at least once
+        markDirty (index);
+        return index;
+    }
+
+    void markDirty (size_t index) noexcept
+    {
+        jassert (index < adapters.size());
+        flags[index / bitsPerWord].fetch_or ((uint64) 1 << (index % bitsPerWord), std::memory_order_release);
+    }
+
+    /*  Clears all of the flags, calling fn (adapter, index) for each one that was set. */
+    template <typename Fn>
+    void takeDirty (Fn&& fn)
+    {
+        for (size_t word = 0; word < numWords; ++word)
+        {
+            if (flags[word].load (std::memory_order_relaxed) == 0)
+                continue;
+
+            for (auto bits = flags[word].exchange (0, std::memory_order_acquire); bits != 0; bits &= bits - 1)
+            {
+                const auto index = word * bitsPerWord + (size_t) countTrailingZeros (bits);
+                fn (*adapters[index], index);
+            }
+        }
+    }
+
+    ParameterAdapter& getAdapter (size_t index) const noexcept    { return *adapters[index]; }
+
+private:
+    static int countTrailingZeros (uint64 bits) noexcept
+    {
+        int result = 0;
+
+        for (; (bits & 0xffffffff) == 0; bits >>= 32)  result += 32;
+        for (; (bits & 1) == 0; bits >>= 1)            ++result;
+
+        return result;
+    }
+
+    static constexpr size_t bitsPerWord = 64;
+
+    std::vector<ParameterAdapter*> adapters;
+    std::unique_ptr<std::atomic<uint64>[]> flags;
+    size_t numWords = 0;
+};
+
 //==============================================================================
 class AudioProcessorValueTreeState::ParameterAdapter final : private AudioProcessorParameter::Listener
 {
@@ -108,6 +189,12 @@ public:
     float getDenormalisedValue() const                { return unnormalisedValue; }
     std::atomic<float>& getRawDenormalisedValue()     { return unnormalisedValue; }
 
+    void setDirtyParameterSet (DirtyParameterSet& set, size_t index)
+    {
+        dirtySet = &set;
+        dirtyIndex = index;
+    }
+
     bool flushToTree (const Identifier& key, UndoManager* um)
     {
         auto needsUpdateTestValue = true;
@@ -147,6 +234,9 @@ private:
         listeners.call ([this] (Listener& l) { l.parameterChanged (parameter.paramID, unnormalisedValue); });
         listenersNeedCalling = false;
         needsUpdate = true;
+
+        if (dirtySet != nullptr)
+            dirtySet->markDirty (dirtyIndex);
     }
 
     float denormalise (float normalised) const
@@ -199,6 +289,8 @@ private:
     std::atomic<float> unnormalisedValue { 0.0f };
     std::atomic<bool> needsUpdate { true }, listenersNeedCalling { true };
     bool ignoreParameterChangedCallbacks { false };
+    DirtyParameterSet* dirtySet = nullptr;
+    size_t dirtyIndex = 0;
 };
 
 //==============================================================================
@@ -260,7 +352,7 @@ AudioProcessorValueTreeState::AudioProcessorValueTreeState (AudioProcessor& proc
 }
 
 AudioProcessorValueTreeState::AudioProcessorValueTreeState (AudioProcessor& p, UndoManager* um)
-    : processor (p), undoManager (um)
+    : processor (p), undoManager (um), dirtyParameters (std::make_unique<DirtyParameterSet>())
 {
     startTimerHz (10);
     state.addListener (this);
@@ -323,7 +415,13 @@ RangedAudioParameter* AudioProcessorValueTreeState::createAndAddParameter (std::
 //==============================================================================
 void AudioProcessorValueTreeState::addParameterAdapter (RangedAudioParameter& param)
 {
-    adapterTable.emplace (param.paramID, std::make_unique<ParameterAdapter> (param));
+    const auto [iter, inserted] = adapterTable.emplace (param.paramID, std::make_unique<ParameterAdapter> (param));
+
+    if (inserted)
+    {
+        auto& adapter = *iter->second;
+        adapter.setDirtyParameterSet (*dirtyParameters, dirtyParameters->add (adapter));
+    }
 }
 
 AudioProcessorValueTreeState::ParameterAdapter* AudioProcessorValueTreeState::getParameterAdapter (StringRef paramID) const
@@ -344,6 +442,18 @@ void AudioProcessorValueTreeState::removeParameterListener (StringRef paramID, L
         p->removeListener (listener);
 }
 
+void AudioProcessorValueTreeState::addBatchedListener (BatchedListener* listener)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    batchedListeners.add (listener);
+}
+
+void AudioProcessorValueTreeState::removeBatchedListener (BatchedListener* listener)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    batchedListeners.remove (listener);
+}
+
 Value AudioProcessorValueTreeState::getParameterAsValue (StringRef paramID) const
 {
     if (auto* adapter = getParameterAdapter (paramID))
@@ -454,15 +564,40 @@ bool AudioProcessorValueTreeState::flushParameterValuesToValueTree()
 
     bool anyUpdated = false;
 
-    for (auto& p : adapterTable)
-        anyUpdated |= p.second->flushToTree (valuePropertyID, undoManager);
+    dirtyParameters->takeDirty ([&] (ParameterAdapter& adapter, size_t index)
+    {
+        if (adapter.flushToTree (valuePropertyID, undoManager))
+        {
+            anyUpdated = true;
+            parametersAwaitingNotification.setBit ((int) index);
+        }
+    });
 
     return anyUpdated;
 }
 
+void AudioProcessorValueTreeState::callBatchedListeners()
+{
+    StringArray changedIDs;
+
+    {
+        ScopedLock lock (valueTreeChanging);
+
+        if (! batchedListeners.isEmpty())
+            for (auto i = parametersAwaitingNotification.findNextSetBit (0); i >= 0; i = parametersAwaitingNotification.findNextSetBit (i + 1))
+                changedIDs.add (dirtyParameters->getAdapter ((size_t) i).getParameter().paramID);
+
+        parametersAwaitingNotification.clear();
+    }
+
+    if (! changedIDs.isEmpty())
+        batchedListeners.call ([&] (BatchedListener& l) { l.parametersChanged (changedIDs); });
+}
+
 void AudioProcessorValueTreeState::timerCallback()
 {
     auto anythingUpdated = flushParameterValuesToValueTree();
+    callBatchedListeners();
 
     startTimer (anythingUpdated ? 1000 / 50
                                 : jlimit (50, 500, getTimerInterval() + 20));
@@ -649,6 +784,18 @@ private:
         float value{};
     };
 
+    struct BatchedListener final : public AudioProcessorValueTreeState::BatchedListener
+    {
+        void parametersChanged (const StringArray& idsIn) override
+        {
+            ids = idsIn;
+            ++numCalls;
+        }
+
+        StringArray ids;
+        int numCalls = 0;
+    };
+
 public:
     AudioProcessorValueTreeStateTests()
         : UnitTest ("Audio Processor Value Tree State", UnitTestCategories::audioProcessorParameters)
@@ -977,6 +1124,54 @@ public:
             expectEquals (listener.value, newValue);
             expectEquals (listener.id, String (key));
         }
+
+        beginTest ("Only changed parameters are flushed, and batched listeners are told which ones changed");
+        {
+            ParameterLayout layout;
+
+            for (int i = 0; i < 200; ++i)
+                layout.add (std::make_unique<Parameter> (ParameterID { "p" + String (i), 1 }, String(), NormalisableRange<float>(), 0.0f));
+
+            TestAudioProcessor proc (std::move (layout));
+            BatchedListener listener;
+            proc.state.addBatchedListener (&listener);
+
+            // The first flush reports every parameter, as they've all been added to the tree
+            proc.state.timerCallback();
+            expectEquals (listener.numCalls, 1);
+            expectEquals (listener.ids.size(), 200);
+            listener.numCalls = 0;
+
+            const auto setValue = [&] (const String& key, float value)
+            {
+                proc.state.getParameter (key)->setValueNotifyingHost (value);
+            };
+
+            setValue ("p3", 0.25f);
+            setValue ("p150", 0.5f);
+            setValue ("p3", 0.75f);
+
+            expect (proc.state.flushParameterValuesToValueTree());
+            expect (! proc.state.flushParameterValuesToValueTree());
+
+            expectEquals ((float) proc.state.state.getChildWithProperty ("id", "p3").getProperty ("value"), 0.75f);
+            expectEquals ((float) proc.state.state.getChildWithProperty ("id", "p150").getProperty ("value"), 0.5f);
+            expectEquals ((float) proc.state.state.getChildWithProperty ("id", "p151").getProperty ("value"), 0.0f);
+
+            proc.state.timerCallback();
+            expectEquals (listener.numCalls, 1);
+            expect (listener.ids == StringArray { "p3", "p150" });
+
+            proc.state.timerCallback();
+            expectEquals (listener.numCalls, 1);
+
+            proc.state.getParameterAsValue ("p199") = 0.125f;
+            proc.state.timerCallback();
+            expectEquals (listener.numCalls, 2);
+            expect (listener.ids == StringArray { "p199" });
+
+            proc.state.removeBatchedListener (&listener);
+        }
     }
     JUCE_END_IGNORE_WARNINGS_MSVC
 };
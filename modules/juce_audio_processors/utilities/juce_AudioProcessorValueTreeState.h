@@ -359,6 +359,31 @@ public:
     /** Removes a callback that was previously added with addParameterCallback(). */
     void removeParameterListener (StringRef parameterID, Listener* listener);
 
+    //==============================================================================
+    /** A listener class that is told about many parameter changes at once.
+
+        Unlike Listener, which is called synchronously on whichever thread changed the
+        parameter, a BatchedListener is called on the message thread after pending
+        parameter values have been copied into the state. Each call contains the IDs of
+        every parameter that changed since the previous call, so a UI that needs to
+        refresh when parameters change only has to do so once per batch.
+
+        Use AudioProcessorValueTreeState::addBatchedListener() to register a callback.
+    */
+    struct JUCE_API  BatchedListener
+    {
+        virtual ~BatchedListener() = default;
+
+        /** Called on the message thread with the IDs of the parameters that have changed. */
+        virtual void parametersChanged (const StringArray& parameterIDs) = 0;
+    };
+
+    /** Registers a listener that will be told about parameter changes in batches. */
+    void addBatchedListener (BatchedListener* listener);
+
+    /** Removes a listener that was previously added with addBatchedListener(). */
+    void removeBatchedListener (BatchedListener* listener);
+
     //==============================================================================
     /** Returns a Value object that can be used to control a particular parameter. */
     Value getParameterAsValue (StringRef parameterID) const;
@@ -413,6 +438,7 @@ public:
 private:
     //==============================================================================
     class ParameterAdapter;
+    class DirtyParameterSet;
 
 public:
     //==============================================================================
@@ -629,12 +655,14 @@ private:
     //==============================================================================
    #if JUCE_UNIT_TESTS
     friend struct ParameterAdapterTests;
+    friend class AudioProcessorValueTreeStateTests;
    #endif
 
     void addParameterAdapter (RangedAudioParameter&);
     ParameterAdapter* getParameterAdapter (StringRef) const;
 
     bool flushParameterValuesToValueTree();
+    void callBatchedListeners();
     void setNewState (ValueTree);
     void timerCallback() override;
 
@@ -651,6 +679,10 @@ private:
     };
 
     std::map<StringRef, std::unique_ptr<ParameterAdapter>, StringRefLessThan> adapterTable;
+    std::unique_ptr<DirtyParameterSet> dirtyParameters;
+
+    ListenerList<BatchedListener> batchedListeners;
+    BigInteger parametersAwaitingNotification;
 
     CriticalSection valueTreeChanging;
 
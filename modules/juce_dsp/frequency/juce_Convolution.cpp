@@ -70,6 +70,74 @@ private:
     std::vector<Element> storage;
 };
 
+class ConvolutionStage;
+
+// Runs the pending jobs of ConvolutionStages on a background thread. A single worker is
+// shared by all of the engines created by the Convolutions that use the same message
+// queue, and its thread is only started once an engine needs it.
+class ConvolutionWorker : private Thread
+{
+public:
+    ConvolutionWorker() : Thread ("Convolution tail worker") {}
+
+    ~ConvolutionWorker() override
+    {
+        stopThread (-1);
+    }
+
+    // Starts the worker's thread, if it isn't already running.
+    // Never call this from the audio thread.
+    void start()
+    {
+        const ScopedLock lock (startLock);
+
+        if (! isThreadRunning())
+            startThread (Priority::highest);
+    }
+
+    // Asks the worker to run a stage's pending job. This function doesn't allocate,
+    // but waking the worker may briefly take a lock.
+    // If there's no room for the job, the stage will run it on the calling thread
+    // when its result is needed.
+    void jobAdded (ConvolutionStage& stage)
+    {
+        for (auto& slot : slots)
+        {
+            ConvolutionStage* expected = nullptr;
+
+            if (slot.compare_exchange_strong (expected, &stage))
+            {
+                notify();
+                return;
+            }
+        }
+    }
+
+    // After this returns, the worker will never access the stage again.
+    // This doesn't wait for the worker's thread to stop, but it will wait for the
+    // worker to finish a job if it's currently running one for this stage.
+    void removeStage (ConvolutionStage& stage)
+    {
+        for (auto& slot : slots)
+        {
+            auto* expected = &stage;
+            slot.compare_exchange_strong (expected, nullptr);
+        }
+
+        while (stageInUse == &stage)
+            Thread::yield();
+    }
+
+private:
+    void run() override;
+
+    std::array<std::atomic<ConvolutionStage*>, 256> slots {};
+    std::atomic<ConvolutionStage*> stageInUse { nullptr };
+    CriticalSection startLock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ConvolutionWorker)
+};
+
 class BackgroundMessageQueue : private Thread
 {
 public:
@@ -93,6 +161,8 @@ public:
     using Thread::startThread;
     using Thread::stopThread;
 
+    ConvolutionWorker& getWorker() noexcept { return worker; }
+
 private:
     void run() override
     {
@@ -114,6 +184,8 @@ private:
         }
     }
 
+    // The queue may still hold engines waiting to be deleted, which use the worker
+    ConvolutionWorker worker;
     CriticalSection popMutex;
     Queue<IncomingCommand> queue;
 
@@ -143,6 +215,43 @@ ConvolutionMessageQueue::~ConvolutionMessageQueue() noexcept
 ConvolutionMessageQueue::ConvolutionMessageQueue (ConvolutionMessageQueue&&) noexcept = default;
 ConvolutionMessageQueue& ConvolutionMessageQueue::operator= (ConvolutionMessageQueue&&) noexcept = default;
 
+//==============================================================================
+// Holds a number of equally-sized buffers of frequency-domain data. Each buffer
+// starts on a SIMD-aligned boundary, so that the spectra can be processed with
+// full-width SIMDRegister loads and stores.
+class FrequencyDomainBuffers
+{
+public:
+    FrequencyDomainBuffers (size_t numBuffersIn, size_t numSamplesIn)
+        : numBuffers (numBuffersIn),
+          stride ((numSamplesIn + alignment - 1) / alignment * alignment),
+          storage (numBuffers * stride + alignment)
+    {
+        alignedData = snapPointerToAlignment (storage.get(), alignment * sizeof (float));
+        clear();
+    }
+
+    float* get (size_t index) const noexcept
+    {
+        jassert (index < numBuffers);
+        return alignedData + index * stride;
+    }
+
+    void clear() noexcept                { FloatVectorOperations::clear (alignedData, static_cast<int> (numBuffers * stride)); }
+    size_t size() const noexcept         { return numBuffers; }
+
+private:
+   #if JUCE_USE_SIMD
+    static constexpr size_t alignment = SIMDRegister<float>::SIMDNumElements;
+   #else
+    static constexpr size_t alignment = 1;
+   #endif
+
+    size_t numBuffers, stride;
+    HeapBlock<float> storage;
+    float* alignedData = nullptr;
+};
+
 //==============================================================================
 struct ConvolutionEngine
 {
@@ -155,44 +264,33 @@ struct ConvolutionEngine
           numSegments (numSamples / (fftSize - blockSize) + 1u),
           numInputSegments ((blockSize > 128 ? numSegments : 3 * numSegments)),
           bufferInput      (1, static_cast<int> (fftSize)),
-          bufferOutput     (1, static_cast<int> (fftSize * 2)),
-          bufferTempOutput (1, static_cast<int> (fftSize * 2)),
-          bufferOverlap    (1, static_cast<int> (fftSize))
+          bufferOverlap    (1, static_cast<int> (fftSize)),
+          bufferOutput     (1, fftSize * 2),
+          bufferTempOutput (1, fftSize * 2),
+          buffersInputSegments   (numInputSegments, fftSize * 2),
+          buffersImpulseSegments (numSegments,      fftSize * 2)
     {
-        bufferOutput.clear();
-
-        auto updateSegmentsIfNecessary = [this] (size_t numSegmentsToUpdate,
-                                                 std::vector<AudioBuffer<float>>& segments)
-        {
-            if (numSegmentsToUpdate == 0
-                || numSegmentsToUpdate != (size_t) segments.size()
-                || (size_t) segments[0].getNumSamples() != fftSize * 2)
-            {
-                segments.clear();
-
-                for (size_t i = 0; i < numSegmentsToUpdate; ++i)
-                    segments.push_back ({ 1, static_cast<int> (fftSize * 2) });
-            }
-        };
-
-        updateSegmentsIfNecessary (numInputSegments, buffersInputSegments);
-        updateSegmentsIfNecessary (numSegments,      buffersImpulseSegments);
-
         auto FFTTempObject = std::make_unique<FFT> (roundToInt (std::log2 (fftSize)));
         size_t currentPtr = 0;
 
-        for (auto& buf : buffersImpulseSegments)
+        for (size_t segment = 0; segment < numSegments; ++segment)
         {
-            buf.clear();
-
-            auto* impulseResponse = buf.getWritePointer (0);
+            auto* impulseResponse = buffersImpulseSegments.get (segment);
 
-            if (&buf == &buffersImpulseSegments.front())
+            if (segment == 0)
                 impulseResponse[0] = 1.0f;
 
+            const auto numSamplesInSegment = jmin (fftSize - blockSize, numSamples - currentPtr);
+
             FloatVectorOperations::copy (impulseResponse,
                                          samples + currentPtr,
-                                         static_cast<int> (jmin (fftSize - blockSize, numSamples - currentPtr)));
+                                         static_cast<int> (numSamplesInSegment));
+
+            if (numLeadingSilentSegments == segment
+                && std::all_of (samples + currentPtr, samples + currentPtr + numSamplesInSegment, [] (float x) { return exactlyEqual (x, 0.0f); }))
+            {
+                ++numLeadingSilentSegments;
+            }
 
             FFTTempObject->performRealOnlyForwardTransform (impulseResponse);
             prepareForConvolution (impulseResponse);
@@ -209,9 +307,7 @@ struct ConvolutionEngine
         bufferOverlap.clear();
         bufferTempOutput.clear();
         bufferOutput.clear();
-
-        for (auto& buf : buffersInputSegments)
-            buf.clear();
+        buffersInputSegments.clear();
 
         currentSegment = 0;
         inputDataPos = 0;
@@ -225,8 +321,8 @@ struct ConvolutionEngine
         auto indexStep = numInputSegments / numSegments;
 
         auto* inputData      = bufferInput.getWritePointer (0);
-        auto* outputTempData = bufferTempOutput.getWritePointer (0);
-        auto* outputData     = bufferOutput.getWritePointer (0);
+        auto* outputTempData = bufferTempOutput.get (0);
+        auto* outputData     = bufferOutput.get (0);
         auto* overlapData    = bufferOverlap.getWritePointer (0);
 
         while (numSamplesProcessed < numSamples)
@@ -236,7 +332,7 @@ struct ConvolutionEngine
 
             FloatVectorOperations::copy (inputData + inputDataPos, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
 
-            auto* inputSegmentData = buffersInputSegments[currentSegment].getWritePointer (0);
+            auto* inputSegmentData = buffersInputSegments.get (currentSegment);
             FloatVectorOperations::copy (inputSegmentData, inputData, static_cast<int> (fftSize));
 
             fftObject->performRealOnlyForwardTransform (inputSegmentData);
@@ -256,17 +352,21 @@ struct ConvolutionEngine
                     if (index >= numInputSegments)
                         index -= numInputSegments;
 
-                    convolutionProcessingAndAccumulate (buffersInputSegments[index].getWritePointer (0),
-                                                        buffersImpulseSegments[i].getWritePointer (0),
+                    if (i < numLeadingSilentSegments)
+                        continue;
+
+                    convolutionProcessingAndAccumulate (buffersInputSegments.get (index),
+                                                        buffersImpulseSegments.get (i),
                                                         outputTempData);
                 }
             }
 
             FloatVectorOperations::copy (outputData, outputTempData, static_cast<int> (fftSize + 1));
 
-            convolutionProcessingAndAccumulate (inputSegmentData,
-                                                buffersImpulseSegments.front().getWritePointer (0),
-                                                outputData);
+            if (numLeadingSilentSegments == 0)
+                convolutionProcessingAndAccumulate (inputSegmentData,
+                                                    buffersImpulseSegments.get (0),
+                                                    outputData);
 
             updateSymmetricFrequencyDomainData (outputData);
             fftObject->performRealOnlyInverseTransform (outputData);
@@ -305,8 +405,8 @@ struct ConvolutionEngine
         auto indexStep = numInputSegments / numSegments;
 
         auto* inputData      = bufferInput.getWritePointer (0);
-        auto* outputTempData = bufferTempOutput.getWritePointer (0);
-        auto* outputData     = bufferOutput.getWritePointer (0);
+        auto* outputTempData = bufferTempOutput.get (0);
+        auto* outputData     = bufferOutput.get (0);
         auto* overlapData    = bufferOverlap.getWritePointer (0);
 
         while (numSamplesProcessed < numSamples)
@@ -324,7 +424,7 @@ struct ConvolutionEngine
             if (inputDataPos == blockSize)
             {
                 // Copy input data in input segment
-                auto* inputSegmentData = buffersInputSegments[currentSegment].getWritePointer (0);
+                auto* inputSegmentData = buffersInputSegments.get (currentSegment);
                 FloatVectorOperations::copy (inputSegmentData, inputData, static_cast<int> (fftSize));
 
                 fftObject->performRealOnlyForwardTransform (inputSegmentData);
@@ -342,16 +442,20 @@ struct ConvolutionEngine
                     if (index >= numInputSegments)
                         index -= numInputSegments;
 
-                    convolutionProcessingAndAccumulate (buffersInputSegments[index].getWritePointer (0),
-                                                        buffersImpulseSegments[i].getWritePointer (0),
+                    if (i < numLeadingSilentSegments)
+                        continue;
+
+                    convolutionProcessingAndAccumulate (buffersInputSegments.get (index),
+                                                        buffersImpulseSegments.get (i),
                                                         outputTempData);
                 }
 
                 FloatVectorOperations::copy (outputData, outputTempData, static_cast<int> (fftSize + 1));
 
-                convolutionProcessingAndAccumulate (inputSegmentData,
-                                                    buffersImpulseSegments.front().getWritePointer (0),
-                                                    outputData);
+                if (numLeadingSilentSegments == 0)
+                    convolutionProcessingAndAccumulate (inputSegmentData,
+                                                        buffersImpulseSegments.get (0),
+                                                        outputData);
 
                 updateSymmetricFrequencyDomainData (outputData);
                 fftObject->performRealOnlyInverseTransform (outputData);
@@ -390,9 +494,20 @@ struct ConvolutionEngine
     }
 
     // Does the convolution operation itself only on half of the frequency domain samples.
-    void convolutionProcessingAndAccumulate (const float *input, const float *impulse, float *output)
+    void convolutionProcessingAndAccumulate (const float* input, const float* impulse, float* output) const noexcept
     {
-        auto FFTSizeDiv2 = fftSize / 2;
+       #if JUCE_USE_SIMD
+        multiplyAccumulateSIMD (input, impulse, output, fftSize);
+       #else
+        multiplyAccumulateScalar (input, impulse, output, fftSize);
+       #endif
+    }
+
+    // Accumulates the complex product of two spectra, which have been split into planes of
+    // real and imaginary parts by prepareForConvolution, using four passes over the data.
+    static void multiplyAccumulateScalar (const float* input, const float* impulse, float* output, size_t size) noexcept
+    {
+        const auto FFTSizeDiv2 = size / 2;
 
         FloatVectorOperations::addWithMultiply      (output, input, impulse, static_cast<int> (FFTSizeDiv2));
         FloatVectorOperations::subtractWithMultiply (output, &(input[FFTSizeDiv2]), &(impulse[FFTSizeDiv2]), static_cast<int> (FFTSizeDiv2));
@@ -400,9 +515,50 @@ struct ConvolutionEngine
         FloatVectorOperations::addWithMultiply      (&(output[FFTSizeDiv2]), input, &(impulse[FFTSizeDiv2]), static_cast<int> (FFTSizeDiv2));
         FloatVectorOperations::addWithMultiply      (&(output[FFTSizeDiv2]), &(input[FFTSizeDiv2]), impulse, static_cast<int> (FFTSizeDiv2));
 
-        output[fftSize] += input[fftSize] * impulse[fftSize];
+        output[size] += input[size] * impulse[size];
     }
 
+   #if JUCE_USE_SIMD
+    // Does the same as multiplyAccumulateScalar, but computes the real and imaginary parts
+    // in a single pass, so that each value is only loaded and stored once.
+    // All pointers must be SIMD-aligned.
+    static void multiplyAccumulateSIMD (const float* input, const float* impulse, float* output, size_t size) noexcept
+    {
+        using Register = SIMDRegister<float>;
+
+        const auto FFTSizeDiv2 = size / 2;
+
+        if (FFTSizeDiv2 % Register::size() != 0)
+        {
+            multiplyAccumulateScalar (input, impulse, output, size);
+            return;
+        }
+
+        const auto* inputImag   = input   + FFTSizeDiv2;
+        const auto* impulseImag = impulse + FFTSizeDiv2;
+        auto* outputImag        = output  + FFTSizeDiv2;
+
+        for (size_t i = 0; i < FFTSizeDiv2; i += Register::size())
+        {
+            const auto inRe = Register::fromRawArray (input + i);
+            const auto inIm = Register::fromRawArray (inputImag + i);
+            const auto irRe = Register::fromRawArray (impulse + i);
+            const auto irIm = Register::fromRawArray (impulseImag + i);
+
+            auto outRe = Register::fromRawArray (output + i);
+            auto outIm = Register::fromRawArray (outputImag + i);
+
+            outRe = Register::multiplyAdd (outRe, inRe, irRe) - inIm * irIm;
+            outIm = Register::multiplyAdd (Register::multiplyAdd (outIm, inRe, irIm), inIm, irRe);
+
+            outRe.copyToRawArray (output + i);
+            outIm.copyToRawArray (outputImag + i);
+        }
+
+        output[size] += input[size] * impulse[size];
+    }
+   #endif
+
     // Undoes the re-organization of samples from the function prepareForConvolution.
     // Then takes the conjugate of the frequency domain first half of samples to fill the
     // second half, so that the inverse transform will return real samples in the time domain.
@@ -433,10 +589,170 @@ struct ConvolutionEngine
     const size_t numInputSegments;
     size_t currentSegment = 0, inputDataPos = 0;
 
-    AudioBuffer<float> bufferInput, bufferOutput, bufferTempOutput, bufferOverlap;
-    std::vector<AudioBuffer<float>> buffersInputSegments, buffersImpulseSegments;
+    // Segments at the start of the IR which are completely silent don't need to be processed
+    size_t numLeadingSilentSegments = 0;
+
+    AudioBuffer<float> bufferInput, bufferOverlap;
+    FrequencyDomainBuffers bufferOutput, bufferTempOutput;
+    FrequencyDomainBuffers buffersInputSegments, buffersImpulseSegments;
+};
+
+//==============================================================================
+// A single stage of a multi-stage non-uniform partitioned convolution.
+//
+// Each stage owns a uniformly-partitioned engine which processes one period of
+// blockSize samples at a time. Once a full period of input has been collected,
+// it is handed to a job which may either be run straight away, or picked up by
+// a background ConvolutionWorker. The result of that job is only needed at the
+// end of the following period, so the worker has a whole period in which to
+// complete it. This means that each stage adds a total delay of 2 * blockSize
+// samples, which must be accounted for when choosing the stage's IR segment.
+class ConvolutionStage
+{
+public:
+    ConvolutionStage (const float* samples,
+                      size_t numSamples,
+                      size_t numLeadingZeros,
+                      size_t blockSizeIn)
+        : engine (makePaddedEngine (samples, numSamples, numLeadingZeros, blockSizeIn)),
+          blockSize (blockSizeIn),
+          bufferInput     (1, static_cast<int> (blockSize)),
+          bufferOutput    (1, static_cast<int> (blockSize)),
+          bufferJobInput  (1, static_cast<int> (blockSize)),
+          bufferJobOutput (1, static_cast<int> (blockSize))
+    {
+        reset();
+    }
+
+    // Waits for any outstanding job to finish before clearing the stage's state.
+    void reset()
+    {
+        waitForJob();
+
+        engine->reset();
+        bufferInput.clear();
+        bufferOutput.clear();
+        bufferJobInput.clear();
+        bufferJobOutput.clear();
+        inputDataPos = 0;
+    }
+
+    // Adds the delayed result of this stage to the output.
+    // StartJob is called whenever a new job becomes pending.
+    template <typename StartJob>
+    void processSamples (const float* input, float* output, size_t numSamples, StartJob&& startJob)
+    {
+        size_t numSamplesProcessed = 0;
+
+        auto* inputData  = bufferInput.getWritePointer (0);
+        auto* outputData = bufferOutput.getWritePointer (0);
+
+        while (numSamplesProcessed < numSamples)
+        {
+            const auto numSamplesToProcess = jmin (numSamples - numSamplesProcessed, blockSize - inputDataPos);
+
+            FloatVectorOperations::copy (inputData + inputDataPos, input + numSamplesProcessed, static_cast<int> (numSamplesToProcess));
+            FloatVectorOperations::add (output + numSamplesProcessed, outputData + inputDataPos, static_cast<int> (numSamplesToProcess));
+
+            numSamplesProcessed += numSamplesToProcess;
+            inputDataPos += numSamplesToProcess;
+
+            if (inputDataPos == blockSize)
+            {
+                // The previous job must be finished before its result can be used
+                waitForJob();
+
+                std::swap (bufferOutput, bufferJobOutput);
+                outputData = bufferOutput.getWritePointer (0);
+
+                bufferJobInput.copyFrom (0, 0, bufferInput, 0, 0, static_cast<int> (blockSize));
+                state = JobState::pending;
+                inputDataPos = 0;
+
+                startJob();
+            }
+        }
+    }
+
+    // Runs the pending job on the calling thread, if there is one.
+    // Returns true if a job was run.
+    bool tryRunPendingJob()
+    {
+        auto expected = JobState::pending;
+
+        if (! state.compare_exchange_strong (expected, JobState::running))
+            return false;
+
+        // Processing a whole block returns the output computed for the previous block,
+        // and leaves the output for this block at the start of the engine's output buffer
+        engine->processSamplesWithAddedLatency (bufferJobInput.getReadPointer (0),
+                                                bufferJobOutput.getWritePointer (0),
+                                                blockSize);
+        bufferJobOutput.copyFrom (0, 0, engine->bufferOutput.get (0), static_cast<int> (blockSize));
+
+        state = JobState::idle;
+        return true;
+    }
+
+private:
+    enum class JobState { idle, pending, running };
+
+    void waitForJob()
+    {
+        // If the worker hasn't picked up the job yet, we'll do it ourselves
+        tryRunPendingJob();
+
+        while (state == JobState::running)
+            Thread::yield();
+    }
+
+    static std::unique_ptr<ConvolutionEngine> makePaddedEngine (const float* samples,
+                                                                size_t numSamples,
+                                                                size_t numLeadingZeros,
+                                                                size_t blockSize)
+    {
+        std::vector<float> padded (numLeadingZeros + numSamples, 0.0f);
+        std::copy (samples, samples + numSamples, padded.begin() + (std::ptrdiff_t) numLeadingZeros);
+
+        return std::make_unique<ConvolutionEngine> (padded.data(), padded.size(), blockSize);
+    }
+
+    const std::unique_ptr<ConvolutionEngine> engine;
+    const size_t blockSize;
+    size_t inputDataPos = 0;
+    std::atomic<JobState> state { JobState::idle };
+
+    AudioBuffer<float> bufferInput, bufferOutput, bufferJobInput, bufferJobOutput;
 };
 
+void ConvolutionWorker::run()
+{
+    while (! threadShouldExit())
+    {
+        auto didWork = false;
+
+        for (auto& slot : slots)
+        {
+            auto* stage = slot.load();
+
+            if (stage == nullptr)
+                continue;
+
+            // The stage is marked as in use before it's claimed, so that removeStage()
+            // either takes it out of the slot first, or waits for the job to finish
+            stageInUse = stage;
+
+            if (slot.compare_exchange_strong (stage, nullptr))
+                didWork = stage->tryRunPendingJob() || didWork;
+
+            stageInUse = nullptr;
+        }
+
+        if (! didWork)
+            wait (-1);
+    }
+}
+
 //==============================================================================
 class MultichannelEngine
 {
@@ -445,7 +761,8 @@ public:
                         int maxBlockSize,
                         int maxBufferSize,
                         Convolution::NonUniform headSizeIn,
-                        bool isZeroDelayIn)
+                        bool isZeroDelayIn,
+                        ConvolutionWorker& workerIn)
         : tailBuffer (1, maxBlockSize),
           latency (isZeroDelayIn ? 0 : maxBufferSize),
           irSize (buf.getNumSamples()),
@@ -466,6 +783,48 @@ public:
             for (int i = 0; i < numChannels; ++i)
                 head.emplace_back (makeEngine (i, 0, buf.getNumSamples(), static_cast<uint32> (maxBufferSize)));
         }
+        else if (headSizeIn.processTailOnBackgroundThread
+                 || headSizeIn.maxPartitionSizeInSamples > headSizeIn.headSizeInSamples)
+        {
+            // Gardner-style partitioning: each stage has a block size twice as large
+            // as the previous one. A stage adds a delay of twice its block size, so
+            // it can't start any earlier than that in the IR. Any remaining delay
+            // is made up by padding the start of the stage's IR segment with zeros.
+            constexpr auto numPartitionsPerStage = 8;
+
+            const auto numSamples = buf.getNumSamples();
+            const auto headBlockSize = headSizeIn.headSizeInSamples;
+            const auto maxStageBlockSize = jmax (headBlockSize, headSizeIn.maxPartitionSizeInSamples);
+            const auto headLength = jmin (numSamples, 2 * headBlockSize);
+
+            for (int i = 0; i < numChannels; ++i)
+                head.emplace_back (makeEngine (i, 0, headLength, static_cast<uint32> (maxBufferSize)));
+
+            for (auto stageBlockSize = headBlockSize, offset = headLength; offset < numSamples; stageBlockSize *= 2)
+            {
+                const auto end = stageBlockSize < maxStageBlockSize ? jmin (numSamples, offset + numPartitionsPerStage * stageBlockSize)
+                                                                    : numSamples;
+                const auto numLeadingZeros = static_cast<size_t> (offset + latency - 2 * stageBlockSize);
+
+                for (int i = 0; i < numChannels; ++i)
+                {
+                    stages.emplace_back (std::make_unique<ConvolutionStage> (buf.getReadPointer (jmin (buf.getNumChannels() - 1, i), offset),
+                                                                             static_cast<size_t> (end - offset),
+                                                                             numLeadingZeros,
+                                                                             static_cast<size_t> (stageBlockSize)));
+                }
+
+                offset = end;
+            }
+
+            stageInputBuffer.setSize (1, maxBlockSize);
+
+            if (headSizeIn.processTailOnBackgroundThread && ! stages.empty())
+            {
+                worker = &workerIn;
+                worker->start();
+            }
+        }
         else
         {
             const auto size = jmin (buf.getNumSamples(), headSizeIn.headSizeInSamples);
@@ -481,6 +840,14 @@ public:
         }
     }
 
+    ~MultichannelEngine()
+    {
+        // This may happen on the audio thread, so it mustn't wait for the worker to stop
+        if (worker != nullptr)
+            for (const auto& s : stages)
+                worker->removeStage (*s);
+    }
+
     void reset()
     {
         for (const auto& e : head)
@@ -488,6 +855,9 @@ public:
 
         for (const auto& e : tail)
             e->reset();
+
+        for (const auto& s : stages)
+            s->reset();
     }
 
     void processSamples (const AudioBlock<const float>& input, AudioBlock<float>& output)
@@ -499,9 +869,14 @@ public:
         const auto tailBlock = fullTailBlock.getSubBlock (0, (size_t) numSamples);
 
         const auto isUniform = tail.empty();
+        const auto numStagesPerChannel = stages.size() / head.size();
 
         for (size_t channel = 0; channel < numChannels; ++channel)
         {
+            // The head engine may overwrite the input, so the stages read from a copy
+            if (numStagesPerChannel != 0)
+                stageInputBuffer.copyFrom (0, 0, input.getChannelPointer (channel), static_cast<int> (numSamples));
+
             if (! isUniform)
                 tail[channel]->processSamplesWithAddedLatency (input.getChannelPointer (channel),
                                                                tailBlock.getChannelPointer (0),
@@ -518,6 +893,23 @@ public:
 
             if (! isUniform)
                 output.getSingleChannelBlock (channel) += tailBlock;
+
+            for (size_t i = 0; i < numStagesPerChannel; ++i)
+            {
+                auto& stage = *stages[i * head.size() + channel];
+
+                // Without a worker, jobs are run as soon as each stage's period is complete
+                stage.processSamples (stageInputBuffer.getReadPointer (0),
+                                      output.getChannelPointer (channel),
+                                      numSamples,
+                                      [&]
+                                      {
+                                          if (worker != nullptr)
+                                              worker->jobAdded (stage);
+                                          else
+                                              stage.tryRunPendingJob();
+                                      });
+            }
         }
 
         const auto numOutputChannels = output.getNumChannels();
@@ -534,6 +926,11 @@ private:
     std::vector<std::unique_ptr<ConvolutionEngine>> head, tail;
     AudioBuffer<float> tailBuffer;
 
+    // Stages are stored in order of increasing block size, interleaved by channel
+    std::vector<std::unique_ptr<ConvolutionStage>> stages;
+    AudioBuffer<float> stageInputBuffer;
+    ConvolutionWorker* worker = nullptr;
+
     const int latency;
     const int irSize;
     const int blockSize;
@@ -729,10 +1126,14 @@ class ConvolutionEngineFactory
 {
 public:
     ConvolutionEngineFactory (Convolution::Latency requiredLatency,
-                              Convolution::NonUniform requiredHeadSize)
+                              Convolution::NonUniform requiredHeadSize,
+                              ConvolutionWorker& workerIn)
         : latency  { (requiredLatency.latencyInSamples   <= 0) ? 0 : jmax (64, nextPowerOfTwo (requiredLatency.latencyInSamples)) },
-          headSize { (requiredHeadSize.headSizeInSamples <= 0) ? 0 : jmax (64, nextPowerOfTwo (requiredHeadSize.headSizeInSamples)) },
-          shouldBeZeroLatency (requiredLatency.latencyInSamples == 0)
+          headSize { (requiredHeadSize.headSizeInSamples <= 0) ? 0 : jmax (64, nextPowerOfTwo (requiredHeadSize.headSizeInSamples)),
+                     (requiredHeadSize.maxPartitionSizeInSamples <= 0) ? 0 : nextPowerOfTwo (requiredHeadSize.maxPartitionSizeInSamples),
+                     requiredHeadSize.processTailOnBackgroundThread },
+          shouldBeZeroLatency (requiredLatency.latencyInSamples == 0),
+          worker (workerIn)
     {}
 
     // It is safe to call this method simultaneously with other public
@@ -790,7 +1191,8 @@ private:
                                                      processSpec.maximumBlockSize,
                                                      maxBufferSize,
                                                      headSize,
-                                                     shouldBeZeroLatency);
+                                                     shouldBeZeroLatency,
+                                                     worker);
     }
 
     static AudioBuffer<float> makeImpulseBuffer()
@@ -807,6 +1209,7 @@ private:
     const Convolution::Latency latency;
     const Convolution::NonUniform headSize;
     const bool shouldBeZeroLatency;
+    ConvolutionWorker& worker;
 
     TryLockedPtr<MultichannelEngine> engine;
 
@@ -849,7 +1252,7 @@ public:
     ConvolutionEngineQueue (BackgroundMessageQueue& queue,
                             Convolution::Latency latencyIn,
                             Convolution::NonUniform headSizeIn)
-        : messageQueue (queue), factory (latencyIn, headSizeIn) {}
+        : messageQueue (queue), factory (latencyIn, headSizeIn, queue.getWorker()) {}
 
     void loadImpulseResponse (AudioBuffer<float>&& buffer,
                               double sr,
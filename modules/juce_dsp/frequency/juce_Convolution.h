@@ -128,8 +128,32 @@ public:
     */
     explicit Convolution (const Latency& requiredLatency);
 
-    /** Contains configuration information for a non-uniform convolution. */
-    struct NonUniform { int headSizeInSamples; };
+    /** Contains configuration information for a non-uniform convolution.
+
+        By default, the impulse response is split into a head, which is processed
+        with zero latency, and a tail which is processed using a larger partition
+        size.
+
+        If maxPartitionSizeInSamples is greater than headSizeInSamples, the tail
+        will instead be split into several stages, where each stage uses a partition
+        size twice as large as the previous stage, starting at headSizeInSamples and
+        increasing up to maxPartitionSizeInSamples. This can greatly reduce the
+        CPU cost of very long impulse responses.
+
+        If processTailOnBackgroundThread is true, the tail will also be split into
+        stages, and these stages will be computed on a background thread owned by
+        the Convolution's ConvolutionMessageQueue, so that most of the work for long
+        impulse responses happens away from the audio thread. Convolutions that
+        share a queue also share this thread. The result is identical to processing the stages on the audio
+        thread: if a stage isn't ready by the time its output is needed, the audio
+        thread will wait for it.
+    */
+    struct NonUniform
+    {
+        int headSizeInSamples;
+        int maxPartitionSizeInSamples = 0;
+        bool processTailOnBackgroundThread = false;
+    };
 
     /** Initialises an object for performing convolution in the frequency domain
         using a non-uniform partitioned algorithm.
@@ -138,8 +162,8 @@ public:
         efficiency of the processing for IR sizes of 4096 samples or greater
         (recommended for reverberation IRs).
 
-        @param requiredHeadSize       the head IR size for two stage non-uniform
-                                      partitioned convolution
+        @param requiredHeadSize       the head IR size and partitioning options for
+                                      non-uniform partitioned convolution
      */
     explicit Convolution (const NonUniform& requiredHeadSize);
 
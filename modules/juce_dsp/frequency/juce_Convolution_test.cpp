@@ -266,6 +266,31 @@ public:
             return result;
         }();
 
+       #if JUCE_USE_SIMD
+        beginTest ("SIMD multiply-accumulate matches the scalar implementation");
+        {
+            auto random = getRandom();
+
+            for (size_t fftSize : { 8u, 16u, 256u, 2048u })
+            {
+                FrequencyDomainBuffers buffers (4, fftSize * 2);
+
+                for (size_t i = 0; i <= fftSize; ++i)
+                {
+                    buffers.get (0)[i] = random.nextFloat() * 2.0f - 1.0f;
+                    buffers.get (1)[i] = random.nextFloat() * 2.0f - 1.0f;
+                    buffers.get (2)[i] = buffers.get (3)[i] = random.nextFloat() * 2.0f - 1.0f;
+                }
+
+                ConvolutionEngine::multiplyAccumulateScalar (buffers.get (0), buffers.get (1), buffers.get (2), fftSize);
+                ConvolutionEngine::multiplyAccumulateSIMD   (buffers.get (0), buffers.get (1), buffers.get (3), fftSize);
+
+                for (size_t i = 0; i <= fftSize; ++i)
+                    expectWithinAbsoluteError (buffers.get (3)[i], buffers.get (2)[i], 1.0e-5f);
+            }
+        }
+       #endif
+
         beginTest ("Impulse responses can be loaded without allocating on the audio thread");
         {
             Convolution convolution;
@@ -546,6 +571,70 @@ public:
             }
         }
 
+        beginTest ("Multi-stage non-uniform convolutions work");
+        {
+            const auto ramp = makeStereoRamp (static_cast<int> (spec.maximumBlockSize) * 24);
+
+            for (auto useBackgroundThread : { false, true })
+            {
+                for (auto headSize : { 64, static_cast<int> (spec.maximumBlockSize) })
+                {
+                    testConvolution (spec,
+                                     Convolution::NonUniform { headSize, 2048, useBackgroundThread },
+                                     ramp,
+                                     spec.sampleRate,
+                                     Convolution::Stereo::yes,
+                                     Convolution::Trim::yes,
+                                     Convolution::Normalise::no,
+                                     ramp);
+                }
+            }
+        }
+
+        beginTest ("Convolutions sharing a message queue can process their tails on the same thread");
+        {
+            const auto ramp = makeStereoRamp (static_cast<int> (spec.maximumBlockSize) * 24);
+            const auto numBlocks = ramp.getNumSamples() / static_cast<int> (spec.maximumBlockSize);
+
+            ConvolutionMessageQueue queue;
+            std::vector<std::unique_ptr<Convolution>> convolutions;
+
+            for (auto i = 0; i < 3; ++i)
+            {
+                convolutions.push_back (std::make_unique<Convolution> (Convolution::NonUniform { 64, 2048, true }, queue));
+
+                auto copiedIr = ramp;
+                convolutions.back()->loadImpulseResponse (std::move (copiedIr), spec.sampleRate, Convolution::Stereo::yes,
+                                                          Convolution::Trim::no, Convolution::Normalise::no);
+                convolutions.back()->prepare (spec);
+            }
+
+            std::vector<AudioBuffer<float>> outputs (convolutions.size(), AudioBuffer<float> (ramp.getNumChannels(), ramp.getNumSamples()));
+
+            for (auto i = 0; i < numBlocks; ++i)
+            {
+                for (size_t c = 0; c < convolutions.size(); ++c)
+                {
+                    if (i == 0)
+                        addDiracImpulse (block);
+                    else
+                        block.clear();
+
+                    convolutions[c]->process (context);
+
+                    for (auto channel = 0; channel < ramp.getNumChannels(); ++channel)
+                        outputs[c].copyFrom (channel, i * static_cast<int> (spec.maximumBlockSize), buffer, channel, 0, static_cast<int> (spec.maximumBlockSize));
+                }
+            }
+
+            for (const auto& output : outputs)
+                for (auto channel = 0; channel < ramp.getNumChannels(); ++channel)
+                    for (auto i = 0; i < ramp.getNumSamples(); ++i)
+                        nonAllocatingExpectWithinAbsoluteError (output.getSample (channel, i), ramp.getSample (channel, i), 0.01f);
+
+            convolutions.clear();
+        }
+
         beginTest ("Convolutions with latency work");
         {
             const auto ramp = makeRamp (static_cast<int> (spec.maximumBlockSize) * 8);
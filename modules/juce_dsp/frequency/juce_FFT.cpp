@@ -26,14 +26,34 @@
 namespace juce::dsp
 {
 
-struct FFT::Instance
+template <typename FloatType>
+struct FFTInstanceBase
 {
-    virtual ~Instance() = default;
-    virtual void perform (const Complex<float>* input, Complex<float>* output, bool inverse) const noexcept = 0;
-    virtual void performRealOnlyForwardTransform (float*, bool) const noexcept = 0;
-    virtual void performRealOnlyInverseTransform (float*) const noexcept = 0;
+    virtual ~FFTInstanceBase() = default;
+    virtual void perform (const Complex<FloatType>* input, Complex<FloatType>* output, bool inverse) const noexcept = 0;
+    virtual void performRealOnlyForwardTransform (FloatType*, bool) const noexcept = 0;
+    virtual void performRealOnlyInverseTransform (FloatType*) const noexcept = 0;
+
+    // Engines that can transform several channels more efficiently than one at a time may override these
+    virtual void performRealOnlyForwardTransforms (FloatType* const* channels, int numChannels, bool ignoreNegativeFreqs) const noexcept
+    {
+        for (int i = 0; i < numChannels; ++i)
+            performRealOnlyForwardTransform (channels[i], ignoreNegativeFreqs);
+    }
+
+    virtual void performRealOnlyInverseTransforms (FloatType* const* channels, int numChannels) const noexcept
+    {
+        for (int i = 0; i < numChannels; ++i)
+            performRealOnlyInverseTransform (channels[i]);
+    }
 };
 
+struct FFT::Instance : public FFTInstanceBase<float> {};
+struct FFT::DoublePrecisionInstance : public FFTInstanceBase<double> {};
+
+template <typename FloatType>
+using FFTInstanceFor = std::conditional_t<std::is_same_v<FloatType, double>, FFT::DoublePrecisionInstance, FFT::Instance>;
+
 struct FFT::Engine
 {
     Engine (int priorityToUse) : enginePriority (priorityToUse)
@@ -46,6 +66,7 @@ struct FFT::Engine
     virtual ~Engine() = default;
 
     virtual FFT::Instance* create (int order) const = 0;
+    virtual FFT::DoublePrecisionInstance* createDoublePrecision (int order) const = 0;
 
     //==============================================================================
     static FFT::Instance* createBestEngineForPlatform (int order)
@@ -58,6 +79,16 @@ struct FFT::Engine
         return nullptr;
     }
 
+    static FFT::DoublePrecisionInstance* createBestDoublePrecisionEngineForPlatform (int order)
+    {
+        for (auto* engine : getEngines())
+            if (auto* instance = engine->createDoublePrecision (order))
+                return instance;
+
+        jassertfalse;  // This should never happen as the radix-4 engine should always work!
+        return nullptr;
+    }
+
 private:
     static Array<Engine*>& getEngines()
     {
@@ -68,11 +99,27 @@ private:
     int enginePriority; // used so that faster engines have priority over slower ones
 };
 
+// Each engine is registered for the precision of the instance type it creates
 template <typename InstanceToUse>
 struct FFT::EngineImpl  : public FFT::Engine
 {
     EngineImpl() : FFT::Engine (InstanceToUse::priority)        {}
-    FFT::Instance* create (int order) const override            { return InstanceToUse::create (order); }
+
+    FFT::Instance* create ([[maybe_unused]] int order) const override
+    {
+        if constexpr (std::is_base_of_v<FFT::Instance, InstanceToUse>)
+            return InstanceToUse::create (order);
+        else
+            return nullptr;
+    }
+
+    FFT::DoublePrecisionInstance* createDoublePrecision ([[maybe_unused]] int order) const override
+    {
+        if constexpr (std::is_base_of_v<FFT::DoublePrecisionInstance, InstanceToUse>)
+            return InstanceToUse::create (order);
+        else
+            return nullptr;
+    }
 };
 
 //==============================================================================
@@ -429,6 +476,584 @@ struct FFTFallback final : public FFT::Instance
 
 FFT::EngineImpl<FFTFallback> fftFallback;
 
+//==============================================================================
+//==============================================================================
+template <typename Vector>
+struct FFTVectorOps
+{
+    static constexpr size_t size = 1;
+
+    static Vector load (const Vector* source) noexcept          { return *source; }
+    static void store (Vector value, Vector* dest) noexcept     { *dest = value; }
+    static Vector expand (Vector value) noexcept                { return value; }
+};
+
+#if JUCE_USE_SIMD
+template <typename Element>
+struct FFTVectorOps<SIMDRegister<Element>>
+{
+    using Register = SIMDRegister<Element>;
+
+    static constexpr size_t size = Register::SIMDNumElements;
+
+    static Register load (const Element* source) noexcept           { return Register::fromRawArray (source); }
+    static void store (Register value, Element* dest) noexcept      { value.copyToRawArray (dest); }
+    static Register expand (Element value) noexcept                 { return Register::expand (value); }
+};
+#endif
+
+/*  A self-contained power-of-two FFT, used when no platform FFT library is available.
+
+    Complex transforms use a radix-4 Stockham autosort algorithm, which produces its
+    output in natural order without a separate bit-reversal pass. The data is kept in
+    split real/imaginary planes, so that whenever the stride of a pass is at least as
+    wide as a SIMDRegister, the butterflies of neighbouring sub-transforms can be
+    computed together using whichever instruction set (SSE, AVX or NEON) SIMDRegister
+    was built for. Real-only transforms are computed with a complex transform of half
+    the size.
+
+    The double-precision version is always available, so it's also the engine of last
+    resort for the double-precision functions.
+*/
+template <typename FloatType>
+struct FFTRadix4 final : public FFTInstanceFor<FloatType>
+{
+   #if JUCE_USE_SIMD
+    using Vector = SIMDRegister<FloatType>;
+   #else
+    using Vector = FloatType;
+   #endif
+
+    static constexpr size_t vectorSize = FFTVectorOps<Vector>::size;
+
+    // faster than the fallback, but slower than any of the platform libraries
+    static constexpr int priority = 0;
+
+    static FFTRadix4* create (int order)
+    {
+        return new FFTRadix4 (order);
+    }
+
+    explicit FFTRadix4 (int order)
+        : size ((size_t) 1 << order),
+          complexTransform (size),
+          halfSizeTransform (jmax ((size_t) 1, size / 2)),
+          realTwiddles (size / 2 + 1)
+    {
+        for (size_t k = 0; k < realTwiddles.real.size(); ++k)
+        {
+            const auto angle = MathConstants<double>::twoPi * (double) k / (double) size;
+            realTwiddles.real[k] = (FloatType) std::cos (angle);
+            realTwiddles.imag[k] = (FloatType) -std::sin (angle);
+        }
+    }
+
+    void perform (const Complex<FloatType>* input, Complex<FloatType>* output, bool inverse) const noexcept override
+    {
+        if (size == 1)
+        {
+            *output = *input;
+            return;
+        }
+
+        const SpinLock::ScopedLockType sl (processLock);
+
+        auto* re = scratch.get (0);
+        auto* im = scratch.get (1);
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            re[i] = input[i].real();
+            im[i] = input[i].imag();
+        }
+
+        if (inverse)
+        {
+            // swapping the real and imaginary parts turns a forward transform into an inverse one
+            complexTransform.perform (im, re, scratch.get (3), scratch.get (2));
+
+            const auto scaleFactor = (FloatType) 1 / (FloatType) size;
+
+            for (size_t i = 0; i < size; ++i)
+                output[i] = { re[i] * scaleFactor, im[i] * scaleFactor };
+        }
+        else
+        {
+            complexTransform.perform (re, im, scratch.get (2), scratch.get (3));
+
+            for (size_t i = 0; i < size; ++i)
+                output[i] = { re[i], im[i] };
+        }
+    }
+
+    void performRealOnlyForwardTransform (FloatType* d, bool ignoreNegativeFreqs) const noexcept override
+    {
+        if (size == 1)
+            return;
+
+        const SpinLock::ScopedLockType sl (processLock);
+        performRealOnlyForward<FloatType> (&d, ignoreNegativeFreqs);
+    }
+
+    void performRealOnlyInverseTransform (FloatType* d) const noexcept override
+    {
+        if (size == 1)
+            return;
+
+        const SpinLock::ScopedLockType sl (processLock);
+        performRealOnlyInverse<FloatType> (&d);
+    }
+
+    void performRealOnlyForwardTransforms (FloatType* const* channels, int numChannels, bool ignoreNegativeFreqs) const noexcept override
+    {
+        if (size == 1)
+            return;
+
+        const SpinLock::ScopedLockType sl (processLock);
+        auto channel = 0;
+
+        // Each group of channels is transformed together, one channel per SIMD lane,
+        // so that every butterfly and twiddle factor is shared between the channels
+        if (vectorSize > 1)
+            for (; channel + (int) vectorSize <= numChannels; channel += (int) vectorSize)
+                performRealOnlyForward<Vector> (channels + channel, ignoreNegativeFreqs);
+
+        for (; channel < numChannels; ++channel)
+            performRealOnlyForward<FloatType> (channels + channel, ignoreNegativeFreqs);
+    }
+
+    void performRealOnlyInverseTransforms (FloatType* const* channels, int numChannels) const noexcept override
+    {
+        if (size == 1)
+            return;
+
+        const SpinLock::ScopedLockType sl (processLock);
+        auto channel = 0;
+
+        if (vectorSize > 1)
+            for (; channel + (int) vectorSize <= numChannels; channel += (int) vectorSize)
+                performRealOnlyInverse<Vector> (channels + channel);
+
+        for (; channel < numChannels; ++channel)
+            performRealOnlyInverse<FloatType> (channels + channel);
+    }
+
+private:
+    //==============================================================================
+    // Transforms as many channels as there are lanes in Vec. The scratch data holds
+    // the channels interleaved, so that each Vec contains one sample from every channel.
+    template <typename Vec>
+    void performRealOnlyForward (FloatType* const* channels, bool ignoreNegativeFreqs) const noexcept
+    {
+        using Ops = FFTVectorOps<Vec>;
+        constexpr auto lanes = Ops::size;
+
+        const auto half = size / 2;
+        auto* zr = scratch.get (0);
+        auto* zi = scratch.get (1);
+
+        // treat the even and odd samples as the real and imaginary parts of a half-size signal
+        for (size_t n = 0; n < half; ++n)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                zr[n * lanes + lane] = channels[lane][2 * n];
+                zi[n * lanes + lane] = channels[lane][2 * n + 1];
+            }
+        }
+
+        halfSizeTransform.perform (zr, zi, scratch.get (2), scratch.get (3), lanes);
+
+        // then separate the spectra of the even and odd samples, and combine them
+        const auto oneHalf = Ops::expand ((FloatType) 0.5);
+        alignas (sizeof (Vec)) FloatType resultRe[lanes];
+        alignas (sizeof (Vec)) FloatType resultIm[lanes];
+
+        for (size_t k = 1; k < half; ++k)
+        {
+            const auto r0 = Ops::load (zr + k * lanes),          i0 = Ops::load (zi + k * lanes);
+            const auto r1 = Ops::load (zr + (half - k) * lanes), i1 = Ops::load (zi + (half - k) * lanes);
+
+            const auto sumRe  = (r0 + r1) * oneHalf;
+            const auto sumIm  = (i0 - i1) * oneHalf;
+            const auto diffRe = (i0 + i1) * oneHalf;
+            const auto diffIm = (r1 - r0) * oneHalf;
+
+            const auto wr = Ops::expand (realTwiddles.real[k]);
+            const auto wi = Ops::expand (realTwiddles.imag[k]);
+
+            Ops::store (sumRe + wr * diffRe - wi * diffIm, resultRe);
+            Ops::store (sumIm + wr * diffIm + wi * diffRe, resultIm);
+
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                channels[lane][2 * k]     = resultRe[lane];
+                channels[lane][2 * k + 1] = resultIm[lane];
+            }
+        }
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            auto* d = channels[lane];
+            const auto dc = zr[lane], nyquist = zi[lane];
+
+            d[0] = dc + nyquist;
+            d[1] = 0;
+            d[2 * half]     = dc - nyquist;
+            d[2 * half + 1] = 0;
+
+            if (! ignoreNegativeFreqs)
+            {
+                for (size_t k = half + 1; k < size; ++k)
+                {
+                    d[2 * k]     =  d[2 * (size - k)];
+                    d[2 * k + 1] = -d[2 * (size - k) + 1];
+                }
+            }
+        }
+    }
+
+    template <typename Vec>
+    void performRealOnlyInverse (FloatType* const* channels) const noexcept
+    {
+        using Ops = FFTVectorOps<Vec>;
+        constexpr auto lanes = Ops::size;
+
+        const auto half = size / 2;
+        auto* zr = scratch.get (0);
+        auto* zi = scratch.get (1);
+
+        const auto oneHalf = Ops::expand ((FloatType) 0.5);
+        alignas (sizeof (Vec)) FloatType values[4][lanes];
+
+        // rebuild the spectrum of the half-size signal from the positive frequencies
+        for (size_t k = 0; k < half; ++k)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                const auto* d = channels[lane];
+                values[0][lane] =  d[2 * k];
+                values[1][lane] =  d[2 * k + 1];
+                values[2][lane] =  d[2 * (half - k)];
+                values[3][lane] = -d[2 * (half - k) + 1];
+            }
+
+            const auto xr = Ops::load (values[0]), xi = Ops::load (values[1]);
+            const auto cr = Ops::load (values[2]), ci = Ops::load (values[3]);
+
+            const auto sumRe  = (xr + cr) * oneHalf;
+            const auto sumIm  = (xi + ci) * oneHalf;
+            const auto diffRe = (xr - cr) * oneHalf;
+            const auto diffIm = (xi - ci) * oneHalf;
+
+            const auto wr = Ops::expand (realTwiddles.real[k]);
+            const auto wi = Ops::expand (realTwiddles.imag[k]);
+
+            const auto oddRe = diffRe * wr + diffIm * wi;
+            const auto oddIm = diffIm * wr - diffRe * wi;
+
+            Ops::store (sumRe - oddIm, zr + k * lanes);
+            Ops::store (sumIm + oddRe, zi + k * lanes);
+        }
+
+        halfSizeTransform.perform (zi, zr, scratch.get (3), scratch.get (2), lanes);
+
+        const auto scaleFactor = (FloatType) 1 / (FloatType) half;
+
+        for (size_t n = 0; n < half; ++n)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                channels[lane][2 * n]     = zr[n * lanes + lane] * scaleFactor;
+                channels[lane][2 * n + 1] = zi[n * lanes + lane] * scaleFactor;
+            }
+        }
+    }
+
+    //==============================================================================
+    // Holds a number of arrays of floats, each aligned so that it can be loaded into a Vector
+    class AlignedArrays
+    {
+    public:
+        AlignedArrays (size_t numArraysIn, size_t arraySizeIn)
+            : numArrays (numArraysIn),
+              stride ((arraySizeIn + vectorSize - 1) / vectorSize * vectorSize),
+              memory (numArrays * stride + vectorSize, true)
+        {
+            data = snapPointerToAlignment (memory.getData(), vectorSize * sizeof (FloatType));
+        }
+
+        FloatType* get (size_t index) const noexcept
+        {
+            jassert (index < numArrays);
+            return data + index * stride;
+        }
+
+    private:
+        size_t numArrays, stride;
+        HeapBlock<FloatType> memory;
+        FloatType* data = nullptr;
+    };
+
+    struct Twiddles
+    {
+        explicit Twiddles (size_t num) : real (num), imag (num) {}
+
+        std::vector<FloatType> real, imag;
+    };
+
+    //==============================================================================
+    // A forward complex FFT of a fixed power-of-two size, operating on split data
+    class ComplexTransform
+    {
+    public:
+        explicit ComplexTransform (size_t sizeIn)
+            : transformSize (sizeIn)
+        {
+            size_t offset = 0;
+
+            for (auto n = transformSize; n >= 4; n /= 4)
+            {
+                passes.push_back ({ n, transformSize / n, offset });
+
+                // pad each pass's twiddles so that they start on an aligned boundary
+                offset += (n / 4 + vectorSize - 1) / vectorSize * vectorSize;
+            }
+
+            needsRadix2Pass = (transformSize > 1 && (passes.empty() ? transformSize : passes.back().length / 4) == 2);
+
+            // three twiddle factors per butterfly, each stored as a real and an imaginary plane
+            twiddles = std::make_unique<AlignedArrays> ((size_t) 6, jmax ((size_t) 1, offset));
+
+            for (const auto& pass : passes)
+            {
+                for (size_t p = 0; p < pass.length / 4; ++p)
+                {
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        const auto angle = MathConstants<double>::twoPi * (double) ((i + 1) * p) / (double) pass.length;
+                        twiddles->get (2 * i)    [pass.twiddleOffset + p] = (FloatType) std::cos (angle);
+                        twiddles->get (2 * i + 1)[pass.twiddleOffset + p] = (FloatType) -std::sin (angle);
+                    }
+                }
+            }
+        }
+
+        /*  Transforms the data in re and im in place. The work buffers must be
+            the same size as the data, and all four arrays must be aligned.
+
+            If lanes is greater than 1, it must be equal to vectorSize, and each
+            element of the transform is a group of lanes values belonging to
+            independent transforms, which are all performed at once.
+        */
+        void perform (FloatType* re, FloatType* im, FloatType* workRe, FloatType* workIm, size_t lanes = 1) const noexcept
+        {
+            const FloatType* srcRe = re;
+            const FloatType* srcIm = im;
+            FloatType* dstRe = workRe;
+            FloatType* dstIm = workIm;
+
+            for (const auto& pass : passes)
+            {
+                performRadix4Pass (pass, lanes, srcRe, srcIm, dstRe, dstIm);
+
+                srcRe = dstRe;
+                srcIm = dstIm;
+                dstRe = (dstRe == workRe ? re : workRe);
+                dstIm = (dstIm == workIm ? im : workIm);
+            }
+
+            if (needsRadix2Pass)
+            {
+                performRadix2Pass (transformSize / 2 * lanes, srcRe, srcIm, dstRe, dstIm);
+
+                srcRe = dstRe;
+                srcIm = dstIm;
+            }
+
+            if (srcRe != re)
+            {
+                std::copy (srcRe, srcRe + transformSize * lanes, re);
+                std::copy (srcIm, srcIm + transformSize * lanes, im);
+            }
+        }
+
+    private:
+        struct Pass
+        {
+            size_t length, stride, twiddleOffset;
+        };
+
+        template <typename Vec>
+        static void butterfly (const FloatType* xr, const FloatType* xi, size_t inStep,
+                               FloatType* yr, FloatType* yi, size_t outStep,
+                               const std::array<Vec, 6>& w) noexcept
+        {
+            using Ops = FFTVectorOps<Vec>;
+
+            const auto ar = Ops::load (xr),              ai = Ops::load (xi);
+            const auto br = Ops::load (xr + inStep),     bi = Ops::load (xi + inStep);
+            const auto cr = Ops::load (xr + 2 * inStep), ci = Ops::load (xi + 2 * inStep);
+            const auto dr = Ops::load (xr + 3 * inStep), di = Ops::load (xi + 3 * inStep);
+
+            const auto apcR = ar + cr, apcI = ai + ci;
+            const auto amcR = ar - cr, amcI = ai - ci;
+            const auto bpdR = br + dr, bpdI = bi + di;
+            const auto bmdR = br - dr, bmdI = bi - di;
+
+            const auto t1R = amcR + bmdI, t1I = amcI - bmdR;
+            const auto t2R = apcR - bpdR, t2I = apcI - bpdI;
+            const auto t3R = amcR - bmdI, t3I = amcI + bmdR;
+
+            Ops::store (apcR + bpdR, yr);
+            Ops::store (apcI + bpdI, yi);
+            Ops::store (w[0] * t1R - w[1] * t1I, yr + outStep);
+            Ops::store (w[0] * t1I + w[1] * t1R, yi + outStep);
+            Ops::store (w[2] * t2R - w[3] * t2I, yr + 2 * outStep);
+            Ops::store (w[2] * t2I + w[3] * t2R, yi + 2 * outStep);
+            Ops::store (w[4] * t3R - w[5] * t3I, yr + 3 * outStep);
+            Ops::store (w[4] * t3I + w[5] * t3R, yi + 3 * outStep);
+        }
+
+        template <typename Vec>
+        std::array<Vec, 6> loadTwiddles (const Pass& pass, size_t p) const noexcept
+        {
+            std::array<Vec, 6> w;
+
+            for (size_t i = 0; i < w.size(); ++i)
+                w[i] = FFTVectorOps<Vec>::load (twiddles->get (i) + pass.twiddleOffset + p);
+
+            return w;
+        }
+
+        template <typename Vec>
+        std::array<Vec, 6> expandTwiddles (const Pass& pass, size_t p) const noexcept
+        {
+            std::array<Vec, 6> w;
+
+            for (size_t i = 0; i < w.size(); ++i)
+                w[i] = FFTVectorOps<Vec>::expand (twiddles->get (i)[pass.twiddleOffset + p]);
+
+            return w;
+        }
+
+        void performRadix4Pass (const Pass& pass, size_t lanes, const FloatType* xr, const FloatType* xi, FloatType* yr, FloatType* yi) const noexcept
+        {
+            const auto quarter = pass.length / 4;
+            const auto s = pass.stride;
+
+            if (lanes > 1)
+            {
+                // every element is already a full vector of independent transforms
+                jassert (lanes == vectorSize);
+
+                for (size_t p = 0; p < quarter; ++p)
+                {
+                    const auto w = expandTwiddles<Vector> (pass, p);
+
+                    for (size_t q = 0; q < s; ++q)
+                        butterfly (xr + lanes * (q + s * p), xi + lanes * (q + s * p), lanes * s * quarter,
+                                   yr + lanes * (q + s * 4 * p), yi + lanes * (q + s * 4 * p), lanes * s, w);
+                }
+            }
+            else if (s >= vectorSize)
+            {
+                // neighbouring sub-transforms are contiguous, so process several of them at once
+                for (size_t p = 0; p < quarter; ++p)
+                {
+                    const auto w = expandTwiddles<Vector> (pass, p);
+
+                    for (size_t q = 0; q < s; q += vectorSize)
+                        butterfly (xr + q + s * p, xi + q + s * p, s * quarter,
+                                   yr + q + s * 4 * p, yi + q + s * 4 * p, s, w);
+                }
+            }
+            else if (s == 1 && quarter >= vectorSize && vectorSize > 1)
+            {
+                // the first pass: vectorise across butterflies, then scatter the results
+                alignas (sizeof (Vector)) FloatType tempRe[4 * vectorSize];
+                alignas (sizeof (Vector)) FloatType tempIm[4 * vectorSize];
+
+                for (size_t p = 0; p < quarter; p += vectorSize)
+                {
+                    butterfly (xr + p, xi + p, quarter, tempRe, tempIm, vectorSize, loadTwiddles<Vector> (pass, p));
+
+                    for (size_t j = 0; j < vectorSize; ++j)
+                    {
+                        for (size_t k = 0; k < 4; ++k)
+                        {
+                            yr[4 * (p + j) + k] = tempRe[k * vectorSize + j];
+                            yi[4 * (p + j) + k] = tempIm[k * vectorSize + j];
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (size_t p = 0; p < quarter; ++p)
+                {
+                    const auto w = expandTwiddles<FloatType> (pass, p);
+
+                    for (size_t q = 0; q < s; ++q)
+                        butterfly (xr + q + s * p, xi + q + s * p, s * quarter,
+                                   yr + q + s * 4 * p, yi + q + s * 4 * p, s, w);
+                }
+            }
+        }
+
+        // The final pass when the size is an odd power of two. All of its twiddle factors are 1,
+        // so s is just the distance in floats between the two halves of the data.
+        static void performRadix2Pass (size_t s, const FloatType* xr, const FloatType* xi, FloatType* yr, FloatType* yi) noexcept
+        {
+            size_t q = 0;
+
+            if (s >= vectorSize)
+            {
+                using Ops = FFTVectorOps<Vector>;
+
+                for (; q < s; q += vectorSize)
+                {
+                    const auto ar = Ops::load (xr + q), ai = Ops::load (xi + q);
+                    const auto br = Ops::load (xr + q + s), bi = Ops::load (xi + q + s);
+
+                    Ops::store (ar + br, yr + q);
+                    Ops::store (ai + bi, yi + q);
+                    Ops::store (ar - br, yr + q + s);
+                    Ops::store (ai - bi, yi + q + s);
+                }
+            }
+
+            for (; q < s; ++q)
+            {
+                const auto ar = xr[q], ai = xi[q];
+                const auto br = xr[q + s], bi = xi[q + s];
+
+                yr[q] = ar + br;
+                yi[q] = ai + bi;
+                yr[q + s] = ar - br;
+                yi[q + s] = ai - bi;
+            }
+        }
+
+        size_t transformSize;
+        std::vector<Pass> passes;
+        std::unique_ptr<AlignedArrays> twiddles;
+        bool needsRadix2Pass = false;
+    };
+
+    //==============================================================================
+    size_t size;
+    ComplexTransform complexTransform, halfSizeTransform;
+    Twiddles realTwiddles;
+    AlignedArrays scratch { 4, jmax (size, size / 2 * vectorSize) };
+    SpinLock processLock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FFTRadix4)
+};
+
+FFT::EngineImpl<FFTRadix4<float>>  fftRadix4;
+FFT::EngineImpl<FFTRadix4<double>> fftRadix4Double;
+
 //==============================================================================
 //==============================================================================
 #if (JUCE_MAC || JUCE_IOS) && JUCE_USE_VDSP_FRAMEWORK
@@ -550,11 +1175,25 @@ extern "C"
     void fftwf_execute_dft      (void*, void*, void*);
     void fftwf_execute_dft_r2c  (void*, void*, void*);
     void fftwf_execute_dft_c2r  (void*, void*, void*);
+
+   #if JUCE_DSP_USE_STATIC_FFTW_DOUBLE
+    void* fftw_plan_dft_1d      (int, void*, void*, int, int);
+    void* fftw_plan_dft_r2c_1d  (int, void*, void*, int);
+    void* fftw_plan_dft_c2r_1d  (int, void*, void*, int);
+    void fftw_destroy_plan      (void*);
+    void fftw_execute_dft       (void*, void*, void*);
+    void fftw_execute_dft_r2c   (void*, void*, void*);
+    void fftw_execute_dft_c2r   (void*, void*, void*);
+   #endif
 }
 #endif
 
-struct FFTWImpl  : public FFT::Instance
+// fftw3f provides the single-precision functions, and fftw3 the double-precision ones
+template <typename FloatType>
+struct FFTWImpl  : public FFTInstanceFor<FloatType>
 {
+    static constexpr auto isDouble = std::is_same_v<FloatType, double>;
+
    #if JUCE_DSP_USE_STATIC_FFTW
     // if the JUCE developer has gone through the hassle of statically
     // linking in fftw, they probably want to use it
@@ -575,14 +1214,14 @@ struct FFTWImpl  : public FFT::Instance
 
     struct Symbols
     {
-        FFTWPlanRef (*plan_dft_fftw) (unsigned, Complex<float>*, Complex<float>*, int, unsigned);
-        FFTWPlanRef (*plan_r2c_fftw) (unsigned, float*, Complex<float>*, unsigned);
-        FFTWPlanRef (*plan_c2r_fftw) (unsigned, Complex<float>*, float*, unsigned);
+        FFTWPlanRef (*plan_dft_fftw) (unsigned, Complex<FloatType>*, Complex<FloatType>*, int, unsigned);
+        FFTWPlanRef (*plan_r2c_fftw) (unsigned, FloatType*, Complex<FloatType>*, unsigned);
+        FFTWPlanRef (*plan_c2r_fftw) (unsigned, Complex<FloatType>*, FloatType*, unsigned);
         void (*destroy_fftw) (FFTWPlanRef);
 
-        void (*execute_dft_fftw) (FFTWPlanRef, const Complex<float>*, Complex<float>*);
-        void (*execute_r2c_fftw) (FFTWPlanRef, float*, Complex<float>*);
-        void (*execute_c2r_fftw) (FFTWPlanRef, Complex<float>*, float*);
+        void (*execute_dft_fftw) (FFTWPlanRef, const Complex<FloatType>*, Complex<FloatType>*);
+        void (*execute_r2c_fftw) (FFTWPlanRef, FloatType*, Complex<FloatType>*);
+        void (*execute_c2r_fftw) (FFTWPlanRef, Complex<FloatType>*, FloatType*);
 
        #if JUCE_DSP_USE_STATIC_FFTW
         template <typename FuncPtr, typename ActualSymbolType>
@@ -607,11 +1246,11 @@ struct FFTWImpl  : public FFT::Instance
 
       #if ! JUCE_DSP_USE_STATIC_FFTW
        #if JUCE_MAC
-        auto libName = "libfftw3f.dylib";
+        auto libName = isDouble ? "libfftw3.dylib" : "libfftw3f.dylib";
        #elif JUCE_WINDOWS
-        auto libName = "libfftw3f.dll";
+        auto libName = isDouble ? "libfftw3.dll" : "libfftw3f.dll";
        #else
-        auto libName = "libfftw3f.so";
+        auto libName = isDouble ? "libfftw3.so" : "libfftw3f.so";
        #endif
 
         if (lib.open (libName))
@@ -620,23 +1259,43 @@ struct FFTWImpl  : public FFT::Instance
             Symbols symbols;
 
            #if JUCE_DSP_USE_STATIC_FFTW
-            if (! Symbols::symbol (symbols.plan_dft_fftw, fftwf_plan_dft_1d))     return nullptr;
-            if (! Symbols::symbol (symbols.plan_r2c_fftw, fftwf_plan_dft_r2c_1d)) return nullptr;
-            if (! Symbols::symbol (symbols.plan_c2r_fftw, fftwf_plan_dft_c2r_1d)) return nullptr;
-            if (! Symbols::symbol (symbols.destroy_fftw,  fftwf_destroy_plan))    return nullptr;
-
-            if (! Symbols::symbol (symbols.execute_dft_fftw, fftwf_execute_dft))     return nullptr;
-            if (! Symbols::symbol (symbols.execute_r2c_fftw, fftwf_execute_dft_r2c)) return nullptr;
-            if (! Symbols::symbol (symbols.execute_c2r_fftw, fftwf_execute_dft_c2r)) return nullptr;
+            if constexpr (isDouble)
+            {
+               #if JUCE_DSP_USE_STATIC_FFTW_DOUBLE
+                if (! Symbols::symbol (symbols.plan_dft_fftw, fftw_plan_dft_1d))     return nullptr;
+                if (! Symbols::symbol (symbols.plan_r2c_fftw, fftw_plan_dft_r2c_1d)) return nullptr;
+                if (! Symbols::symbol (symbols.plan_c2r_fftw, fftw_plan_dft_c2r_1d)) return nullptr;
+                if (! Symbols::symbol (symbols.destroy_fftw,  fftw_destroy_plan))    return nullptr;
+
+                if (! Symbols::symbol (symbols.execute_dft_fftw, fftw_execute_dft))     return nullptr;
+                if (! Symbols::symbol (symbols.execute_r2c_fftw, fftw_execute_dft_r2c)) return nullptr;
+                if (! Symbols::symbol (symbols.execute_c2r_fftw, fftw_execute_dft_c2r)) return nullptr;
+               #else
+                return nullptr;
+               #endif
+            }
+            else
+            {
+                if (! Symbols::symbol (symbols.plan_dft_fftw, fftwf_plan_dft_1d))     return nullptr;
+                if (! Symbols::symbol (symbols.plan_r2c_fftw, fftwf_plan_dft_r2c_1d)) return nullptr;
+                if (! Symbols::symbol (symbols.plan_c2r_fftw, fftwf_plan_dft_c2r_1d)) return nullptr;
+                if (! Symbols::symbol (symbols.destroy_fftw,  fftwf_destroy_plan))    return nullptr;
+
+                if (! Symbols::symbol (symbols.execute_dft_fftw, fftwf_execute_dft))     return nullptr;
+                if (! Symbols::symbol (symbols.execute_r2c_fftw, fftwf_execute_dft_r2c)) return nullptr;
+                if (! Symbols::symbol (symbols.execute_c2r_fftw, fftwf_execute_dft_c2r)) return nullptr;
+            }
            #else
-            if (! Symbols::symbol (lib, symbols.plan_dft_fftw, "fftwf_plan_dft_1d"))     return nullptr;
-            if (! Symbols::symbol (lib, symbols.plan_r2c_fftw, "fftwf_plan_dft_r2c_1d")) return nullptr;
-            if (! Symbols::symbol (lib, symbols.plan_c2r_fftw, "fftwf_plan_dft_c2r_1d")) return nullptr;
-            if (! Symbols::symbol (lib, symbols.destroy_fftw,  "fftwf_destroy_plan"))    return nullptr;
-
-            if (! Symbols::symbol (lib, symbols.execute_dft_fftw, "fftwf_execute_dft"))     return nullptr;
-            if (! Symbols::symbol (lib, symbols.execute_r2c_fftw, "fftwf_execute_dft_r2c")) return nullptr;
-            if (! Symbols::symbol (lib, symbols.execute_c2r_fftw, "fftwf_execute_dft_c2r")) return nullptr;
+            const String prefix (isDouble ? "fftw_" : "fftwf_");
+
+            if (! Symbols::symbol (lib, symbols.plan_dft_fftw, (prefix + "plan_dft_1d").toRawUTF8()))     return nullptr;
+            if (! Symbols::symbol (lib, symbols.plan_r2c_fftw, (prefix + "plan_dft_r2c_1d").toRawUTF8())) return nullptr;
+            if (! Symbols::symbol (lib, symbols.plan_c2r_fftw, (prefix + "plan_dft_c2r_1d").toRawUTF8())) return nullptr;
+            if (! Symbols::symbol (lib, symbols.destroy_fftw,  (prefix + "destroy_plan").toRawUTF8()))    return nullptr;
+
+            if (! Symbols::symbol (lib, symbols.execute_dft_fftw, (prefix + "execute_dft").toRawUTF8()))     return nullptr;
+            if (! Symbols::symbol (lib, symbols.execute_r2c_fftw, (prefix + "execute_dft_r2c").toRawUTF8())) return nullptr;
+            if (! Symbols::symbol (lib, symbols.execute_c2r_fftw, (prefix + "execute_dft_c2r").toRawUTF8())) return nullptr;
            #endif
 
             return new FFTWImpl (static_cast<size_t> (order), std::move (lib), symbols);
@@ -651,13 +1310,13 @@ struct FFTWImpl  : public FFT::Instance
         ScopedLock lock (getFFTWPlanLock());
 
         auto n = (1u << order);
-        HeapBlock<Complex<float>> in (n), out (n);
+        HeapBlock<Complex<FloatType>> in (n), out (n);
 
         c2cForward = fftw.plan_dft_fftw (n, in.getData(), out.getData(), -1, unaligned | estimate);
         c2cInverse = fftw.plan_dft_fftw (n, in.getData(), out.getData(), +1, unaligned | estimate);
 
-        r2c = fftw.plan_r2c_fftw (n, (float*) in.getData(), in.getData(), unaligned | estimate);
-        c2r = fftw.plan_c2r_fftw (n, in.getData(), (float*) in.getData(), unaligned | estimate);
+        r2c = fftw.plan_r2c_fftw (n, (FloatType*) in.getData(), in.getData(), unaligned | estimate);
+        c2r = fftw.plan_c2r_fftw (n, in.getData(), (FloatType*) in.getData(), unaligned | estimate);
     }
 
     ~FFTWImpl() override
@@ -670,13 +1329,13 @@ struct FFTWImpl  : public FFT::Instance
         fftw.destroy_fftw (c2r);
     }
 
-    void perform (const Complex<float>* input, Complex<float>* output, bool inverse) const noexcept override
+    void perform (const Complex<FloatType>* input, Complex<FloatType>* output, bool inverse) const noexcept override
     {
         if (inverse)
         {
             auto n = (1u << order);
             fftw.execute_dft_fftw (c2cInverse, input, output);
-            FloatVectorOperations::multiply ((float*) output, 1.0f / static_cast<float> (n), (int) n << 1);
+            FloatVectorOperations::multiply ((FloatType*) output, (FloatType) 1 / static_cast<FloatType> (n), (int) n << 1);
         }
         else
         {
@@ -684,12 +1343,12 @@ struct FFTWImpl  : public FFT::Instance
         }
     }
 
-    void performRealOnlyForwardTransform (float* inputOutputData, bool ignoreNegativeFreqs) const noexcept override
+    void performRealOnlyForwardTransform (FloatType* inputOutputData, bool ignoreNegativeFreqs) const noexcept override
     {
         if (order == 0)
             return;
 
-        auto* out = reinterpret_cast<Complex<float>*> (inputOutputData);
+        auto* out = reinterpret_cast<Complex<FloatType>*> (inputOutputData);
 
         fftw.execute_r2c_fftw (r2c, inputOutputData, out);
 
@@ -700,17 +1359,17 @@ struct FFTWImpl  : public FFT::Instance
                 out[i] = std::conj (out[size - i]);
     }
 
-    void performRealOnlyInverseTransform (float* inputOutputData) const noexcept override
+    void performRealOnlyInverseTransform (FloatType* inputOutputData) const noexcept override
     {
         auto n = (1u << order);
 
-        fftw.execute_c2r_fftw (c2r, (Complex<float>*) inputOutputData, inputOutputData);
-        FloatVectorOperations::multiply ((float*) inputOutputData, 1.0f / static_cast<float> (n), (int) n);
+        fftw.execute_c2r_fftw (c2r, (Complex<FloatType>*) inputOutputData, inputOutputData);
+        FloatVectorOperations::multiply (inputOutputData, (FloatType) 1 / static_cast<FloatType> (n), (int) n);
     }
 
     //==============================================================================
     // fftw's plan_* and destroy_* methods are NOT thread safe. So we need to share
-    // a lock between all instances of FFTWImpl
+    // a lock between all instances of FFTWImpl of the same precision
     static CriticalSection& getFFTWPlanLock() noexcept
     {
         static CriticalSection cs;
@@ -725,7 +1384,8 @@ struct FFTWImpl  : public FFT::Instance
     FFTWPlanRef c2cForward, c2cInverse, r2c, c2r;
 };
 
-FFT::EngineImpl<FFTWImpl> fftwEngine;
+FFT::EngineImpl<FFTWImpl<float>>  fftwEngine;
+FFT::EngineImpl<FFTWImpl<double>> fftwDoubleEngine;
 #endif
 
 //==============================================================================
@@ -817,7 +1477,8 @@ FFT::EngineImpl<IntelFFT> fftwEngine;
 // setting at 'Project' > 'Properties' > 'Configuration Properties' > 'Intel
 // Performance Libraries' > 'Use Intel(R) IPP'
 #if _IPP_SEQUENTIAL_STATIC || _IPP_SEQUENTIAL_DYNAMIC || _IPP_PARALLEL_STATIC || _IPP_PARALLEL_DYNAMIC
-class IntelPerformancePrimitivesFFT final : public FFT::Instance
+template <typename FloatType>
+class IntelPerformancePrimitivesFFT final : public FFTInstanceFor<FloatType>
 {
 public:
     static constexpr auto priority = 9;
@@ -833,32 +1494,34 @@ public:
         return {};
     }
 
-    void perform (const Complex<float>* input, Complex<float>* output, bool inverse) const noexcept override
+    void perform (const Complex<FloatType>* input, Complex<FloatType>* output, bool inverse) const noexcept override
     {
+        using IppComplex = typename ComplexTraits::IppComplex;
+
         if (inverse)
         {
-            ippsFFTInv_CToC_32fc (reinterpret_cast<const Ipp32fc*> (input),
-                                  reinterpret_cast<Ipp32fc*> (output),
-                                  cplx.specPtr,
-                                  cplx.workBuf.get());
+            ComplexTraits::inverse (reinterpret_cast<const IppComplex*> (input),
+                                    reinterpret_cast<IppComplex*> (output),
+                                    cplx.specPtr,
+                                    cplx.workBuf.get());
         }
         else
         {
-            ippsFFTFwd_CToC_32fc (reinterpret_cast<const Ipp32fc*> (input),
-                                  reinterpret_cast<Ipp32fc*> (output),
-                                  cplx.specPtr,
-                                  cplx.workBuf.get());
+            ComplexTraits::forward (reinterpret_cast<const IppComplex*> (input),
+                                    reinterpret_cast<IppComplex*> (output),
+                                    cplx.specPtr,
+                                    cplx.workBuf.get());
         }
     }
 
-    void performRealOnlyForwardTransform (float* inoutData, bool ignoreNegativeFreqs) const noexcept override
+    void performRealOnlyForwardTransform (FloatType* inoutData, bool ignoreNegativeFreqs) const noexcept override
     {
-        ippsFFTFwd_RToCCS_32f_I (inoutData, real.specPtr, real.workBuf.get());
+        RealTraits::forward (inoutData, real.specPtr, real.workBuf.get());
 
         if (order == 0)
             return;
 
-        auto* out = reinterpret_cast<Complex<float>*> (inoutData);
+        auto* out = reinterpret_cast<Complex<FloatType>*> (inoutData);
         const auto size = (1 << order);
 
         if (! ignoreNegativeFreqs)
@@ -866,9 +1529,9 @@ public:
                 out[i] = std::conj (out[size - i]);
     }
 
-    void performRealOnlyInverseTransform (float* inoutData) const noexcept override
+    void performRealOnlyInverseTransform (FloatType* inoutData) const noexcept override
     {
-        ippsFFTInv_CCSToR_32f_I (inoutData, real.specPtr, real.workBuf.get());
+        RealTraits::inverse (inoutData, real.specPtr, real.workBuf.get());
     }
 
 private:
@@ -917,20 +1580,48 @@ private:
         SpecPtr specPtr = nullptr;
     };
 
-    struct ComplexTraits
+    struct ComplexTraits32
     {
         static constexpr auto getSize = ippsFFTGetSize_C_32fc;
         static constexpr auto init = ippsFFTInit_C_32fc;
+        static constexpr auto forward = ippsFFTFwd_CToC_32fc;
+        static constexpr auto inverse = ippsFFTInv_CToC_32fc;
         using Spec = IppsFFTSpec_C_32fc;
+        using IppComplex = Ipp32fc;
     };
 
-    struct RealTraits
+    struct RealTraits32
     {
         static constexpr auto getSize = ippsFFTGetSize_R_32f;
         static constexpr auto init = ippsFFTInit_R_32f;
+        static constexpr auto forward = ippsFFTFwd_RToCCS_32f_I;
+        static constexpr auto inverse = ippsFFTInv_CCSToR_32f_I;
         using Spec = IppsFFTSpec_R_32f;
     };
 
+    struct ComplexTraits64
+    {
+        static constexpr auto getSize = ippsFFTGetSize_C_64fc;
+        static constexpr auto init = ippsFFTInit_C_64fc;
+        static constexpr auto forward = ippsFFTFwd_CToC_64fc;
+        static constexpr auto inverse = ippsFFTInv_CToC_64fc;
+        using Spec = IppsFFTSpec_C_64fc;
+        using IppComplex = Ipp64fc;
+    };
+
+    struct RealTraits64
+    {
+        static constexpr auto getSize = ippsFFTGetSize_R_64f;
+        static constexpr auto init = ippsFFTInit_R_64f;
+        static constexpr auto forward = ippsFFTFwd_RToCCS_64f_I;
+        static constexpr auto inverse = ippsFFTInv_CCSToR_64f_I;
+        using Spec = IppsFFTSpec_R_64f;
+    };
+
+    static constexpr auto isDouble = std::is_same_v<FloatType, double>;
+    using ComplexTraits = std::conditional_t<isDouble, ComplexTraits64, ComplexTraits32>;
+    using RealTraits    = std::conditional_t<isDouble, RealTraits64,    RealTraits32>;
+
     IntelPerformancePrimitivesFFT (Context<ComplexTraits>&& complexToUse,
                                    Context<RealTraits>&& realToUse,
                                    const int orderToUse)
@@ -944,13 +1635,31 @@ private:
     int order = 0;
 };
 
-FFT::EngineImpl<IntelPerformancePrimitivesFFT> intelPerformancePrimitivesFFT;
+FFT::EngineImpl<IntelPerformancePrimitivesFFT<float>>  intelPerformancePrimitivesFFT;
+FFT::EngineImpl<IntelPerformancePrimitivesFFT<double>> intelPerformancePrimitivesFFTDouble;
 #endif
 
 //==============================================================================
 //==============================================================================
+// Creates the double-precision engine the first time it's needed
+struct FFT::DoublePrecisionEngine
+{
+    explicit DoublePrecisionEngine (int orderToUse) : order (orderToUse) {}
+
+    const DoublePrecisionInstance* get()
+    {
+        std::call_once (created, [this] { instance.reset (FFT::Engine::createBestDoublePrecisionEngineForPlatform (order)); });
+        return instance.get();
+    }
+
+    const int order;
+    std::once_flag created;
+    std::unique_ptr<DoublePrecisionInstance> instance;
+};
+
 FFT::FFT (int order)
     : engine (FFT::Engine::createBestEngineForPlatform (order)),
+      doublePrecisionEngine (std::make_unique<DoublePrecisionEngine> (order)),
       size (1 << order)
 {
 }
@@ -961,6 +1670,11 @@ FFT& FFT::operator= (FFT&&) noexcept = default;
 
 FFT::~FFT() = default;
 
+const FFT::DoublePrecisionInstance* FFT::getDoublePrecisionEngine() const
+{
+    return doublePrecisionEngine != nullptr ? doublePrecisionEngine->get() : nullptr;
+}
+
 void FFT::perform (const Complex<float>* input, Complex<float>* output, bool inverse) const noexcept
 {
     if (engine != nullptr)
@@ -979,20 +1693,61 @@ void FFT::performRealOnlyInverseTransform (float* inputOutputData) const noexcep
         engine->performRealOnlyInverseTransform (inputOutputData);
 }
 
-void FFT::performFrequencyOnlyForwardTransform (float* inputOutputData, bool ignoreNegativeFreqs) const noexcept
+void FFT::performRealOnlyForwardTransform (float* const* channels, int numChannels, bool ignoreNegativeFreqs) const noexcept
+{
+    if (engine != nullptr)
+        engine->performRealOnlyForwardTransforms (channels, numChannels, ignoreNegativeFreqs);
+}
+
+void FFT::performRealOnlyInverseTransform (float* const* channels, int numChannels) const noexcept
+{
+    if (engine != nullptr)
+        engine->performRealOnlyInverseTransforms (channels, numChannels);
+}
+
+void FFT::perform (const Complex<double>* input, Complex<double>* output, bool inverse) const noexcept
+{
+    if (auto* doubleEngine = getDoublePrecisionEngine())
+        doubleEngine->perform (input, output, inverse);
+}
+
+void FFT::performRealOnlyForwardTransform (double* inputOutputData, bool ignoreNegativeFreqs) const noexcept
+{
+    if (auto* doubleEngine = getDoublePrecisionEngine())
+        doubleEngine->performRealOnlyForwardTransform (inputOutputData, ignoreNegativeFreqs);
+}
+
+void FFT::performRealOnlyInverseTransform (double* inputOutputData) const noexcept
+{
+    if (auto* doubleEngine = getDoublePrecisionEngine())
+        doubleEngine->performRealOnlyInverseTransform (inputOutputData);
+}
+
+template <typename FloatType>
+void FFT::performFrequencyOnlyForwardTransformImpl (FloatType* inputOutputData, bool ignoreNegativeFreqs) const noexcept
 {
     if (size == 1)
         return;
 
     performRealOnlyForwardTransform (inputOutputData, ignoreNegativeFreqs);
-    auto* out = reinterpret_cast<Complex<float>*> (inputOutputData);
+    auto* out = reinterpret_cast<Complex<FloatType>*> (inputOutputData);
 
     const auto limit = ignoreNegativeFreqs ? (size / 2) + 1 : size;
 
     for (int i = 0; i < limit; ++i)
         inputOutputData[i] = std::abs (out[i]);
 
-    zeromem (inputOutputData + limit, static_cast<size_t> (size * 2 - limit) * sizeof (float));
+    zeromem (inputOutputData + limit, static_cast<size_t> (size * 2 - limit) * sizeof (FloatType));
+}
+
+void FFT::performFrequencyOnlyForwardTransform (float* inputOutputData, bool ignoreNegativeFreqs) const noexcept
+{
+    performFrequencyOnlyForwardTransformImpl (inputOutputData, ignoreNegativeFreqs);
+}
+
+void FFT::performFrequencyOnlyForwardTransform (double* inputOutputData, bool ignoreNegativeFreqs) const noexcept
+{
+    performFrequencyOnlyForwardTransformImpl (inputOutputData, ignoreNegativeFreqs);
 }
 
 } // namespace juce::dsp
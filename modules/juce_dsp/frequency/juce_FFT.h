@@ -94,6 +94,27 @@ public:
     */
     void performRealOnlyInverseTransform (float* inputOutputData) const noexcept;
 
+    /** Performs in-place forward transforms on several blocks of real data at once.
+
+        This gives the same results as calling performRealOnlyForwardTransform() on
+        each channel in turn, but some FFT engines are able to transform several
+        channels together, sharing the work of traversing the twiddle tables between
+        them, which can be considerably faster for multichannel processing.
+
+        Each of the numChannels arrays must follow the same rules as the array passed
+        to the single-channel version of this function.
+    */
+    void performRealOnlyForwardTransform (float* const* channels, int numChannels,
+                                          bool onlyCalculateNonNegativeFrequencies = false) const noexcept;
+
+    /** Performs the reverse operation of the multichannel performRealOnlyForwardTransform(),
+        transforming several blocks of frequency-domain data back to reals at once.
+
+        Each of the numChannels arrays must follow the same rules as the array passed
+        to the single-channel version of this function.
+    */
+    void performRealOnlyInverseTransform (float* const* channels, int numChannels) const noexcept;
+
     /** Takes an array and simply transforms it to the magnitude frequency response
         spectrum. This may be handy for things like frequency displays or analysis.
         The size of the array passed in must be 2 * getSize().
@@ -105,6 +126,43 @@ public:
     void performFrequencyOnlyForwardTransform (float* inputOutputData,
                                                bool onlyCalculateNonNegativeFrequencies = false) const noexcept;
 
+    //==============================================================================
+    /** Performs an out-of-place FFT in double precision, either forward or inverse.
+        The arrays must contain at least getSize() elements.
+
+        The first call to any of the double-precision functions allocates the tables
+        needed for double-precision transforms, so you may want to make that call
+        before using the FFT on a realtime thread. If you only use single-precision
+        transforms, no double-precision tables are ever created.
+    */
+    void perform (const Complex<double>* input, Complex<double>* output, bool inverse) const noexcept;
+
+    /** Performs an in-place forward transform on a block of real data in double
+        precision. The layout of the data is the same as for the single-precision
+        version of this function.
+
+        @see perform
+    */
+    void performRealOnlyForwardTransform (double* inputOutputData,
+                                          bool onlyCalculateNonNegativeFrequencies = false) const noexcept;
+
+    /** Performs a reverse operation to data created in the double-precision
+        performRealOnlyForwardTransform().
+
+        @see perform
+    */
+    void performRealOnlyInverseTransform (double* inputOutputData) const noexcept;
+
+    /** Takes an array of doubles and transforms it to the magnitude frequency
+        response spectrum, in the same way as the single-precision version of
+        this function.
+
+        @see perform
+    */
+    void performFrequencyOnlyForwardTransform (double* inputOutputData,
+                                               bool onlyCalculateNonNegativeFrequencies = false) const noexcept;
+
+    //==============================================================================
     /** Returns the number of data points that this FFT was created to work with. */
     int getSize() const noexcept            { return size; }
 
@@ -112,14 +170,22 @@ public:
    #ifndef DOXYGEN
     /* internal */
     struct Instance;
+    struct DoublePrecisionInstance;
     template <typename> struct EngineImpl;
    #endif
 
 private:
     //==============================================================================
     struct Engine;
+    struct DoublePrecisionEngine;
+
+    const DoublePrecisionInstance* getDoublePrecisionEngine() const;
+
+    template <typename FloatType>
+    void performFrequencyOnlyForwardTransformImpl (FloatType*, bool) const noexcept;
 
     std::unique_ptr<Instance> engine;
+    std::unique_ptr<DoublePrecisionEngine> doublePrecisionEngine;
     int size;
 
     //==============================================================================
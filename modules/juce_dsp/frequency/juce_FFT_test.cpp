@@ -194,6 +194,213 @@ struct FFTUnitTest final : public UnitTest
         }
     };
 
+    struct EngineComparisonTest
+    {
+        template <typename Type>
+        static bool isSimilarRelativeToPeak (const Type* actual, const Type* expected, size_t n)
+        {
+            float peak = 1.0f, maxError = 0.0f;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                peak = jmax (peak, (float) std::abs (expected[i]));
+                maxError = jmax (maxError, (float) std::abs (actual[i] - expected[i]));
+            }
+
+            return maxError <= 1.0e-5f * peak;
+        }
+
+        static void run (FFTUnitTest& u)
+        {
+            Random random (378272);
+
+            for (int order = 0; order <= 14; ++order)
+            {
+                const auto n = (size_t) 1 << order;
+
+                const std::unique_ptr<FFT::Instance> radix4 (FFTRadix4<float>::create (order));
+                const std::unique_ptr<FFT::Instance> fallback (FFTFallback::create (order));
+
+                std::vector<Complex<float>> input (n), expected (n), actual (n);
+                fillRandom (random, input.data(), n);
+
+                for (auto inverse : { false, true })
+                {
+                    fallback->perform (input.data(), expected.data(), inverse);
+                    radix4->perform (input.data(), actual.data(), inverse);
+                    u.expect (isSimilarRelativeToPeak (actual.data(), expected.data(), n));
+                }
+
+                std::vector<float> realInput (n * 2), realExpected (n * 2), realActual (n * 2);
+                fillRandom (random, realInput.data(), n);
+
+                for (auto ignoreNegative : { false, true })
+                {
+                    realExpected = realInput;
+                    realActual = realInput;
+                    fallback->performRealOnlyForwardTransform (realExpected.data(), ignoreNegative);
+                    radix4->performRealOnlyForwardTransform (realActual.data(), ignoreNegative);
+
+                    const auto numToCompare = n == 1 ? 1 : (ignoreNegative ? n + 2 : n * 2);
+                    u.expect (isSimilarRelativeToPeak (realActual.data(), realExpected.data(), numToCompare));
+                }
+
+                realActual = realExpected;
+                radix4->performRealOnlyInverseTransform (realActual.data());
+                u.expect (isSimilarRelativeToPeak (realActual.data(), realInput.data(), n));
+            }
+        }
+    };
+
+    struct MultichannelTest
+    {
+        static void run (FFTUnitTest& u)
+        {
+            Random random (378272);
+
+            for (size_t order = 0; order <= 10; ++order)
+            {
+                const auto n = (size_t) 1 << order;
+
+                FFT fft ((int) order);
+
+                for (auto numChannels : { 1, 3, 4, 9 })
+                {
+                    std::vector<std::vector<float>> input, batched, individual;
+
+                    for (auto ch = 0; ch < numChannels; ++ch)
+                    {
+                        input.emplace_back (n * 2, 0.0f);
+                        fillRandom (random, input.back().data(), n);
+                    }
+
+                    std::vector<float*> channels;
+
+                    const auto getChannels = [&] (std::vector<std::vector<float>>& data)
+                    {
+                        channels.clear();
+
+                        for (auto& channel : data)
+                            channels.push_back (channel.data());
+
+                        return channels.data();
+                    };
+
+                    for (auto ignoreNegative : { false, true })
+                    {
+                        batched = individual = input;
+
+                        fft.performRealOnlyForwardTransform (getChannels (batched), numChannels, ignoreNegative);
+
+                        for (auto& channel : individual)
+                            fft.performRealOnlyForwardTransform (channel.data(), ignoreNegative);
+
+                        const auto numToCompare = ignoreNegative ? n + 2 : n * 2;
+
+                        for (auto ch = 0; ch < numChannels; ++ch)
+                            u.expect (checkArrayIsSimilar (batched[(size_t) ch].data(), individual[(size_t) ch].data(), jmin (numToCompare, n * 2)));
+                    }
+
+                    fft.performRealOnlyInverseTransform (getChannels (batched), numChannels);
+
+                    for (auto ch = 0; ch < numChannels; ++ch)
+                        u.expect (checkArrayIsSimilar (batched[(size_t) ch].data(), input[(size_t) ch].data(), n));
+                }
+            }
+        }
+    };
+
+    struct DoublePrecisionTest
+    {
+        static void performReferenceFourier (const std::vector<double>& in, std::vector<Complex<double>>& out)
+        {
+            const auto n = in.size();
+
+            for (size_t k = 0; k < n; ++k)
+            {
+                Complex<double> sum;
+
+                for (size_t i = 0; i < n; ++i)
+                    sum += in[i] * std::polar (1.0, -MathConstants<double>::twoPi * (double) ((i * k) % n) / (double) n);
+
+                out[k] = sum;
+            }
+        }
+
+        template <typename FloatType>
+        static double getRoundTripError (const FFT& fft, const std::vector<double>& input)
+        {
+            const auto n = input.size();
+            std::vector<FloatType> data (n * 2);
+            std::copy (input.begin(), input.end(), data.begin());
+
+            fft.performRealOnlyForwardTransform (data.data(), true);
+            fft.performRealOnlyInverseTransform (data.data());
+
+            double maxError = 0.0;
+
+            for (size_t i = 0; i < n; ++i)
+                maxError = jmax (maxError, std::abs ((double) data[i] - input[i]));
+
+            return maxError;
+        }
+
+        static void run (FFTUnitTest& u)
+        {
+            Random random (378272);
+
+            for (int order = 0; order <= 8; ++order)
+            {
+                const auto n = (size_t) 1 << order;
+                FFT fft (order);
+
+                std::vector<double> input (n);
+
+                for (auto& sample : input)
+                    sample = 2.0 * random.nextDouble() - 1.0;
+
+                std::vector<Complex<double>> reference (n);
+                performReferenceFourier (input, reference);
+
+                std::vector<double> data (n * 2);
+                std::copy (input.begin(), input.end(), data.begin());
+                fft.performRealOnlyForwardTransform (data.data());
+
+                double maxError = 0.0;
+
+                for (size_t k = 0; k < n; ++k)
+                    maxError = jmax (maxError, std::abs (Complex<double> (data[2 * k], data[2 * k + 1]) - reference[k]));
+
+                u.expectLessThan (maxError, 1.0e-10);
+
+                std::vector<Complex<double>> complexInput (reference), complexOutput (n);
+                fft.perform (complexInput.data(), complexOutput.data(), true);
+
+                maxError = 0.0;
+
+                for (size_t i = 0; i < n; ++i)
+                    maxError = jmax (maxError, std::abs (complexOutput[i] - Complex<double> (input[i])));
+
+                u.expectLessThan (maxError, 1.0e-12);
+            }
+
+            for (auto order : { 10, 14, 16 })
+            {
+                FFT fft (order);
+                std::vector<double> input ((size_t) 1 << order);
+
+                for (auto& sample : input)
+                    sample = 2.0 * random.nextDouble() - 1.0;
+
+                const auto doubleError = getRoundTripError<double> (fft, input);
+                const auto floatError  = getRoundTripError<float>  (fft, input);
+
+                u.expectLessThan (doubleError, 1.0e-12);
+                u.expectLessThan (doubleError * 1.0e6, floatError);
+            }
+        }
+    };
+
     template <class TheTest>
     void runTestForAllTypes (const char* unitTestName)
     {
@@ -207,6 +414,9 @@ struct FFTUnitTest final : public UnitTest
         runTestForAllTypes<RealTest> ("Real input numbers Test");
         runTestForAllTypes<FrequencyOnlyTest> ("Frequency only Test");
         runTestForAllTypes<ComplexTest> ("Complex input numbers Test");
+        runTestForAllTypes<MultichannelTest> ("Multichannel real transforms");
+        runTestForAllTypes<DoublePrecisionTest> ("Double precision transforms");
+        runTestForAllTypes<EngineComparisonTest> ("Radix-4 engine matches the fallback engine");
     }
 };
 
@@ -166,6 +166,16 @@
  #define JUCE_DSP_USE_STATIC_FFTW 0
 #endif
 
+/** Config: JUCE_DSP_USE_STATIC_FFTW_DOUBLE
+
+    If this flag is set along with JUCE_DSP_USE_STATIC_FFTW, then JUCE will also
+    use the statically linked fftw libraries for the double-precision functions
+    of JUCE's FFT class. You must also link the double-precision fftw library.
+*/
+#ifndef JUCE_DSP_USE_STATIC_FFTW_DOUBLE
+ #define JUCE_DSP_USE_STATIC_FFTW_DOUBLE 0
+#endif
+
 /** Config: JUCE_DSP_ENABLE_SNAP_TO_ZERO
 
     Enables code in the dsp module to avoid floating point denormals during the